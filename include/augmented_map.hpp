@@ -0,0 +1,242 @@
+#pragma once
+
+#ifndef OCT_AUGMENTED_MAP
+#define OCT_AUGMENTED_MAP
+
+#include "map.hpp"
+
+namespace oct {
+    struct mapped_projection {
+        template <typename Pair>
+        const auto& operator()(const Pair& val) const noexcept {
+            return val.second;
+        }
+    };
+
+    struct interval_high_projection {
+        template <typename Pair>
+        const auto& operator()(const Pair& val) const noexcept {
+            return val.first.second;
+        }
+    };
+
+    //区间按(左端点, 右端点)字典序排列
+    template <typename Kty, typename Compare>
+    struct interval_compare {
+        Compare comp;
+        bool operator()(const pair<Kty, Kty>& left, const pair<Kty, Kty>& right) const {
+            if (comp(left.first, right.first))
+                return true;
+            if (comp(right.first, left.first))
+                return false;
+            return comp(left.second, right.second);
+        }
+    };
+
+    //每个节点保存子树内值经Monoid结合的结果, 区间聚合O(log n)
+    //值改变后必须沿路径重新计算, 因此不提供返回可写引用的operator[]; 经迭代器修改值后需调用refresh
+    template <
+        typename Key,
+        typename Ty,
+        class Monoid       = sum_monoid<Ty>,
+        class Compare      = less<Key>,
+        typename Allocator = allocator<Ty>,
+        template <typename...>
+        typename Tree      = red_black_tree
+    >
+    class aggregate_map : public map<Key, Ty, Compare, Allocator,
+                                     augmented_tree<Tree, monoid_augment<Ty, Monoid, mapped_projection>>::template type> {
+    private:
+        using Base    = map<Key, Ty, Compare, Allocator,
+                            augmented_tree<Tree, monoid_augment<Ty, Monoid, mapped_projection>>::template type>;
+        using Nodeptr = typename Base::Nodeptr;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using key_compare        = typename Base::key_compare;
+        using allocator_type     = typename Base::allocator_type;
+        using const_reference    = typename Base::const_reference;
+        using iterator           = typename Base::iterator;
+
+        aggregate_map() : Base() {}
+
+        explicit aggregate_map(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : Base(comp, alloc) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        aggregate_map(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : Base(begin, end, comp, alloc) {}
+
+        aggregate_map(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : Base(ini_list, comp, alloc) {}
+
+        Ty& operator[](const key_type& key) = delete;
+
+        const Ty& at(const key_type& key) const {
+            iterator it = Base::find(key);
+            if (it == Base::end())
+                Key_error();
+            return (*it).second;
+        }
+
+        pair<iterator, bool> insert_or_assign(const key_type& key, const Ty& value) {
+            pair<iterator, bool> res = Base::insert(value_type(key, value));
+            if (!res.second) {
+                (*res.first).second = value;
+                refresh(res.first);
+            }
+            return res;
+        }
+
+        //经迭代器修改pos处的值后调用
+        void refresh(iterator pos) {
+            Base::Pull_path(Base::Node_of(pos));
+        }
+
+        //关键字落在闭区间[lo, hi]内的值按关键字顺序结合, 无元素时返回单位元
+        Ty range_query(const key_type& lo, const key_type& hi) const {
+            key_compare kcomp = Base::key_comp();
+            Monoid op;
+            Nodeptr split = Base::Root();
+            while (split) {                                     //找到第一个落在区间内的节点, 两侧边界路径由此分叉
+                if (kcomp(split->Key(), lo))
+                    split = split->right;
+                else if (kcomp(hi, split->Key()))
+                    split = split->left;
+                else
+                    break;
+            }
+            if (!split)
+                return op.identity();
+
+            Ty left = op.identity();
+            for (Nodeptr cur = split->left; cur; ) {            //左边界: 不小于lo的节点连同其右子树都在区间内
+                if (kcomp(cur->Key(), lo)) {
+                    cur = cur->right;
+                }
+                else {
+                    Ty part = cur->right ? op(cur->val.second, cur->right->aggregate) : cur->val.second;
+                    left = op(part, left);
+                    cur = cur->left;
+                }
+            }
+            Ty right = op.identity();
+            for (Nodeptr cur = split->right; cur; ) {
+                if (kcomp(hi, cur->Key())) {
+                    cur = cur->left;
+                }
+                else {
+                    Ty part = cur->left ? op(cur->left->aggregate, cur->val.second) : cur->val.second;
+                    right = op(right, part);
+                    cur = cur->right;
+                }
+            }
+            return op(op(left, split->val.second), right);
+        }
+
+        //全部值的结合结果, O(1)
+        Ty aggregate() const {
+            Nodeptr root = Base::Root();
+            return root ? root->aggregate : Monoid().identity();
+        }
+
+    private:
+        [[noreturn]] static void Key_error() {
+            throw std::out_of_range("invalid aggregate_map key");
+        }
+    };
+
+    //以闭区间[lo, hi](要求lo不大于hi)为关键字, 节点保存子树内右端点的最大值
+    //与[lo, hi]重叠的区间可在O(log n)内找到第一个, 全部找出为O(k log n)
+    template <
+        typename Kty,
+        typename Ty,
+        class Compare      = less<Kty>,
+        typename Allocator = allocator<Ty>,
+        template <typename...>
+        typename Tree      = red_black_tree
+    >
+    class interval_map : public map<pair<Kty, Kty>, Ty, interval_compare<Kty, Compare>, Allocator,
+                                    augmented_tree<Tree, monoid_augment<Kty, max_monoid<Kty, Compare>, interval_high_projection>>::template type> {
+    private:
+        using Base    = map<pair<Kty, Kty>, Ty, interval_compare<Kty, Compare>, Allocator,
+                            augmented_tree<Tree, monoid_augment<Kty, max_monoid<Kty, Compare>, interval_high_projection>>::template type>;
+        using Nodeptr = typename Base::Nodeptr;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using key_compare        = typename Base::key_compare;
+        using allocator_type     = typename Base::allocator_type;
+        using iterator           = typename Base::iterator;
+
+        interval_map() : Base() {}
+
+        explicit interval_map(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : Base(comp, alloc) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        interval_map(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : Base(begin, end, comp, alloc) {}
+
+        interval_map(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : Base(ini_list, comp, alloc) {}
+
+        using Base::insert;
+
+        pair<iterator, bool> insert(const Kty& lo, const Kty& hi, const Ty& value) {
+            return Base::insert(value_type(key_type(lo, hi), value));
+        }
+
+        //按左端点顺序第一个与[lo, hi]重叠的区间, 不存在时返回end()
+        iterator overlap_find(const Kty& lo, const Kty& hi) const {
+            Compare comp = Base::key_comp().comp;
+            Nodeptr cur = Base::Root();
+            while (cur) {
+                //左子树的最大右端点不小于lo时, 若左子树中没有重叠区间, 右侧也不会有
+                if (cur->left && !comp(cur->left->aggregate, lo)) {
+                    cur = cur->left;
+                    continue;
+                }
+                if (comp(hi, cur->Key().first))
+                    break;
+                if (!comp(cur->Key().second, lo))
+                    return iterator(cur);
+                cur = cur->right;
+            }
+            return Base::end();
+        }
+
+        //按左端点顺序把与[lo, hi]重叠的全部区间的迭代器写入out
+        template <typename OutputIt>
+        OutputIt range_query(const Kty& lo, const Kty& hi, OutputIt out) const {
+            Compare comp = Base::key_comp().comp;
+            Collect(Base::Root(), lo, hi, out, comp);
+            return out;
+        }
+
+    private:
+        template <typename OutputIt>
+        static void Collect(Nodeptr node, const Kty& lo, const Kty& hi, OutputIt& out, Compare& comp) {
+            while (node && !comp(node->aggregate, lo)) {        //子树右端点都小于lo时整棵剪掉
+                Collect(node->left, lo, hi, out, comp);
+                if (comp(hi, node->Key().first))                //之后的区间左端点都大于hi
+                    return;
+                if (!comp(node->Key().second, lo))
+                    *out++ = iterator(node);
+                node = node->right;
+            }
+        }
+    };
+}
+
+#endif // !OCT_AUGMENTED_MAP
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef OCT_BUCKET_QUEUE
+#define OCT_BUCKET_QUEUE
+
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace oct {
+    /*
+    * characteristics:
+    * [monotone] 单调整数优先级的最小优先队列(Dial): 队列不为空时, 关键字须落在[最近一次出队的关键字, 该关键字 + span]内
+    * [circular buckets] 不少于span + 1个桶组成的环, 每个桶恰好对应一个关键字; push为O(1), pop至多向前扫描span个桶
+    * 适用于边权不超过span的最短路与固定最大延迟的定时器
+    */
+    template <typename Value>
+    class bucket_queue {
+    public:     //统一接口
+        using key_type        = std::size_t;
+        using mapped_type     = Value;
+        using value_type      = pair<std::size_t, Value>;
+        using size_type       = std::size_t;
+        using const_reference = const value_type&;
+
+    private:    //成员变量
+        vector<vector<value_type>> buckets;     //桶数为2的幂
+        size_type mask;
+        size_type max_span;
+        key_type last    = 0;                   //最近一次出队的关键字, 队列中的关键字都在[last, last + span]内
+        key_type current = 0;                   //队列不为空时为最小的关键字
+        size_type val_size = 0;
+
+    public:     //成员函数
+        explicit bucket_queue(size_type span) : max_span(span) {
+            size_type count = 1;
+            while (count <= span)
+                count <<= 1;
+            buckets.resize(count);
+            mask = count - 1;
+        }
+
+        bool empty() const noexcept {
+            return !val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_size;
+        }
+
+        size_type span() const noexcept {
+            return max_span;
+        }
+
+        const_reference top() const {
+            if (!val_size)
+                Logic_error();
+            return buckets[current & mask].back();
+        }
+
+        key_type top_key() const {
+            return top().first;
+        }
+
+        //与priority_queue相同的接口, value的first为关键字
+        void push(value_type value) {
+            push(value.first, std::move(value.second));
+        }
+
+        //队列为空时关键字超出范围则以它为新的last, 否则抛出异常
+        template <typename Ref>
+        void push(key_type key, Ref&& value) {
+            if (key < last || key - last > max_span) {
+                if (val_size)
+                    Key_error();
+                last = key;
+            }
+            if (!val_size || key < current)
+                current = key;
+            buckets[key & mask].emplace_back(key, std::forward<Ref>(value));
+            val_size++;
+        }
+
+        void pop() {
+            if (!val_size)
+                Logic_error();
+            buckets[current & mask].pop_back();
+            last = current;
+            if (--val_size)
+                while (buckets[current & mask].empty())
+                    current++;
+        }
+
+        void clear() {
+            for (size_type i = 0; i < buckets.size(); i++)
+                buckets[i].clear();
+            last = current = 0;
+            val_size = 0;
+        }
+
+    private:
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid bucket_queue size");
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::out_of_range("bucket_queue key is outside [last popped, last popped + span]");
+        }
+    };
+}
+
+#endif // !OCT_BUCKET_QUEUE
\ No newline at end of file
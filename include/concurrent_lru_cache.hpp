@@ -0,0 +1,186 @@
+#pragma once
+
+#ifndef OCT_CONCURRENT_LRU_CACHE
+#define OCT_CONCURRENT_LRU_CACHE
+
+#include <mutex>
+#include <new>
+#include "lru_cache.hpp"
+
+namespace oct {
+    /*
+    * characteristics:
+    * [sharded] 按哈希值高位分片, 每片一把锁与一个独立的lru_cache, 淘汰顺序只在片内成立
+    * 总容量按片数均分, 余数分给前几片, 各片容量之和恰为capacity(); 命中与淘汰统计为各片之和
+    */
+    template <
+        typename Key,
+        typename Ty,
+        class Hash         = std::hash<Key>,
+        class KeyEqual     = equal_to<Key>,
+        typename Allocator = allocator<Ty>,
+        class Admission    = lru_admission
+    >
+    class concurrent_lru_cache {
+    private:    //内部类
+        using Cache = lru_cache<Key, Ty, Hash, KeyEqual, Allocator, Admission>;
+
+        struct alignas(64) Shard {
+            std::mutex lock;
+            Cache cache;
+
+            Shard(size_t capacity, const Hash& hash, const KeyEqual& equal, const Allocator& alloc)
+                : cache(capacity, hash, equal, alloc) {}
+        };
+
+    public:     //统一接口
+        using key_type       = Key;
+        using mapped_type    = Ty;
+        using size_type      = size_t;
+        using hasher         = Hash;
+        using key_equal      = KeyEqual;
+        using allocator_type = Allocator;
+        using admission_type = Admission;
+
+    private:    //成员变量
+        Shard* shards;
+        size_t shard_count;         //2的幂
+        unsigned shard_shift;       //哈希值右移shard_shift位得到片号
+        size_type val_capacity;
+        hasher hash;
+
+    public:     //成员函数
+        //片数不超过容量, 保证每片至少容纳一个元素
+        explicit concurrent_lru_cache(size_type capacity, size_type concurrency_level = 16,
+            const hasher& hash = hasher(), const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : shards(nullptr), shard_count(1), shard_shift(sizeof(size_t) * 8), val_capacity(capacity), hash(hash) {
+            while (shard_count < concurrency_level && shard_count * 2 <= capacity) {
+                shard_count <<= 1;
+                shard_shift--;
+            }
+            size_type per_shard = capacity / shard_count, extra = capacity % shard_count;
+            shards = static_cast<Shard*>(::operator new(sizeof(Shard) * shard_count, std::align_val_t(alignof(Shard))));
+            size_t i = 0;
+            try {
+                for (; i < shard_count; i++)
+                    ::new (static_cast<void*>(shards + i)) Shard(per_shard + (i < extra), hash, equal, alloc);
+            }
+            catch (...) {
+                while (i--)
+                    shards[i].~Shard();
+                ::operator delete(shards, std::align_val_t(alignof(Shard)));
+                throw;
+            }
+        }
+
+        concurrent_lru_cache(const concurrent_lru_cache&)            = delete;
+        concurrent_lru_cache& operator=(const concurrent_lru_cache&) = delete;
+
+        ~concurrent_lru_cache() {
+            for (size_t i = 0; i < shard_count; i++)
+                shards[i].~Shard();
+            ::operator delete(shards, std::align_val_t(alignof(Shard)));
+        }
+
+        //命中时把值复制到out
+        bool get(const key_type& key, mapped_type& out) {
+            return visit(key, [&out](mapped_type& value) { out = value; });
+        }
+
+        //命中时在片锁内以mapped_type&调用func, 引用在func返回后不可再使用
+        template <typename Func>
+        bool visit(const key_type& key, Func&& func) {
+            Shard& shard = Shard_of(key);
+            std::lock_guard<std::mutex> lock(shard.lock);
+            mapped_type* value = shard.cache.get(key);
+            if (!value)
+                return false;
+            func(*value);
+            return true;
+        }
+
+        //不改变访问顺序
+        bool contains(const key_type& key) const {
+            Shard& shard = Shard_of(key);
+            std::lock_guard<std::mutex> lock(shard.lock);
+            return shard.cache.contains(key);
+        }
+
+        template <typename Mref>
+        void put(const key_type& key, Mref&& value) {
+            Shard& shard = Shard_of(key);
+            std::lock_guard<std::mutex> lock(shard.lock);
+            shard.cache.put(key, std::forward<Mref>(value));
+        }
+
+        bool erase(const key_type& key) {
+            Shard& shard = Shard_of(key);
+            std::lock_guard<std::mutex> lock(shard.lock);
+            return shard.cache.erase(key);
+        }
+
+        void clear() {
+            for (size_t i = 0; i < shard_count; i++) {
+                std::lock_guard<std::mutex> lock(shards[i].lock);
+                shards[i].cache.clear();
+            }
+        }
+
+        //以下统计逐片加锁求和, 并发修改时只是近似值
+        size_type size() const {
+            return Sum(&Cache::size);
+        }
+
+        bool empty() const {
+            return !size();
+        }
+
+        size_type capacity() const noexcept {
+            return val_capacity;
+        }
+
+        size_type concurrency_level() const noexcept {
+            return shard_count;
+        }
+
+        size_type hits() const {
+            return Sum(&Cache::hits);
+        }
+
+        size_type misses() const {
+            return Sum(&Cache::misses);
+        }
+
+        size_type evictions() const {
+            return Sum(&Cache::evictions);
+        }
+
+        double hit_ratio() const {
+            size_type hit = hits(), total = hit + misses();
+            return total ? static_cast<double>(hit) / total : 0.0;
+        }
+
+        void reset_stats() {
+            for (size_t i = 0; i < shard_count; i++) {
+                std::lock_guard<std::mutex> lock(shards[i].lock);
+                shards[i].cache.reset_stats();
+            }
+        }
+
+    private:
+        Shard& Shard_of(const key_type& key) const {
+            return shards[shard_count == 1 ? 0 : hash_mix(hash(key)) >> shard_shift];
+        }
+
+        size_type Sum(size_type (Cache::* stat)() const noexcept) const {
+            size_type sum = 0;
+            for (size_t i = 0; i < shard_count; i++) {
+                std::lock_guard<std::mutex> lock(shards[i].lock);
+                sum += (shards[i].cache.*stat)();
+            }
+            return sum;
+        }
+    };
+}
+
+#endif // !OCT_CONCURRENT_LRU_CACHE
\ No newline at end of file
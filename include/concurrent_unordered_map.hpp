@@ -0,0 +1,606 @@
+#pragma once
+
+#ifndef OCT_CONCURRENT_UNORDERED_MAP
+#define OCT_CONCURRENT_UNORDERED_MAP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include "utility.hpp"
+#include "vector.hpp"
+
+namespace oct {
+    //基于纪元的内存回收: 读者进入临界区时登记当前纪元, 写者摘下的节点记下摘除时的纪元e
+    //全局纪元只在所有活跃读者都已登记到当前纪元时才前进, 因此全局纪元到达e + 2时已没有读者能看到该节点
+    class epoch_domain {
+    private:
+        struct record {
+            std::atomic<uint64_t> state{ 0 };       //(登记的纪元 << 1) | 是否在临界区内
+            std::atomic<bool> in_use{ true };
+            record* next = nullptr;
+            unsigned depth = 0;                     //同一线程的嵌套临界区只在最外层登记
+            unsigned leaves = 0;                    //离开最外层临界区的次数
+        };
+
+        struct record_holder {
+            record* rec = nullptr;
+
+            ~record_holder() {
+                if (rec)
+                    rec->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        std::atomic<uint64_t> global{ 0 };
+        std::atomic<record*> records{ nullptr };    //线程退出后记录留给后来的线程复用, 从不释放
+
+        static constexpr unsigned advance_interval = 64;
+
+        epoch_domain() = default;
+
+    public:
+        epoch_domain(const epoch_domain&)            = delete;
+        epoch_domain& operator=(const epoch_domain&) = delete;
+
+        static epoch_domain& Instance() {
+            static epoch_domain domain;
+            return domain;
+        }
+
+        void Enter() {
+            record* rec = Local();
+            if (rec->depth++)
+                return;
+            rec->state.store((global.load(std::memory_order_relaxed) << 1) | 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        void Leave() {
+            record* rec = Local();
+            if (--rec->depth)
+                return;
+            rec->state.store(0, std::memory_order_release);
+            if (++rec->leaves % advance_interval == 0)     //读者也推进全局纪元, 只有读操作时摘下的节点同样能回收
+                Try_advance();
+        }
+
+        uint64_t Epoch() const noexcept {
+            return global.load(std::memory_order_seq_cst);
+        }
+
+        //有活跃读者仍停留在旧纪元时不前进
+        void Try_advance() {
+            uint64_t epoch = global.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            for (record* rec = records.load(std::memory_order_acquire); rec; rec = rec->next) {
+                uint64_t state = rec->state.load(std::memory_order_relaxed);
+                if ((state & 1) && (state >> 1) != epoch)
+                    return;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            global.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+        }
+
+        bool Is_safe(uint64_t retired_epoch) const noexcept {
+            return retired_epoch + 2 <= Epoch();
+        }
+
+    private:
+        record* Local() {
+            static thread_local record_holder holder;
+            if (!holder.rec)
+                holder.rec = Acquire_record();
+            return holder.rec;
+        }
+
+        record* Acquire_record() {
+            for (record* rec = records.load(std::memory_order_acquire); rec; rec = rec->next) {
+                bool expected = false;
+                if (rec->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                    return rec;
+            }
+            record* rec = new record;
+            record* head = records.load(std::memory_order_relaxed);
+            do {
+                rec->next = head;
+            } while (!records.compare_exchange_weak(head, rec, std::memory_order_release, std::memory_order_relaxed));
+            return rec;
+        }
+    };
+
+    class epoch_guard {
+    public:
+        epoch_guard() {
+            epoch_domain::Instance().Enter();
+        }
+
+        ~epoch_guard() {
+            epoch_domain::Instance().Leave();
+        }
+
+        epoch_guard(const epoch_guard&)            = delete;
+        epoch_guard& operator=(const epoch_guard&) = delete;
+    };
+
+    template <typename Ty>
+    struct concurrent_hash_node {
+        using value_type = Ty;
+
+        using Nodeptr = concurrent_hash_node*;
+
+        std::atomic<Nodeptr> next;
+        size_t hash;
+        value_type val;             //发布后不再修改, insert_or_assign以新节点整体替换
+
+        template <typename... Args>
+        concurrent_hash_node(size_t hash, Args&&... args)
+            : next(nullptr), hash(hash), val(std::forward<Args>(args)...) {}
+    };
+
+    /*
+    * characteristics:
+    * [striped lock] 按哈希值高位分段, 每段一把锁与一张独立的拉链表, 不同段的写操作互不阻塞
+    * [lock-free read] find/visit/contains不加锁, 在纪元临界区内沿原子指针读取
+    * [incremental resize] 扩容只涉及单个段: 持有该段的锁把原有节点重新链接到两倍大的新桶表后原子地发布, 不复制元素,
+    *                      其余段的读写照常进行; 扩容期间段版本号为奇数, 因此未命中的读者会重试
+    * [epoch reclamation] 被摘下的节点与旧桶数组在所有可能的读者离开后才释放, 读者也会推进纪元并顺带回收
+    * 分配器会被多个线程同时调用, 必须是线程安全的
+    */
+    template <
+        typename Key,
+        typename Ty,
+        class Hash         = std::hash<Key>,
+        class KeyEqual     = equal_to<Key>,
+        typename Allocator = allocator<Ty>
+    >
+    class concurrent_unordered_map {
+    private:    //内部类与内部配置器
+        using Node          = concurrent_hash_node<pair<Key, Ty>>;
+        using Alnode        = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+        using Bucket        = std::atomic<Nodeptr>;
+        using Albucket      = rebind_alloc_t<Allocator, Bucket>;
+
+        struct Table {
+            size_t mask;            //桶数减一
+            Bucket* buckets;
+        };
+
+        using Altable = rebind_alloc_t<Allocator, Table>;
+
+        struct alignas(64) Segment {
+            std::mutex lock;
+            std::atomic<Table*> table{ nullptr };
+            std::atomic<size_t> count{ 0 };
+            std::atomic<size_t> version{ 0 };                   //重新链接节点期间为奇数
+            std::atomic<uint64_t> safe_epoch{ no_epoch };       //最早摘下的节点或桶数组可以释放的纪元
+            vector<pair<Nodeptr, uint64_t>> retired_nodes;      //只在持有lock时访问
+            vector<pair<Table*, uint64_t>> retired_tables;
+        };
+
+        static constexpr size_t min_bucket_count = 8;
+        static constexpr size_t reclaim_threshold = 64;
+        static constexpr uint64_t no_epoch = static_cast<uint64_t>(-1);
+
+    public:     //统一接口
+        static_assert(std::is_object_v<Ty>, "concurrent_unordered_map requires object types");
+
+        using key_type        = Key;
+        using mapped_type     = Ty;
+        using value_type      = pair<Key, Ty>;
+        using size_type       = size_t;
+        using hasher          = Hash;
+        using key_equal       = KeyEqual;
+        using allocator_type  = Allocator;
+
+    private:    //成员变量
+        Segment* segments;
+        size_t segment_count;       //2的幂
+        unsigned segment_shift;     //哈希值右移segment_shift位得到段号
+        mutable compressed_pair<hasher, compressed_pair<key_equal, Alnode>> val_pack;
+
+    public:     //成员函数
+        explicit concurrent_unordered_map(size_type bucket_count = 0, size_type concurrency_level = 64,
+            const hasher& hash = hasher(), const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : segments(nullptr), segment_count(1), segment_shift(sizeof(size_t) * 8), val_pack(hash, equal, alloc) {
+            while (segment_count < concurrency_level) {
+                segment_count <<= 1;
+                segment_shift--;
+            }
+            size_t per_segment = min_bucket_count;
+            while (per_segment * segment_count < bucket_count)
+                per_segment <<= 1;
+            segments = new Segment[segment_count];
+            size_t i = 0;
+            try {
+                for (; i < segment_count; i++)
+                    segments[i].table.store(Allocate_table(per_segment), std::memory_order_relaxed);
+            }
+            catch (...) {
+                while (i--)
+                    Deallocate_table(segments[i].table.load(std::memory_order_relaxed));
+                delete[] segments;
+                throw;
+            }
+        }
+
+        concurrent_unordered_map(std::initializer_list<value_type> ini_list)
+            : concurrent_unordered_map(ini_list.size()) {
+            for (const value_type& elem : ini_list)
+                insert(elem.first, elem.second);
+        }
+
+        concurrent_unordered_map(const concurrent_unordered_map&)            = delete;
+        concurrent_unordered_map& operator=(const concurrent_unordered_map&) = delete;
+
+        //析构时不能再有其他线程访问
+        ~concurrent_unordered_map() {
+            for (size_t i = 0; i < segment_count; i++) {
+                Segment& seg = segments[i];
+                Table* table = seg.table.load(std::memory_order_relaxed);
+                Free_chains(table);
+                Deallocate_table(table);
+                Reclaim(seg, true);
+            }
+            delete[] segments;
+        }
+
+        allocator_type get_allocator() const noexcept {
+            return val_pack.second.second;
+        }
+
+        hasher hash_function() const {
+            return val_pack.get_first();
+        }
+
+        key_equal key_eq() const {
+            return val_pack.second.get_first();
+        }
+
+        //各段计数之和, 并发修改时只是近似值
+        size_type size() const noexcept {
+            size_t sum = 0;
+            for (size_t i = 0; i < segment_count; i++)
+                sum += segments[i].count.load(std::memory_order_relaxed);
+            return sum;
+        }
+
+        bool empty() const noexcept {
+            return !size();
+        }
+
+        size_type concurrency_level() const noexcept {
+            return segment_count;
+        }
+
+        //找到时把值复制到out
+        bool find(const key_type& key, mapped_type& out) const {
+            return visit(key, [&out](const value_type& elem) { out = elem.second; });
+        }
+
+        bool contains(const key_type& key) const {
+            return visit(key, [](const value_type&) {});
+        }
+
+        size_type count(const key_type& key) const {
+            return contains(key);
+        }
+
+        //在读临界区内以const value_type&调用func, 引用在func返回后不可再使用
+        template <typename Func>
+        bool visit(const key_type& key, Func&& func) const {
+            size_t hash = Hash_of(key);
+            Segment& seg = Segment_of(hash);
+            bool found = Visit(seg, hash, key, func);
+            Reclaim_on_read(seg);
+            return found;
+        }
+
+        //关键字已存在时不做修改, 返回false
+        template <typename Mref>
+        bool insert(const key_type& key, Mref&& value) {
+            return Emplace_unique(key, std::forward<Mref>(value));
+        }
+
+        bool insert(const value_type& target) {
+            return Emplace_unique(target.first, target.second);
+        }
+
+        template <typename... Args>
+        bool try_emplace(const key_type& key, Args&&... args) {
+            return Emplace_unique(key, std::forward<Args>(args)...);
+        }
+
+        //关键字已存在时以新节点替换旧节点, 正在读旧值的线程不受影响; 新插入时返回true
+        template <typename Mref>
+        bool insert_or_assign(const key_type& key, Mref&& value) {
+            size_t hash = Hash_of(key);
+            Segment& seg = Segment_of(hash);
+            std::lock_guard<std::mutex> lock(seg.lock);
+            Bucket* link = Find_link(seg, key, hash);
+            Nodeptr old = link->load(std::memory_order_relaxed);
+            if (!old)
+                return Link_new(seg, link, hash, key, std::forward<Mref>(value));
+            Nodeptr node = Construct_node(hash, std::piecewise_construct,
+                std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Mref>(value)));
+            node->next.store(old->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            link->store(node, std::memory_order_release);
+            Retire(seg, old);
+            return false;
+        }
+
+        size_type erase(const key_type& key) {
+            size_t hash = Hash_of(key);
+            Segment& seg = Segment_of(hash);
+            std::lock_guard<std::mutex> lock(seg.lock);
+            Bucket* link = Find_link(seg, key, hash);
+            Nodeptr old = link->load(std::memory_order_relaxed);
+            if (!old)
+                return 0;
+            link->store(old->next.load(std::memory_order_relaxed), std::memory_order_release);
+            seg.count.fetch_sub(1, std::memory_order_relaxed);
+            Retire(seg, old);
+            return 1;
+        }
+
+        //逐段清空, 每段换上一张空桶表
+        void clear() {
+            for (size_t i = 0; i < segment_count; i++) {
+                Segment& seg = segments[i];
+                std::lock_guard<std::mutex> lock(seg.lock);
+                Table* old = seg.table.load(std::memory_order_relaxed);
+                seg.table.store(Allocate_table(min_bucket_count), std::memory_order_release);
+                seg.count.store(0, std::memory_order_relaxed);
+                Retire_chains(seg, old);
+                Retire_table(seg, old);
+            }
+        }
+
+        //依次遍历每个段, 不保证看到遍历期间其他线程的修改
+        //每段先收集节点, 收集期间该段扩容则重新收集, 因此不会因节点被重新链接而遗漏或重复访问
+        template <typename Func>
+        void for_each(Func&& func) const {
+            epoch_guard guard;
+            vector<Nodeptr> nodes;
+            for (size_t i = 0; i < segment_count; i++) {
+                Segment& seg = segments[i];
+                size_t version;
+                do {
+                    nodes.clear();
+                    version = seg.version.load(std::memory_order_acquire);
+                    Table* table = seg.table.load(std::memory_order_acquire);
+                    for (size_t b = 0; b <= table->mask; b++)
+                        for (Nodeptr node = table->buckets[b].load(std::memory_order_acquire);
+                            node; node = node->next.load(std::memory_order_acquire))
+                            nodes.push_back(node);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                } while ((version & 1) || seg.version.load(std::memory_order_relaxed) != version);
+                for (Nodeptr node : nodes)
+                    func(static_cast<const value_type&>(node->val));
+            }
+        }
+
+    private:    //内部函数
+        size_t Hash_of(const key_type& key) const {
+            return hash_mix(val_pack.get_first()(key));
+        }
+
+        //段号取哈希值高位, 段内桶号取低位, 两者互不相关
+        Segment& Segment_of(size_t hash) const {
+            return segments[segment_count == 1 ? 0 : hash >> segment_shift];
+        }
+
+        //找到即可返回; 未命中时若遍历期间该段在重新链接节点, 沿途可能被带进别的桶而漏掉目标, 需重试
+        template <typename Func>
+        bool Visit(Segment& seg, size_t hash, const key_type& key, Func& func) const {
+            epoch_guard guard;
+            key_equal& kequal = val_pack.second.get_first();
+            while (true) {
+                size_t version = seg.version.load(std::memory_order_acquire);
+                Table* table = seg.table.load(std::memory_order_acquire);
+                for (Nodeptr node = table->buckets[hash & table->mask].load(std::memory_order_acquire);
+                    node; node = node->next.load(std::memory_order_acquire)) {
+                    if (node->hash == hash && kequal(node->val.first, key)) {
+                        func(static_cast<const value_type&>(node->val));
+                        return true;
+                    }
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (!(version & 1) && seg.version.load(std::memory_order_relaxed) == version)
+                    return false;
+            }
+        }
+
+        //持有段锁时调用; 返回指向目标节点的链接, 不存在时返回桶链表末尾的空链接
+        Bucket* Find_link(Segment& seg, const key_type& key, size_t hash) const {
+            Table* table = seg.table.load(std::memory_order_relaxed);
+            key_equal& kequal = val_pack.second.get_first();
+            Bucket* link = &table->buckets[hash & table->mask];
+            for (Nodeptr node = link->load(std::memory_order_relaxed); node; node = link->load(std::memory_order_relaxed)) {
+                if (node->hash == hash && kequal(node->val.first, key))
+                    return link;
+                link = &node->next;
+            }
+            return link;
+        }
+
+        template <typename... Args>
+        bool Emplace_unique(const key_type& key, Args&&... args) {
+            size_t hash = Hash_of(key);
+            Segment& seg = Segment_of(hash);
+            std::lock_guard<std::mutex> lock(seg.lock);
+            Bucket* link = Find_link(seg, key, hash);
+            if (link->load(std::memory_order_relaxed))
+                return false;
+            return Link_new(seg, link, hash, key, std::forward<Args>(args)...);
+        }
+
+        //新节点接在链表末尾的空链接上, 读者要么看不到它要么看到完整构造的节点
+        template <typename... Args>
+        bool Link_new(Segment& seg, Bucket* link, size_t hash, const key_type& key, Args&&... args) {
+            Nodeptr node = Construct_node(hash, std::piecewise_construct,
+                std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            link->store(node, std::memory_order_release);
+            size_t count = seg.count.fetch_add(1, std::memory_order_relaxed) + 1;
+            Table* table = seg.table.load(std::memory_order_relaxed);
+            if (count > table->mask + 1)
+                Grow(seg, table);
+            return true;
+        }
+
+        //原有节点直接重新链接到新桶表, 只有旧桶数组需要延迟回收
+        //沿旧链表前进的读者可能被改动的next带进别的桶, 它们不会访问到已释放的内存, 未命中时按版本号重试即可
+        void Grow(Segment& seg, Table* old) {
+            Table* table;
+            try {
+                table = Allocate_table((old->mask + 1) * 2);
+            }
+            catch (...) {       //分配失败时保持旧表, 只是负载偏高
+                return;
+            }
+            size_t version = seg.version.load(std::memory_order_relaxed);
+            seg.version.store(version + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t b = 0; b <= old->mask; b++) {
+                Nodeptr node = old->buckets[b].load(std::memory_order_relaxed);
+                while (node) {
+                    Nodeptr next = node->next.load(std::memory_order_relaxed);
+                    Bucket& bucket = table->buckets[node->hash & table->mask];
+                    node->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    bucket.store(node, std::memory_order_relaxed);
+                    node = next;
+                }
+            }
+            seg.table.store(table, std::memory_order_release);
+            seg.version.store(version + 2, std::memory_order_release);
+            Retire_table(seg, old);
+        }
+
+        void Retire(Segment& seg, Nodeptr node) {
+            uint64_t epoch = epoch_domain::Instance().Epoch();
+            seg.retired_nodes.push_back(pair<Nodeptr, uint64_t>(node, epoch));
+            Mark_retired(seg, epoch);
+            if (seg.retired_nodes.size() >= reclaim_threshold)
+                Reclaim(seg, false);
+        }
+
+        //clear换下的桶表上的节点随桶表一并回收
+        void Retire_chains(Segment& seg, Table* table) {
+            uint64_t epoch = epoch_domain::Instance().Epoch();
+            for (size_t b = 0; b <= table->mask; b++)
+                for (Nodeptr node = table->buckets[b].load(std::memory_order_relaxed);
+                    node; node = node->next.load(std::memory_order_relaxed))
+                    seg.retired_nodes.push_back(pair<Nodeptr, uint64_t>(node, epoch));
+        }
+
+        void Retire_table(Segment& seg, Table* table) {
+            uint64_t epoch = epoch_domain::Instance().Epoch();
+            seg.retired_tables.push_back(pair<Table*, uint64_t>(table, epoch));
+            Mark_retired(seg, epoch);
+            Reclaim(seg, false);
+        }
+
+        //摘除纪元单调不减, 只需记下最早的一个
+        void Mark_retired(Segment& seg, uint64_t epoch) const {
+            if (seg.safe_epoch.load(std::memory_order_relaxed) == no_epoch)
+                seg.safe_epoch.store(epoch + 2, std::memory_order_relaxed);
+        }
+
+        //读者发现段中已有可释放的内存且能立即拿到段锁时顺带回收, 写操作停止后内存也能归还
+        void Reclaim_on_read(Segment& seg) const {
+            if (epoch_domain::Instance().Epoch() < seg.safe_epoch.load(std::memory_order_relaxed))
+                return;
+            std::unique_lock<std::mutex> lock(seg.lock, std::try_to_lock);
+            if (lock.owns_lock())
+                Reclaim(seg, false);
+        }
+
+        //释放已无读者可见的节点与桶表; force为true时(析构)全部释放
+        void Reclaim(Segment& seg, bool force) const {
+            epoch_domain& domain = epoch_domain::Instance();
+            if (!force)
+                domain.Try_advance();
+            size_t kept = 0;
+            for (size_t i = 0; i < seg.retired_nodes.size(); i++) {
+                if (force || domain.Is_safe(seg.retired_nodes[i].second))
+                    Destroy_node(seg.retired_nodes[i].first);
+                else
+                    seg.retired_nodes[kept++] = seg.retired_nodes[i];
+            }
+            seg.retired_nodes.resize(kept);
+            kept = 0;
+            for (size_t i = 0; i < seg.retired_tables.size(); i++) {
+                if (force || domain.Is_safe(seg.retired_tables[i].second))
+                    Deallocate_table(seg.retired_tables[i].first);
+                else
+                    seg.retired_tables[kept++] = seg.retired_tables[i];
+            }
+            seg.retired_tables.resize(kept);
+            uint64_t safe = no_epoch;
+            if (!seg.retired_nodes.empty())
+                safe = seg.retired_nodes[0].second + 2;
+            if (!seg.retired_tables.empty() && seg.retired_tables[0].second + 2 < safe)
+                safe = seg.retired_tables[0].second + 2;
+            seg.safe_epoch.store(safe, std::memory_order_relaxed);
+        }
+
+        template <typename... Args>
+        Nodeptr Construct_node(size_t hash, Args&&... args) {
+            Alnode& alloc = val_pack.second.second;
+            Nodeptr node = Alnode_traits::allocate(alloc, 1);
+            try {
+                Alnode_traits::construct(alloc, node, hash, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Alnode_traits::deallocate(alloc, node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        void Destroy_node(Nodeptr node) const {
+            Alnode& alloc = val_pack.second.second;
+            Alnode_traits::destroy(alloc, node);
+            Alnode_traits::deallocate(alloc, node, 1);
+        }
+
+        void Free_chains(Table* table) {
+            for (size_t b = 0; b <= table->mask; b++) {
+                Nodeptr node = table->buckets[b].load(std::memory_order_relaxed);
+                while (node) {
+                    Nodeptr next = node->next.load(std::memory_order_relaxed);
+                    Destroy_node(node);
+                    node = next;
+                }
+            }
+        }
+
+        Table* Allocate_table(size_t bucket_count) {
+            Altable altable(val_pack.second.second);
+            Albucket albucket(val_pack.second.second);
+            Table* table = std::allocator_traits<Altable>::allocate(altable, 1);
+            try {
+                table->buckets = std::allocator_traits<Albucket>::allocate(albucket, bucket_count);
+            }
+            catch (...) {
+                std::allocator_traits<Altable>::deallocate(altable, table, 1);
+                throw;
+            }
+            table->mask = bucket_count - 1;
+            for (size_t b = 0; b < bucket_count; b++)
+                ::new (static_cast<void*>(table->buckets + b)) Bucket(nullptr);
+            return table;
+        }
+
+        void Deallocate_table(Table* table) const {
+            Altable altable(val_pack.second.second);
+            Albucket albucket(val_pack.second.second);
+            std::allocator_traits<Albucket>::deallocate(albucket, table->buckets, table->mask + 1);
+            std::allocator_traits<Altable>::deallocate(altable, table, 1);
+        }
+    };
+}
+
+#endif // !OCT_CONCURRENT_UNORDERED_MAP
\ No newline at end of file
@@ -0,0 +1,466 @@
+#pragma once
+
+#ifndef OCT_FLAT_MAP
+#define OCT_FLAT_MAP
+
+#include <algorithm>
+#include "vector.hpp"
+
+namespace oct {
+/*
+* characteristics:
+* [sorted_vector]
+* [split_key_value]
+* [branchless_search]
+* [EBO]
+*/
+    template <typename Map>
+    struct flat_map_val {
+        using key_container_type    = typename Map::key_container_type;
+        using mapped_container_type = typename Map::mapped_container_type;
+
+        key_container_type    keys;     //关键字单独连续存放, 查找只触及这一个数组
+        mapped_container_type values;   //values[i]是keys[i]对应的值
+    };
+
+#define OCT_FLAT_MAP_VAL_PACK_UNWRAP key_container_type&    keys   = val_pack.second.keys;   \
+                                     mapped_container_type& values = val_pack.second.values; \
+                                     key_compare&           comp   = val_pack.get_first();
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare = less<Key>,
+        typename KeyContainer = vector<Key>,
+        typename MappedContainer = vector<Ty>
+    >
+    class flat_map {
+    public:
+        static_assert(std::is_object_v<Ty>, "flat_map requires object types");
+
+        using key_type              = Key;
+        using mapped_type           = Ty;
+        using value_type            = pair<Key, Ty>;
+        using key_compare           = Compare;
+        using size_type             = size_t;
+        using difference_type       = ptrdiff_t;
+        using reference             = pair<const Key&, Ty&>;
+        using const_reference       = pair<const Key&, const Ty&>;
+        using key_container_type    = KeyContainer;
+        using mapped_container_type = MappedContainer;
+        using iterator              = flat_map_iterator<flat_map>;
+
+    private:
+        friend iterator;
+
+        mutable compressed_pair<key_compare, flat_map_val<flat_map>> val_pack;
+
+    public:
+        flat_map() : val_pack(key_compare()) {}
+
+        explicit flat_map(const key_compare& comp)
+            : val_pack(comp) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        flat_map(ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : val_pack(comp) {
+            insert(begin, end);
+        }
+
+        //输入已按关键字严格升序, 逐个追加到预留好的数组末尾, 不排序也不查找
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        flat_map(sorted_unique_t, ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : val_pack(comp) {
+            key_container_type& keys = val_pack.second.keys;
+            mapped_container_type& values = val_pack.second.values;
+            size_type count = std::distance(begin, end);
+            keys.reserve(count);
+            values.reserve(count);
+            for (; begin != end; ++begin) {
+                keys.emplace_back((*begin).first);
+                values.emplace_back((*begin).second);
+            }
+        }
+
+        //直接接管两个已排好序的数组
+        flat_map(sorted_unique_t, key_container_type&& key_cont, mapped_container_type&& mapped_cont,
+            const key_compare& comp = key_compare())
+            : val_pack(comp) {
+            if (key_cont.size() != mapped_cont.size())
+                Size_error();
+            val_pack.second.keys.swap(key_cont);
+            val_pack.second.values.swap(mapped_cont);
+        }
+
+        flat_map(std::initializer_list<value_type> ini_list, const key_compare& comp = key_compare())
+            : flat_map(ini_list.begin(), ini_list.end(), comp) {}
+
+        //val_pack为mutable, 不能依赖默认拷贝构造(会匹配到compressed_pair的转发构造函数)
+        flat_map(const flat_map& another)
+            : val_pack(another.val_pack.get_first(), another.val_pack.second) {}
+
+        flat_map(flat_map&& another) noexcept
+            : val_pack(another.val_pack.get_first(), std::move(another.val_pack.second)) {}
+
+        flat_map& operator=(const flat_map&) = default;
+        flat_map& operator=(flat_map&&)      = default;
+
+        ~flat_map() {}
+
+        const key_container_type& keys() const noexcept {
+            return val_pack.second.keys;
+        }
+
+        const mapped_container_type& values() const noexcept {
+            return val_pack.second.values;
+        }
+
+        Ty& at(const key_type& key) {
+            iterator it = find(key);
+            if (it == end())
+                Key_error();
+            return (*it).second;
+        }
+
+        const Ty& at(const key_type& key) const {
+            iterator it = find(key);
+            if (it == end())
+                Key_error();
+            return (*it).second;
+        }
+
+        Ty& operator[](const key_type& key) {
+            return val_pack.second.values[Try_emplace(key).first];
+        }
+
+        Ty& operator[](key_type&& key) {
+            return val_pack.second.values[Try_emplace(std::move(key)).first];
+        }
+
+        iterator begin() const noexcept {
+            return Make_iter(0);
+        }
+
+        iterator end() const noexcept {
+            return Make_iter(size());
+        }
+
+        bool empty() const noexcept {
+            return !size();
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.keys.size();
+        }
+
+        size_type capacity() const noexcept {
+            return val_pack.second.keys.capacity();
+        }
+
+        void reserve(size_type count) {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            keys.reserve(count);
+            values.reserve(count);
+        }
+
+        //vector按倍增扩容, 构造完毕后调用可把两个数组的多余容量全部归还
+        void shrink_to_fit() {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            Shrink(keys);
+            Shrink(values);
+        }
+
+        void clear() {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            keys.clear();
+            values.clear();
+        }
+
+        pair<iterator, bool> insert(const value_type& target) {
+            return try_emplace(target.first, target.second);
+        }
+
+        pair<iterator, bool> insert(value_type&& target) {
+            return try_emplace(std::move(target.first), std::move(target.second));
+        }
+
+        template <typename... Args>
+        pair<iterator, bool> emplace(Args&&... args) {
+            return insert(value_type(std::forward<Args>(args)...));
+        }
+
+        //关键字已存在时什么也不做, args不会被移走; 否则以key和args原位构造元素
+        template <typename... Args>
+        pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+            pair<size_type, bool> res = Try_emplace(key, std::forward<Args>(args)...);
+            return pair<iterator, bool>(Make_iter(res.first), res.second);
+        }
+
+        template <typename... Args>
+        pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+            pair<size_type, bool> res = Try_emplace(std::move(key), std::forward<Args>(args)...);
+            return pair<iterator, bool>(Make_iter(res.first), res.second);
+        }
+
+        template <typename Mref>
+        pair<iterator, bool> insert_or_assign(const key_type& key, Mref&& value) {
+            pair<size_type, bool> res = Try_emplace(key, std::forward<Mref>(value));
+            if (!res.second)
+                val_pack.second.values[res.first] = std::forward<Mref>(value);
+            return pair<iterator, bool>(Make_iter(res.first), res.second);
+        }
+
+        template <typename Mref>
+        pair<iterator, bool> insert_or_assign(key_type&& key, Mref&& value) {
+            pair<size_type, bool> res = Try_emplace(std::move(key), std::forward<Mref>(value));
+            if (!res.second)
+                val_pack.second.values[res.first] = std::forward<Mref>(value);
+            return pair<iterator, bool>(Make_iter(res.first), res.second);
+        }
+
+        //hint恰好是插入位置时省去二分查找, 按升序逐个插入时每次都命中
+        iterator insert(iterator hint, const value_type& target) {
+            return Insert_hint(hint, value_type(target));
+        }
+
+        iterator insert(iterator hint, value_type&& target) {
+            return Insert_hint(hint, std::move(target));
+        }
+
+        template <typename... Args>
+        iterator emplace_hint(iterator hint, Args&&... args) {
+            return Insert_hint(hint, value_type(std::forward<Args>(args)...));
+        }
+
+        //整批插入: 新元素稳定排序去重后与原有元素归并, 关键字重复时保留先出现的, 与逐个insert结果一致
+        //新数组在旁边建好后才换入, 中途抛出异常时原内容不变
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void insert(ForwardIt begin, ForwardIt end) {
+            vector<value_type> temp;
+            temp.reserve(std::distance(begin, end));
+            for (; begin != end; ++begin)
+                temp.emplace_back((*begin).first, (*begin).second);
+            Merge_sorted(temp);
+        }
+
+        void insert(std::initializer_list<value_type> ini_list) {
+            insert(ini_list.begin(), ini_list.end());
+        }
+
+        iterator erase(iterator pos) {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            difference_type index = pos - begin();
+            keys.erase(keys.begin() + index);
+            values.erase(values.begin() + index);
+            return Make_iter(index);
+        }
+
+        iterator erase(iterator begin, iterator end) {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            difference_type first = begin - this->begin();
+            difference_type last = end - this->begin();
+            keys.erase(keys.begin() + first, keys.begin() + last);
+            values.erase(values.begin() + first, values.begin() + last);
+            return Make_iter(first);
+        }
+
+        template <typename Ref>
+        size_type erase(Ref&& key) {
+            iterator it = find(std::forward<Ref>(key));
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        void swap(flat_map& another) noexcept {
+            std::swap(val_pack.get_first(), another.val_pack.get_first());
+            val_pack.second.keys.swap(another.val_pack.second.keys);
+            val_pack.second.values.swap(another.val_pack.second.values);
+        }
+
+        template <typename Ref>
+        size_type count(Ref&& key) const {
+            return find(std::forward<Ref>(key)) != end();
+        }
+
+        template <typename Ref>
+        iterator find(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            size_type index = Lower_index(k);
+            if (index == size() || val_pack.get_first()(k, val_pack.second.keys[index]))
+                return end();
+            return Make_iter(index);
+        }
+
+        //关键字不重复, 相等区间至多一个元素, 只需一次二分
+        template <typename Ref>
+        pair<iterator, iterator> equal_range(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            size_type index = Lower_index(k);
+            size_type last = index + (index != size() && !val_pack.get_first()(k, val_pack.second.keys[index]));
+            return pair<iterator, iterator>(Make_iter(index), Make_iter(last));
+        }
+
+        template <typename Ref>
+        iterator lower_bound(Ref&& key) const {
+            return Make_iter(Lower_index(lookup_key<key_type, key_compare>(std::forward<Ref>(key))));
+        }
+
+        template <typename Ref>
+        iterator upper_bound(Ref&& key) const {
+            return Make_iter(Upper_index(lookup_key<key_type, key_compare>(std::forward<Ref>(key))));
+        }
+
+        key_compare key_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+    private:
+        iterator Make_iter(size_type index) const noexcept {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            return iterator(keys.data() + index, values.data() + index);
+        }
+
+        template <typename Kref>
+        size_type Lower_index(const Kref& key) const {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            return branchless_lower_bound(keys.data(), keys.size(), key, comp) - keys.data();
+        }
+
+        template <typename Kref>
+        size_type Upper_index(const Kref& key) const {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            return branchless_upper_bound(keys.data(), keys.size(), key, comp) - keys.data();
+        }
+
+        //返回元素下标与是否新插入
+        template <typename Kref, typename... Args>
+        pair<size_type, bool> Try_emplace(Kref&& key, Args&&... args) {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            size_type index = Lower_index(key);
+            if (index != keys.size() && !comp(key, keys[index]))
+                return pair<size_type, bool>(index, false);
+            return pair<size_type, bool>(Emplace_at(index, std::forward<Kref>(key), std::forward<Args>(args)...), true);
+        }
+
+        //args可以引用本容器中的值: vector::emplace先构造新元素再扩容或后移原有元素
+        template <typename Kref, typename... Args>
+        size_type Emplace_at(size_type index, Kref&& key, Args&&... args) {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            values.emplace(values.begin() + index, std::forward<Args>(args)...);
+            try {
+                keys.emplace(keys.begin() + index, std::forward<Kref>(key));
+            }
+            catch (...) {
+                values.erase(values.begin() + index);
+                throw;
+            }
+            return index;
+        }
+
+        iterator Insert_hint(iterator hint, value_type&& target) {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            size_type index = hint - begin();
+            if ((index == 0 || comp(keys[index - 1], target.first))
+                && (index == keys.size() || comp(target.first, keys[index])))
+                return Make_iter(Emplace_at(index, std::move(target.first), std::move(target.second)));
+            return try_emplace(std::move(target.first), std::move(target.second)).first;
+        }
+
+        //关键字与值都能无异常移动时原有元素移入新数组, 否则复制, 保证换入之前原内容完好
+        static constexpr bool Nothrow_relocate = std::is_nothrow_move_constructible_v<Key> && std::is_nothrow_move_constructible_v<Ty>;
+
+        template <typename Elem>
+        static decltype(auto) Take(Elem& elem) noexcept {
+            if constexpr (Nothrow_relocate)
+                return std::move(elem);
+            else
+                return static_cast<const Elem&>(elem);
+        }
+
+        void Merge_sorted(vector<value_type>& temp) {
+            OCT_FLAT_MAP_VAL_PACK_UNWRAP
+            value_type* first = temp.data();
+            value_type* last = first + temp.size();
+            std::stable_sort(first, last,
+                [&comp](const value_type& left, const value_type& right) { return comp(left.first, right.first); });
+            last = std::unique(first, last,
+                [&comp](const value_type& left, const value_type& right) { return !comp(left.first, right.first); });
+            key_container_type new_keys;
+            mapped_container_type new_values;
+            new_keys.reserve(keys.size() + (last - first));
+            new_values.reserve(keys.size() + (last - first));
+            size_type index = 0;
+            while (index != keys.size() || first != last) {
+                if (first == last || (index != keys.size() && !comp(first->first, keys[index]))) {
+                    if (first != last && !comp(keys[index], first->first))
+                        ++first;                        //关键字重复, 保留原有元素
+                    new_keys.emplace_back(Take(keys[index]));
+                    new_values.emplace_back(Take(values[index]));
+                    index++;
+                }
+                else {
+                    new_keys.emplace_back(std::move(first->first));
+                    new_values.emplace_back(std::move(first->second));
+                    ++first;
+                }
+            }
+            keys.swap(new_keys);
+            values.swap(new_values);
+        }
+
+        template <typename Container>
+        static void Shrink(Container& cont) {
+            if (cont.capacity() == cont.size())
+                return;
+            Container temp;
+            temp.reserve(cont.size());
+            for (size_type i = 0; i < cont.size(); i++)
+                temp.emplace_back(std::move(cont[i]));
+            cont.swap(temp);
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::out_of_range("invalid flat_map key");
+        }
+
+        [[noreturn]] static void Size_error() {
+            throw std::invalid_argument("flat_map key and mapped containers differ in size");
+        }
+    };
+
+    template <typename Key, typename Ty, class Compare, typename KeyContainer, typename MappedContainer>
+    bool operator==(const flat_map<Key, Ty, Compare, KeyContainer, MappedContainer>& left,
+        const flat_map<Key, Ty, Compare, KeyContainer, MappedContainer>& right) noexcept {
+        return left.keys() == right.keys() && left.values() == right.values();
+    }
+
+    template <typename Key, typename Ty, class Compare, typename KeyContainer, typename MappedContainer>
+    bool operator!=(const flat_map<Key, Ty, Compare, KeyContainer, MappedContainer>& left,
+        const flat_map<Key, Ty, Compare, KeyContainer, MappedContainer>& right) noexcept {
+        return !(left == right);
+    }
+
+    //按元素字典序比较, 关键字用key_comp()比较, 关键字等价时再比较值
+    template <typename Key, typename Ty, class Compare, typename KeyContainer, typename MappedContainer>
+    bool operator<(const flat_map<Key, Ty, Compare, KeyContainer, MappedContainer>& left,
+        const flat_map<Key, Ty, Compare, KeyContainer, MappedContainer>& right) {
+        Compare comp = left.key_comp();
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++) {
+            if (comp((*l).first, (*r).first))
+                return true;
+            if (comp((*r).first, (*l).first))
+                return false;
+            if ((*l).second < (*r).second)
+                return true;
+            if ((*r).second < (*l).second)
+                return false;
+        }
+        return left.size() < right.size();
+    }
+}
+
+#endif
\ No newline at end of file
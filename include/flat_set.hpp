@@ -0,0 +1,305 @@
+#pragma once
+
+#ifndef OCT_FLAT_SET
+#define OCT_FLAT_SET
+
+#include <algorithm>
+#include "vector.hpp"
+
+namespace oct {
+/*
+* characteristics:
+* [sorted_vector]
+* [branchless_search]
+* [EBO]
+*/
+    template <
+        typename Key,
+        class Compare = less<Key>,
+        typename KeyContainer = vector<Key>
+    >
+    class flat_set {
+    public:
+        using key_type           = Key;
+        using value_type         = Key;
+        using key_compare        = Compare;
+        using value_compare      = Compare;
+        using size_type          = size_t;
+        using difference_type    = ptrdiff_t;
+        using reference          = Key&;
+        using const_reference    = const Key&;
+        using pointer            = Key*;
+        using const_pointer      = const Key*;
+        using container_type     = KeyContainer;
+        using iterator           = continuous_memory_iterator<flat_set>;
+
+    private:
+        friend iterator;
+
+        mutable compressed_pair<key_compare, container_type> val_pack;
+
+    public:
+        flat_set() : val_pack(key_compare()) {}
+
+        explicit flat_set(const key_compare& comp)
+            : val_pack(comp) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        flat_set(ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : val_pack(comp) {
+            insert(begin, end);
+        }
+
+        //输入已严格升序, 逐个追加到预留好的数组末尾, 不排序也不查找
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        flat_set(sorted_unique_t, ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : val_pack(comp) {
+            container_type& keys = val_pack.second;
+            keys.reserve(std::distance(begin, end));
+            for (; begin != end; ++begin)
+                keys.emplace_back(*begin);
+        }
+
+        //直接接管一个已排好序的数组
+        flat_set(sorted_unique_t, container_type&& cont, const key_compare& comp = key_compare())
+            : val_pack(comp) {
+            val_pack.second.swap(cont);
+        }
+
+        flat_set(std::initializer_list<value_type> ini_list, const key_compare& comp = key_compare())
+            : flat_set(ini_list.begin(), ini_list.end(), comp) {}
+
+        //val_pack为mutable, 不能依赖默认拷贝构造(会匹配到compressed_pair的转发构造函数)
+        flat_set(const flat_set& another)
+            : val_pack(another.val_pack.get_first(), another.val_pack.second) {}
+
+        flat_set(flat_set&& another) noexcept
+            : val_pack(another.val_pack.get_first(), std::move(another.val_pack.second)) {}
+
+        flat_set& operator=(const flat_set&) = default;
+        flat_set& operator=(flat_set&&)      = default;
+
+        ~flat_set() {}
+
+        const container_type& keys() const noexcept {
+            return val_pack.second;
+        }
+
+        iterator begin() const noexcept {
+            return iterator(val_pack.second.data());
+        }
+
+        iterator end() const noexcept {
+            return iterator(val_pack.second.data() + size());
+        }
+
+        bool empty() const noexcept {
+            return !size();
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.size();
+        }
+
+        size_type capacity() const noexcept {
+            return val_pack.second.capacity();
+        }
+
+        void reserve(size_type count) {
+            val_pack.second.reserve(count);
+        }
+
+        //vector按倍增扩容, 构造完毕后调用可把多余容量全部归还
+        void shrink_to_fit() {
+            container_type& keys = val_pack.second;
+            if (keys.capacity() == keys.size())
+                return;
+            container_type temp;
+            temp.reserve(keys.size());
+            for (size_type i = 0; i < keys.size(); i++)
+                temp.emplace_back(std::move(keys[i]));
+            keys.swap(temp);
+        }
+
+        void clear() {
+            val_pack.second.clear();
+        }
+
+        pair<iterator, bool> insert(const_reference target) {
+            return Insert(target);
+        }
+
+        pair<iterator, bool> insert(value_type&& target) {
+            return Insert(std::move(target));
+        }
+
+        template <typename... Args>
+        pair<iterator, bool> emplace(Args&&... args) {
+            return Insert(value_type(std::forward<Args>(args)...));
+        }
+
+        //hint恰好是插入位置时省去二分查找, 按升序逐个插入时每次都命中
+        iterator insert(iterator hint, const_reference target) {
+            return Insert_hint(hint, value_type(target));
+        }
+
+        iterator insert(iterator hint, value_type&& target) {
+            return Insert_hint(hint, std::move(target));
+        }
+
+        template <typename... Args>
+        iterator emplace_hint(iterator hint, Args&&... args) {
+            return Insert_hint(hint, value_type(std::forward<Args>(args)...));
+        }
+
+        //整批插入: 新元素稳定排序去重后与原有元素归并, 重复元素保留先出现的
+        //新数组在旁边建好后才换入, 中途抛出异常时原内容不变; 元素能无异常移动时原有元素被移入新数组, 否则复制
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void insert(ForwardIt begin, ForwardIt end) {
+            container_type& keys = val_pack.second;
+            key_compare& comp = val_pack.get_first();
+            container_type temp;
+            temp.reserve(std::distance(begin, end));
+            for (; begin != end; ++begin)
+                temp.emplace_back(*begin);
+            pointer first = temp.data();
+            pointer last = first + temp.size();
+            std::stable_sort(first, last, [&comp](const Key& left, const Key& right) { return comp(left, right); });
+            last = std::unique(first, last, [&comp](const Key& left, const Key& right) { return !comp(left, right); });
+            container_type res;
+            res.reserve(keys.size() + (last - first));
+            size_type index = 0;
+            while (index != keys.size() || first != last) {
+                if (first == last || (index != keys.size() && !comp(*first, keys[index]))) {
+                    if (first != last && !comp(keys[index], *first))
+                        ++first;                        //重复元素, 保留原有的
+                    res.emplace_back(std::move_if_noexcept(keys[index++]));
+                }
+                else {
+                    res.emplace_back(std::move(*first++));
+                }
+            }
+            keys.swap(res);
+        }
+
+        void insert(std::initializer_list<value_type> ini_list) {
+            insert(ini_list.begin(), ini_list.end());
+        }
+
+        iterator erase(iterator pos) {
+            container_type& keys = val_pack.second;
+            difference_type index = pos - begin();
+            keys.erase(keys.begin() + index);
+            return begin() + index;
+        }
+
+        iterator erase(iterator begin, iterator end) {
+            container_type& keys = val_pack.second;
+            difference_type first = begin - this->begin();
+            keys.erase(keys.begin() + first, keys.begin() + (end - this->begin()));
+            return this->begin() + first;
+        }
+
+        template <typename Ref>
+        size_type erase(Ref&& key) {
+            iterator it = find(std::forward<Ref>(key));
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        void swap(flat_set& another) noexcept {
+            std::swap(val_pack.get_first(), another.val_pack.get_first());
+            val_pack.second.swap(another.val_pack.second);
+        }
+
+        template <typename Ref>
+        size_type count(Ref&& key) const {
+            return find(std::forward<Ref>(key)) != end();
+        }
+
+        template <typename Ref>
+        iterator find(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            iterator it = Lower_bound(k);
+            if (it == end() || val_pack.get_first()(k, *it))
+                return end();
+            return it;
+        }
+
+        //元素不重复, 相等区间至多一个元素, 只需一次二分
+        template <typename Ref>
+        pair<iterator, iterator> equal_range(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            iterator it = Lower_bound(k);
+            return pair<iterator, iterator>(it, it + (it != end() && !val_pack.get_first()(k, *it)));
+        }
+
+        template <typename Ref>
+        iterator lower_bound(Ref&& key) const {
+            return Lower_bound(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator upper_bound(Ref&& key) const {
+            container_type& keys = val_pack.second;
+            return iterator(const_cast<pointer>(branchless_upper_bound(keys.data(), keys.size(),
+                lookup_key<key_type, key_compare>(std::forward<Ref>(key)), val_pack.get_first())));
+        }
+
+        key_compare key_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+        value_compare value_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+    private:
+        template <typename Kref>
+        iterator Lower_bound(const Kref& key) const {
+            container_type& keys = val_pack.second;
+            return iterator(const_cast<pointer>(branchless_lower_bound(keys.data(), keys.size(), key, val_pack.get_first())));
+        }
+
+        template <typename Ref>
+        pair<iterator, bool> Insert(Ref&& target) {
+            iterator it = Lower_bound(target);
+            if (it != end() && !val_pack.get_first()(target, *it))
+                return pair<iterator, bool>(it, false);
+            container_type& keys = val_pack.second;
+            difference_type index = it - begin();
+            keys.emplace(keys.begin() + index, std::forward<Ref>(target));
+            return pair<iterator, bool>(begin() + index, true);
+        }
+
+        iterator Insert_hint(iterator hint, value_type&& target) {
+            container_type& keys = val_pack.second;
+            key_compare& comp = val_pack.get_first();
+            difference_type index = hint - begin();
+            if ((hint == begin() || comp(hint[-1], target)) && (hint == end() || comp(target, *hint))) {
+                keys.emplace(keys.begin() + index, std::move(target));
+                return begin() + index;
+            }
+            return Insert(std::move(target)).first;
+        }
+    };
+
+    template <typename Key, class Compare, typename KeyContainer>
+    bool operator==(const flat_set<Key, Compare, KeyContainer>& left, const flat_set<Key, Compare, KeyContainer>& right) noexcept {
+        return left.keys() == right.keys();
+    }
+
+    template <typename Key, class Compare, typename KeyContainer>
+    bool operator!=(const flat_set<Key, Compare, KeyContainer>& left, const flat_set<Key, Compare, KeyContainer>& right) noexcept {
+        return !(left == right);
+    }
+
+    template <typename Key, class Compare, typename KeyContainer>
+    bool operator<(const flat_set<Key, Compare, KeyContainer>& left, const flat_set<Key, Compare, KeyContainer>& right) noexcept {
+        return left.keys() < right.keys();
+    }
+}
+
+#endif
\ No newline at end of file
@@ -1,558 +1,711 @@
-#pragma once
-
-#ifndef OCT_FORWARD_LIST
-#define OCT_FORWARD_LIST
-
-#include "utility.hpp"
-#include "type_traits.hpp"
-
-namespace oct {
-/*
-* characteristics:
-* [EBO]
-*/
-    template <typename Ty>
-    struct forward_list_node {
-        using value_type      = Ty;
-        using const_reference = const Ty&;
-
-        using Node    = forward_list_node;
-        using Nodeptr = forward_list_node*;
-
-        value_type val;
-        Nodeptr next = nullptr;
-
-        Node(const_reference target = value_type()) :val(target) {}
-
-        Node(const Node&)            = default;
-        Node(Node&&)                 = default;
-        Node& operator=(const Node&) = default;
-        Node& operator=(Node&&)      = default;
-    };
-
-    template <typename Flist>
-    struct forward_list_val {
-        using size_type = typename Flist::size_type;
-
-        using Node    = typename Flist::Node;
-        using Nodeptr = typename Flist::Nodeptr;
-
-        mutable Node dummy;
-        size_type val_size = 0;
-
-        forward_list_val() = default;
-
-        forward_list_val(size_type count) : dummy{}, val_size(count){}
-
-        forward_list_val(const Node& node, size_type count) : dummy(node), val_size(count) {}
-
-        forward_list_val(Node&& node, size_type count) noexcept 
-            : dummy(std::move(node)), val_size(count) {}
-    };
-
-#define OCT_FORWARD_LIST_VAL_PACK_UNWRAP Node&      dummy    = val_pack.second.dummy;    \
-                                         size_type& val_size = val_pack.second.val_size; \
-                                         Alnode&    alloc    = val_pack.get_first();
-
-    template <typename Ty, typename Allocator = allocator<Ty>>
-    class forward_list {
-    private:    //内部类与内部配置器
-        using Alty          = rebind_alloc_t<Allocator, Ty>;
-        using Alty_traits   = std::allocator_traits<Alty>;
-        using Node          = forward_list_node<Ty>;
-        using Alnode        = rebind_alloc_t<Allocator, Node>;
-        using Alnode_traits = std::allocator_traits<Alnode>;
-        using Nodeptr       = typename Alnode_traits::pointer;
-
-    public:     //统一接口
-        static_assert(std::is_object_v<Ty>, "forward_list requires object types");
-
-        using value_type      = Ty;
-        using allocator_type  = Allocator;
-        using size_type       = typename Alty_traits::size_type;
-        using difference_type = typename Alty_traits::difference_type;
-        using reference       = Ty&;
-        using const_reference = const Ty&;
-        using pointer         = typename Alty_traits::pointer;
-        using const_pointer   = typename Alty_traits::const_pointer;
-        using iterator        = forward_list_iterator<forward_list>;
-
-    private:    //成员变量
-        friend class iterator;
-        friend class forward_list_val<forward_list>;
-
-        mutable compressed_pair<Alnode, forward_list_val<forward_list>> val_pack;
-
-    public:     //成员函数
-        forward_list() : val_pack(Alnode()) {}
-
-        explicit forward_list(const allocator_type& al)
-            : val_pack(al) {}
-
-        explicit forward_list(size_type count, const allocator_type& al = allocator_type())
-            : forward_list(count, value_type(), al) {}
-
-        explicit forward_list(size_type count, const_reference target, const allocator_type& al = allocator_type())
-            : val_pack(al, count) {//提供初始长度和初值的构造
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            Append_n(&dummy, target, count);
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        forward_list(ForwardIt begin, ForwardIt end, const allocator_type& al = allocator_type())
-            : val_pack(al) {//从迭代器中获取数据进行构造
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            val_size = std::distance(begin, end);
-            Append_n(&dummy, begin, val_size);
-        }
-
-        explicit forward_list(const forward_list& another, const allocator_type& al = allocator_type())
-            : forward_list(another.begin(), another.end(), al) {}
-
-        explicit forward_list(forward_list&& another, const allocator_type& al = allocator_type()) noexcept
-            : val_pack(al, std::move(another.val_pack.second.dummy), another.val_pack.second.val_size) {//移动构造
-            another.val_pack.second.dummy.next = nullptr;
-            another.val_pack.second.val_size = 0;//置空对方，防止对方析构时破坏数据
-        }
-
-        forward_list(std::initializer_list<value_type> ini_list, const allocator_type& al = allocator_type())
-            : forward_list(ini_list.begin(), ini_list.end(), al) {}
-
-        ~forward_list() {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            Destroy_n(&dummy, val_size);
-            val_size = 0;
-        }
-
-        forward_list& operator=(const forward_list& another) {//重载拷贝赋值运算符
-            if (this == &another)
-                return *this;
-            *this = forward_list(another);
-            return *this;
-        }
-
-        forward_list& operator=(forward_list&& another) noexcept {//重载移动赋值运算符
-            if (this == &another)
-                return *this;
-            this->~forward_list();
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-
-            dummy = another.val_pack.second.dummy;
-            val_size = another.val_pack.second.val_size;
-
-            another.val_pack.second.dummy.next = nullptr;//置空对方，防止对方析构时破坏窃取到的数据
-            another.val_pack.second.val_size = 0;
-            return *this;
-        }
-
-        void assign(size_type count, const_reference target = value_type()) {//以下是三个再分配的重载
-            forward_list<value_type, allocator_type>temp(count, target);
-            swap(temp);
-        }
-
-        template <typename ForwardIt>
-        void assign(ForwardIt begin, ForwardIt end) {
-            forward_list<value_type, allocator_type>temp(begin, end);
-            swap(temp);
-        }
-
-        void assign(std::initializer_list<value_type> ini_list) {
-            forward_list<value_type, allocator_type>temp(ini_list);
-            swap(temp);
-        }
-
-        allocator_type get_allocator() noexcept {
-            return val_pack.get_first();
-        }
-
-        reference front() const {
-            if (!val_pack.second.val_size)
-                Logic_error();
-            return val_pack.second.dummy.next->val;
-        }
-
-        iterator before_begin() const noexcept {
-            return iterator(&val_pack.second.dummy);
-        }
-
-        iterator begin() const noexcept {
-            return iterator(val_pack.second.dummy.next);
-        }
-
-        iterator end() const noexcept {
-            return iterator(nullptr);
-        }
-
-        bool empty() const noexcept {
-            return !val_pack.second.val_size;
-        }
-
-        size_type size() const noexcept {
-            return val_pack.second.val_size;
-        }
-
-        void clear() {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            Destroy_n(&dummy, val_size);
-            val_size = 0;
-        }
-
-        template <typename Ref>
-        iterator insert_after(iterator it, Ref&& target) {
-            if (!it.ptr)
-                Iterator_error();
-            Nodeptr last = Append_n(it.ptr, std::forward<Ref>(target), 1);
-            val_pack.second.val_size++;
-            return iterator(last);
-        }
-
-        iterator insert_after(iterator it, size_type count, const_reference target) {
-            if (!it.ptr)
-                Iterator_error();
-            Nodeptr last = Append_n(it.ptr, target, count);
-            val_pack.second.val_size += count;
-            return iterator(last);
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        iterator insert_after(iterator it, ForwardIt begin, ForwardIt end) {
-            if (!it.ptr)
-                Iterator_error();
-            size_type count = std::distance(begin, end);
-            Nodeptr last = Append_n(it.ptr, begin, count);
-            val_pack.second.val_size += count;
-            return iterator(last);
-        }
-
-        iterator insert_after(iterator it, std::initializer_list<value_type> ini_list) {
-            return insert_after(it, ini_list.begin(), ini_list.end());
-        }
-
-        iterator erase_after(iterator it) {
-            if (!it.ptr || !(it->next))
-                Iterator_error();
-            Nodeptr next = Destroy_n(it.ptr, 1);
-            val_pack.second.val_size--;
-            return iterator(next);
-        }
-
-        iterator erase_after(iterator after_begin, iterator end) {
-            if (!after_begin.ptr || !(after_begin->next))
-                Iterator_error();
-            size_type count = std::distance(after_begin, end) - 1;
-            Nodeptr next = Destroy_n(after_begin, count);
-            val_pack.second.val_size -= count;
-            return iterator(next);
-        }
-
-        template <typename Ref>
-        void push_front(Ref&& target) {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            Append_n(&dummy, std::forward<Ref>(target), 1);
-            val_size++;
-        }
-
-        void pop_front() {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            if (!val_size)
-                Logic_error();
-            Destroy_n(&dummy, 1);
-            val_size--;
-        }
-
-        void resize(size_type count, const_reference value = value_type()) {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            if (val_size == count) {
-                return;
-            }
-            else if (val_size < count) {
-                Nodeptr last = &dummy;
-                for (size_type i = 0; i < val_size; i++)
-                    last = last->next;
-                Append_n(last, value, count - val_size);
-            }
-            else {
-                Nodeptr last = &dummy;
-                for (size_type i = 0; i < count; i++)
-                    last = last->next;
-                Destroy_n(last, val_size - count);
-            }
-            val_size = count;
-        };
-
-        void swap(forward_list& another) noexcept {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-
-            Node temp_dummy = another.val_pack.second.dummy;
-            size_type temp_size = another.val_pack.second.val_size;
-
-            another.val_pack.second.dummy = dummy;
-            another.val_pack.second.val_size = val_size;
-
-            dummy = temp_dummy;
-            val_size = temp_size;
-        }
-
-        template <class Compare = less<value_type>>
-        void merge(forward_list& another, const Compare& comp = Compare()) {
-            iterator after_merge = before_begin();
-            iterator A = begin(), B = another.begin();
-            for (; A != end() && B != another.end(); after_merge++) {
-                if (comp(A->val, B->val))
-                    after_merge->next = (A++).ptr;
-                else 
-                    after_merge->next = (B++).ptr;
-            }
-            if (B != another.end())
-                after_merge->next = B.ptr;
-
-            val_pack.second.val_size += another.val_pack.second.val_size;
-            another.val_pack.second.dummy.next = nullptr;
-            another.val_pack.second.val_size = 0;
-        }
-
-        template <class Compare = less<value_type>>
-        void merge(forward_list&& another, const Compare& comp = Compare()) {
-            merge(another, comp);
-        }
-
-        void splice_after(iterator pos, forward_list& another, iterator begin = another.before_begin(), iterator end = another.end()) {
-            Nodeptr this_next = pos->next, another_next = begin->next;
-            size_type count = 0;
-            iterator another_it = begin;
-            while (another_it->next != end.ptr) {
-                count++;
-                another_it++;
-            }
-            begin->next = end.ptr;
-            another_it->next = this_next;
-            pos->next = another_next;
-
-            val_pack.second.val_size += count;
-            another.val_pack.second.val_size -= count;
-        }
-
-        void splice_after(iterator pos, forward_list&& another, iterator begin = another.before_begin(), iterator end = another.end()) {
-            splice_after(pos, another, begin, end);
-        }
-
-        size_type remove(const value_type elem) {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            size_type res = 0;
-            Nodeptr ptr = &dummy;
-            while (ptr && ptr->next) {
-                if (ptr->next->val == elem) {
-                    Destroy_n(ptr, 1);
-                    res++;
-                }
-                ptr = ptr->next;
-            }
-            val_size -= res;
-            return res;
-        }
-
-        template <class Predicate>
-        size_type remove_if(Predicate pr) {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            size_type res = 0;
-            for (Nodeptr ptr = &dummy; ptr && ptr->next;) {
-                if (pr(ptr->next->val)) {
-                    Destroy_n(ptr, 1);
-                    res++;
-                }
-                else 
-                    ptr = ptr->next;
-            }
-            val_size -= res;
-            return res;
-        }
-
-        void reverse() noexcept {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            if (val_size <= 1)
-                return;
-            iterator pre = begin(), cur = ++begin();
-            while (cur != end()) {
-                pre->next = cur->next;
-                cur->next = dummy.next;
-                dummy.next = cur.ptr;
-                cur = pre->next;
-            }
-        }
-
-        size_type unique() {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-            size_type res = 0;
-            for (Nodeptr ptr = dummy.next; ptr && ptr->next; ptr = ptr->next) {
-                while (ptr->next && ptr->val == ptr->next->val) {
-                    Destroy_n(ptr, 1);
-                    res++;
-                }
-            }
-            val_size -= res;
-            return res;
-        }
-
-        template <class BinaryPredicate>
-        size_type unique(BinaryPredicate bpr) {
-            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
-                size_type res = 0;
-            for (Nodeptr ptr = dummy.next; ptr && ptr->next; ptr = ptr->next) {
-                while (ptr->next && bpr(ptr->val, ptr->next->val)) {
-                    Destroy_n(ptr, 1);
-                    res++;
-                }
-            }
-            val_size -= res;
-            return res;
-        }
-
-        template <class Compare = less<value_type>>
-        void sort(const Compare& comp = Compare()) {
-            Recursion(begin(), comp);
-        }
-
-    private:
-        Nodeptr Append_n(Nodeptr ptr, const_reference target, size_type n) {
-            Alnode& alloc = val_pack.get_first();
-            Nodeptr temp = ptr->next;
-            while (n--) {
-                ptr->next = Alnode_traits::allocate(alloc,1);
-                Alnode_traits::construct(alloc, ptr->next, target);
-                ptr = ptr->next;
-            }
-            ptr->next = temp;
-            return ptr;
-        }
-
-        Nodeptr Append_n(Nodeptr ptr, value_type&& target, size_type n = 1) {
-            Alnode& alloc = val_pack.get_first();
-            Nodeptr temp = ptr->next;
-            ptr->next = Alnode_traits::allocate(alloc,1);
-            Alnode_traits::construct(alloc, ptr->next, std::move(target));
-            ptr->next->next = temp;
-            return ptr->next;
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        Nodeptr Append_n(Nodeptr ptr, ForwardIt from, size_type n) {
-            Alnode& alloc = val_pack.get_first();
-            Nodeptr temp = ptr->next;
-            while (n--) {
-                ptr->next = Alnode_traits::allocate(alloc,1);
-                Alnode_traits::construct(alloc, ptr->next, *from++);
-                ptr = ptr->next;
-            }
-            ptr->next = temp;
-            return ptr;
-        }
-
-        Nodeptr Destroy_n(Nodeptr ptr, size_type n) {
-            Alnode& alloc = val_pack.get_first();
-            Nodeptr cur = ptr->next;
-            while (cur && n--) {
-                Nodeptr next = cur->next;
-                Alnode_traits::destroy(alloc, cur);
-                Alnode_traits::deallocate(alloc, cur, 1);
-                cur = next;
-            }
-            ptr->next = cur;
-            return cur;
-        }
-
-        template <class Compare>
-        iterator Recursion(iterator head, const Compare& comp) {
-            if (!head.ptr || !head->next) 
-                return head;
-            iterator slow = head, fast = head->next;
-            while (fast.ptr && fast->next) {
-                slow++;
-                fast++, fast++;
-            }
-            iterator left = head, right(slow->next);
-            slow->next = nullptr;
-            return Merge(Recursion(left, comp), Recursion(right, comp), comp);
-        }
-
-        template <class Compare>
-        iterator Merge(iterator left, iterator right, const Compare& comp) {
-            Node dummy_node;
-            iterator pre(&val_pack.second.dummy);
-            for (; left.ptr && right.ptr; pre++)
-                if (comp(left->val, right->val)) 
-                    pre->next = (left++).ptr;
-                else 
-                    pre->next = (right++).ptr;
-            if (left.ptr) 
-                pre->next = left.ptr;
-            if (right.ptr) 
-                pre->next = right.ptr;
-            return val_pack.second.dummy.next;
-        }
-
-        [[noreturn]] static void Logic_error() {
-            throw std::logic_error("invalid forward_list size");
-        }
-
-        [[noreturn]] static void Iterator_error() {
-            throw std::out_of_range("invalid forward_list iterator");
-        }
-    };
-
-    template <typename Ref, typename Ty, typename Allocator>
-    forward_list<Ty, Allocator>& operator>>(Ref&& elem, forward_list<Ty, Allocator>& f_list) {
-        f_list.push_front(std::forward<Ref>(elem));
-        return f_list;
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator==(const forward_list<Ty1, Alloc1>& left, const forward_list<Ty2, Alloc2>& right) noexcept {
-        if (!std::is_same_v<Ty1, Ty2> || left.size() != right.size())
-            return false;
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (!(*l == *r))
-                return false;
-        return true;
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator!=(const forward_list<Ty1, Alloc1>& left, const forward_list<Ty2, Alloc2>& right) noexcept {
-        return !(left == right);
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator<(const forward_list<Ty1, Alloc1>& left, const forward_list<Ty2, Alloc2>& right) noexcept {
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (*l == *r)
-                continue;
-            else return *l < *r;
-        return left.size() < right.size();
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator<=(const forward_list<Ty1, Alloc1>& left, const forward_list<Ty2, Alloc2>& right) noexcept {
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (*l == *r)
-                continue;
-            else return *l < *r;
-        return left.size() <= right.size();
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator>(const forward_list<Ty1, Alloc1>& left, const forward_list<Ty2, Alloc2>& right) noexcept {
-        return !(left <= right);
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator>=(const forward_list<Ty1, Alloc1>& left, const forward_list<Ty2, Alloc2>& right) noexcept {
-        return !(left > right);
-    }
-}
-
+#pragma once
+
+#ifndef OCT_FORWARD_LIST
+#define OCT_FORWARD_LIST
+
+#include "utility.hpp"
+#include "type_traits.hpp"
+#include "oct_node_handle.hpp"
+#include "oct_node_pool.hpp"
+
+namespace oct {
+/*
+* characteristics:
+* [EBO]
+* [node pool]
+*/
+    template <typename Ty>
+    struct forward_list_node {
+        using value_type      = Ty;
+        using const_reference = const Ty&;
+
+        using Node    = forward_list_node;
+        using Nodeptr = forward_list_node*;
+
+        value_type val;
+        Nodeptr next = nullptr;
+
+        Node(const_reference target = value_type()) :val(target) {}
+
+        template <typename... Args>
+        Node(std::in_place_t, Args&&... args) : val(std::forward<Args>(args)...) {}
+
+        Node(const Node&)            = default;
+        Node(Node&&)                 = default;
+        Node& operator=(const Node&) = default;
+        Node& operator=(Node&&)      = default;
+    };
+
+    template <typename Flist>
+    struct forward_list_val {
+        using size_type = typename Flist::size_type;
+
+        using Node    = typename Flist::Node;
+        using Nodeptr = typename Flist::Nodeptr;
+
+        mutable Node dummy;
+        size_type val_size = 0;
+
+        forward_list_val() = default;
+
+        forward_list_val(size_type count) : dummy{}, val_size(count){}
+
+        forward_list_val(const Node& node, size_type count) : dummy(node), val_size(count) {}
+
+        forward_list_val(Node&& node, size_type count) noexcept 
+            : dummy(std::move(node)), val_size(count) {}
+    };
+
+#define OCT_FORWARD_LIST_VAL_PACK_UNWRAP Node&      dummy    = val_pack.second.dummy;    \
+                                         size_type& val_size = val_pack.second.val_size; \
+                                         Node_pool& alloc    = val_pack.get_first();
+
+    //SlabSize非零时启用容器独占的节点池, 节点按SlabSize个一批申请, 删除的节点留待复用, 见node_pool;
+    //池中的节点不能离开容器, 此时没有跨容器的splice_after/merge与extract_after/insert_after(node_type&&), 编译期即被拒绝,
+    //同一链表内的移动用splice_after(pos, begin, end)
+    template <typename Ty, typename Allocator = allocator<Ty>, std::size_t SlabSize = 0>
+    class forward_list {
+    private:    //内部类与内部配置器
+        using Alty          = rebind_alloc_t<Allocator, Ty>;
+        using Alty_traits   = std::allocator_traits<Alty>;
+        using Node          = forward_list_node<Ty>;
+        using Alnode        = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+        using Node_pool     = node_pool<Alnode, SlabSize>;
+
+    public:     //统一接口
+        static_assert(std::is_object_v<Ty>, "forward_list requires object types");
+
+        using value_type      = Ty;
+        using allocator_type  = Allocator;
+        using size_type       = typename Alty_traits::size_type;
+        using difference_type = typename Alty_traits::difference_type;
+        using reference       = Ty&;
+        using const_reference = const Ty&;
+        using pointer         = typename Alty_traits::pointer;
+        using const_pointer   = typename Alty_traits::const_pointer;
+        using iterator        = forward_list_iterator<forward_list>;
+        using node_type       = node_handle<Node, Alnode>;
+
+    private:    //成员变量
+        friend class iterator;
+        friend class forward_list_val<forward_list>;
+
+        mutable compressed_pair<Node_pool, forward_list_val<forward_list>> val_pack;
+
+    public:     //成员函数
+        forward_list() : val_pack(Alnode()) {}
+
+        explicit forward_list(const allocator_type& al)
+            : val_pack(al) {}
+
+        explicit forward_list(size_type count, const allocator_type& al = allocator_type())
+            : forward_list(count, value_type(), al) {}
+
+        explicit forward_list(size_type count, const_reference target, const allocator_type& al = allocator_type())
+            : val_pack(al, count) {//提供初始长度和初值的构造
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            Append_n(&dummy, target, count);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        forward_list(ForwardIt begin, ForwardIt end, const allocator_type& al = allocator_type())
+            : val_pack(al) {//从迭代器中获取数据进行构造
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            val_size = std::distance(begin, end);
+            Append_n(&dummy, begin, val_size);
+        }
+
+        explicit forward_list(const forward_list& another, const allocator_type& al = allocator_type())
+            : forward_list(another.begin(), another.end(), al) {}
+
+        explicit forward_list(forward_list&& another, const allocator_type& al = allocator_type()) noexcept
+            : val_pack(al, std::move(another.val_pack.second.dummy), another.val_pack.second.val_size) {//移动构造
+            another.val_pack.second.dummy.next = nullptr;
+            another.val_pack.second.val_size = 0;//置空对方，防止对方析构时破坏数据
+            val_pack.get_first().Swap(another.val_pack.get_first());
+        }
+
+        forward_list(std::initializer_list<value_type> ini_list, const allocator_type& al = allocator_type())
+            : forward_list(ini_list.begin(), ini_list.end(), al) {}
+
+        ~forward_list() {
+            Tidy();
+        }
+
+        forward_list& operator=(const forward_list& another) {//重载拷贝赋值运算符
+            if (this == &another)
+                return *this;
+            *this = forward_list(another);
+            return *this;
+        }
+
+        forward_list& operator=(forward_list&& another) noexcept {//重载移动赋值运算符
+            if (this == &another)
+                return *this;
+            this->~forward_list();
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+
+            dummy = another.val_pack.second.dummy;
+            val_size = another.val_pack.second.val_size;
+
+            another.val_pack.second.dummy.next = nullptr;//置空对方，防止对方析构时破坏窃取到的数据
+            another.val_pack.second.val_size = 0;
+            alloc.Swap(another.val_pack.get_first());
+            return *this;
+        }
+
+        void assign(size_type count, const_reference target = value_type()) {//以下是三个再分配的重载
+            forward_list temp(count, target);
+            swap(temp);
+        }
+
+        template <typename ForwardIt>
+        void assign(ForwardIt begin, ForwardIt end) {
+            forward_list temp(begin, end);
+            swap(temp);
+        }
+
+        void assign(std::initializer_list<value_type> ini_list) {
+            forward_list temp(ini_list);
+            swap(temp);
+        }
+
+        allocator_type get_allocator() noexcept {
+            return val_pack.get_first();
+        }
+
+        reference front() const {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            return val_pack.second.dummy.next->val;
+        }
+
+        iterator before_begin() const noexcept {
+            return iterator(&val_pack.second.dummy);
+        }
+
+        iterator begin() const noexcept {
+            return iterator(val_pack.second.dummy.next);
+        }
+
+        iterator end() const noexcept {
+            return iterator(nullptr);
+        }
+
+        bool empty() const noexcept {
+            return !val_pack.second.val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.val_size;
+        }
+
+        //启用节点池时同时归还全部slab
+        void clear() {
+            Tidy();
+        }
+
+        //启用节点池时按链表顺序把元素搬入紧凑的新slab并归还旧slab, 遍历时访问连续; 迭代器全部失效
+        //未启用时无操作
+        void shrink_to_fit() {
+            if constexpr (SlabSize > 0) {
+                OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+                if (!val_size) {
+                    alloc.Release();
+                    return;
+                }
+                Node_pool fresh(static_cast<Alnode&>(alloc));
+                Nodeptr head = nullptr;
+                Nodeptr* link = &head;
+                try {
+                    for (Nodeptr cur = dummy.next; cur; cur = cur->next) {
+                        Nodeptr node = fresh.Allocate();
+                        Alnode_traits::construct(alloc, node, std::in_place, std::move_if_noexcept(cur->val));
+                        *link = node;
+                        link = &node->next;
+                    }
+                }
+                catch (...) {//新节点全部销毁, 原链表不变
+                    while (head) {
+                        Nodeptr next = head->next;
+                        Alnode_traits::destroy(alloc, head);
+                        head = next;
+                    }
+                    throw;
+                }
+                for (Nodeptr cur = dummy.next; cur; ) {
+                    Nodeptr next = cur->next;
+                    Alnode_traits::destroy(alloc, cur);
+                    cur = next;
+                }
+                alloc.Swap(fresh);
+                dummy.next = head;
+            }
+        }
+
+        template <typename Ref>
+        iterator insert_after(iterator it, Ref&& target) {
+            return emplace_after(it, std::forward<Ref>(target));
+        }
+
+        //以args在it之后原位构造元素
+        template <typename... Args>
+        iterator emplace_after(iterator it, Args&&... args) {
+            if (!it.ptr)
+                Iterator_error();
+            return iterator(Emplace_after(it.ptr, std::forward<Args>(args)...));
+        }
+
+        iterator insert_after(iterator it, size_type count, const_reference target) {
+            if (!it.ptr)
+                Iterator_error();
+            Nodeptr last = Append_n(it.ptr, target, count);
+            val_pack.second.val_size += count;
+            return iterator(last);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        iterator insert_after(iterator it, ForwardIt begin, ForwardIt end) {
+            if (!it.ptr)
+                Iterator_error();
+            size_type count = std::distance(begin, end);
+            Nodeptr last = Append_n(it.ptr, begin, count);
+            val_pack.second.val_size += count;
+            return iterator(last);
+        }
+
+        iterator insert_after(iterator it, std::initializer_list<value_type> ini_list) {
+            return insert_after(it, ini_list.begin(), ini_list.end());
+        }
+
+        iterator erase_after(iterator it) {
+            if (!it.ptr || !(it->next))
+                Iterator_error();
+            Nodeptr next = Destroy_n(it.ptr, 1);
+            val_pack.second.val_size--;
+            return iterator(next);
+        }
+
+        iterator erase_after(iterator after_begin, iterator end) {
+            if (!after_begin.ptr || !(after_begin->next))
+                Iterator_error();
+            size_type count = std::distance(after_begin, end) - 1;
+            Nodeptr next = Destroy_n(after_begin, count);
+            val_pack.second.val_size -= count;
+            return iterator(next);
+        }
+
+        //摘下it之后的节点交给句柄, 不释放内存
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        node_type extract_after(iterator it) {
+            if (!it.ptr || !(it->next))
+                Iterator_error();
+            Nodeptr node = it->next;
+            it->next = node->next;
+            node->next = nullptr;
+            val_pack.second.val_size--;
+            return node_type(node, val_pack.get_first());
+        }
+
+        //句柄中的节点直接链接到it之后, 句柄为空时返回it
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        iterator insert_after(iterator it, node_type&& handle) {
+            if (!it.ptr)
+                Iterator_error();
+            if (handle.empty())
+                return it;
+            Nodeptr node = handle.Release();
+            node->next = it->next;
+            it->next = node;
+            val_pack.second.val_size++;
+            return iterator(node);
+        }
+
+        template <typename Ref>
+        void push_front(Ref&& target) {
+            emplace_front(std::forward<Ref>(target));
+        }
+
+        template <typename... Args>
+        reference emplace_front(Args&&... args) {
+            return Emplace_after(&val_pack.second.dummy, std::forward<Args>(args)...)->val;
+        }
+
+        void pop_front() {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            if (!val_size)
+                Logic_error();
+            Destroy_n(&dummy, 1);
+            val_size--;
+        }
+
+        void resize(size_type count, const_reference value = value_type()) {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            if (val_size == count) {
+                return;
+            }
+            else if (val_size < count) {
+                Nodeptr last = &dummy;
+                for (size_type i = 0; i < val_size; i++)
+                    last = last->next;
+                Append_n(last, value, count - val_size);
+            }
+            else {
+                Nodeptr last = &dummy;
+                for (size_type i = 0; i < count; i++)
+                    last = last->next;
+                Destroy_n(last, val_size - count);
+            }
+            val_size = count;
+        };
+
+        void swap(forward_list& another) noexcept {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            alloc.Swap(another.val_pack.get_first());
+
+            Node temp_dummy = another.val_pack.second.dummy;
+            size_type temp_size = another.val_pack.second.val_size;
+
+            another.val_pack.second.dummy = dummy;
+            another.val_pack.second.val_size = val_size;
+
+            dummy = temp_dummy;
+            val_size = temp_size;
+        }
+
+        //相等元素中本链表的在前
+        template <class Compare = less<value_type>, std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void merge(forward_list& another, const Compare& comp = Compare()) {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            if (this == &another)
+                return;
+            dummy.next = Merge_chain(dummy.next, another.val_pack.second.dummy.next, comp);
+            val_size += another.val_pack.second.val_size;
+            another.val_pack.second.dummy.next = nullptr;
+            another.val_pack.second.val_size = 0;
+        }
+
+        template <class Compare = less<value_type>, std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void merge(forward_list&& another, const Compare& comp = Compare()) {
+            merge(another, comp);
+        }
+
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void splice_after(iterator pos, forward_list& another, iterator begin = another.before_begin(), iterator end = another.end()) {
+            if (begin->next == end.ptr)
+                return;
+            Nodeptr this_next = pos->next, another_next = begin->next;
+            size_type count = 0;
+            iterator another_it = begin;
+            while (another_it->next != end.ptr) {
+                count++;
+                another_it++;
+            }
+            begin->next = end.ptr;
+            another_it->next = this_next;
+            pos->next = another_next;
+
+            val_pack.second.val_size += count;
+            another.val_pack.second.val_size -= count;
+        }
+
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void splice_after(iterator pos, forward_list&& another, iterator begin = another.before_begin(), iterator end = another.end()) {
+            splice_after(pos, another, begin, end);
+        }
+
+        //同一链表内把(begin, end)移到pos之后, pos不能位于(begin, end)中; 只重新链接节点, 启用节点池时也可用
+        void splice_after(iterator pos, iterator begin, iterator end) {
+            if (begin->next == end.ptr || pos == begin)
+                return;
+            Nodeptr first = begin->next, last = first;
+            while (last->next != end.ptr)
+                last = last->next;
+            begin->next = end.ptr;
+            last->next = pos->next;
+            pos->next = first;
+        }
+
+        size_type remove(const value_type elem) {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            size_type res = 0;
+            Nodeptr ptr = &dummy;
+            while (ptr && ptr->next) {
+                if (ptr->next->val == elem) {
+                    Destroy_n(ptr, 1);
+                    res++;
+                }
+                ptr = ptr->next;
+            }
+            val_size -= res;
+            return res;
+        }
+
+        template <class Predicate>
+        size_type remove_if(Predicate pr) {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            size_type res = 0;
+            for (Nodeptr ptr = &dummy; ptr && ptr->next;) {
+                if (pr(ptr->next->val)) {
+                    Destroy_n(ptr, 1);
+                    res++;
+                }
+                else 
+                    ptr = ptr->next;
+            }
+            val_size -= res;
+            return res;
+        }
+
+        void reverse() noexcept {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            if (val_size <= 1)
+                return;
+            iterator pre = begin(), cur = ++begin();
+            while (cur != end()) {
+                pre->next = cur->next;
+                cur->next = dummy.next;
+                dummy.next = cur.ptr;
+                cur = pre->next;
+            }
+        }
+
+        size_type unique() {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            size_type res = 0;
+            for (Nodeptr ptr = dummy.next; ptr && ptr->next; ptr = ptr->next) {
+                while (ptr->next && ptr->val == ptr->next->val) {
+                    Destroy_n(ptr, 1);
+                    res++;
+                }
+            }
+            val_size -= res;
+            return res;
+        }
+
+        template <class BinaryPredicate>
+        size_type unique(BinaryPredicate bpr) {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+                size_type res = 0;
+            for (Nodeptr ptr = dummy.next; ptr && ptr->next; ptr = ptr->next) {
+                while (ptr->next && bpr(ptr->val, ptr->next->val)) {
+                    Destroy_n(ptr, 1);
+                    res++;
+                }
+            }
+            val_size -= res;
+            return res;
+        }
+
+        //自底向上归并排序, 稳定且不分配内存, 见Sort_chain
+        template <class Compare = less<value_type>>
+        void sort(const Compare& comp = Compare()) {
+            val_pack.second.dummy.next = Sort_chain(val_pack.second.dummy.next, comp);
+        }
+
+    private:
+        Nodeptr Append_n(Nodeptr ptr, const_reference target, size_type n) {
+            Node_pool& alloc = val_pack.get_first();
+            Nodeptr temp = ptr->next;
+            while (n--) {
+                ptr->next = alloc.Allocate();
+                Alnode_traits::construct(alloc, ptr->next, target);
+                ptr = ptr->next;
+            }
+            ptr->next = temp;
+            return ptr;
+        }
+
+        //单个元素直接以参数构造, 右值不再被复制
+        template <typename... Args>
+        Nodeptr Emplace_after(Nodeptr ptr, Args&&... args) {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            Nodeptr node = alloc.Allocate();
+            try {
+                Alnode_traits::construct(alloc, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                alloc.Deallocate(node);
+                throw;
+            }
+            node->next = ptr->next;
+            ptr->next = node;
+            val_size++;
+            return node;
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        Nodeptr Append_n(Nodeptr ptr, ForwardIt from, size_type n) {
+            Node_pool& alloc = val_pack.get_first();
+            Nodeptr temp = ptr->next;
+            while (n--) {
+                ptr->next = alloc.Allocate();
+                Alnode_traits::construct(alloc, ptr->next, *from++);
+                ptr = ptr->next;
+            }
+            ptr->next = temp;
+            return ptr;
+        }
+
+        Nodeptr Destroy_n(Nodeptr ptr, size_type n) {
+            Node_pool& alloc = val_pack.get_first();
+            Nodeptr cur = ptr->next;
+            while (cur && n--) {
+                Nodeptr next = cur->next;
+                Alnode_traits::destroy(alloc, cur);
+                alloc.Deallocate(cur);
+                cur = next;
+            }
+            ptr->next = cur;
+            return cur;
+        }
+
+        //销毁全部元素并归还slab; 启用节点池且元素无需析构时不必遍历链表
+        void Tidy() {
+            OCT_FORWARD_LIST_VAL_PACK_UNWRAP
+            if constexpr (SlabSize == 0 || !std::is_trivially_destructible_v<Node>)
+                Destroy_n(&dummy, val_size);
+            alloc.Release();
+            dummy.next = nullptr;
+            val_size = 0;
+        }
+
+        //依次切下自然有序段放入桶中, 桶i中至少有2^i段, 新段与低位桶逐个归并后进位, 与二进制加一相同;
+        //64个桶足以容纳任意长度的链表, 最后由低到高把各桶归并起来
+        template <class Compare>
+        static Nodeptr Sort_chain(Nodeptr head, const Compare& comp) {
+            Nodeptr bins[64] = {};
+            size_type fill = 0;
+            while (head) {
+                Nodeptr run = Take_run(head, comp);
+                size_type i = 0;
+                for (; i < fill && bins[i]; i++) {
+                    run = Merge_chain(bins[i], run, comp);
+                    bins[i] = nullptr;
+                }
+                bins[i] = run;
+                if (i == fill)
+                    fill++;
+            }
+            Nodeptr res = nullptr;
+            for (size_type i = 0; i < fill; i++)
+                if (bins[i])
+                    res = Merge_chain(bins[i], res, comp);
+            return res;
+        }
+
+        //从head切下最长的非降段, 或最长的严格降段并原地翻转(严格降序翻转不破坏稳定性), head移到段后
+        template <class Compare>
+        static Nodeptr Take_run(Nodeptr& head, const Compare& comp) {
+            Nodeptr first = head;
+            Nodeptr cur = head->next;
+            if (cur && comp(cur->val, first->val)) {
+                first->next = nullptr;
+                while (cur && comp(cur->val, first->val)) {
+                    Nodeptr next = cur->next;
+                    cur->next = first;
+                    first = cur;
+                    cur = next;
+                }
+                head = cur;
+                return first;
+            }
+            Nodeptr last = first;
+            while (cur && !comp(cur->val, last->val)) {
+                last = cur;
+                cur = cur->next;
+            }
+            last->next = nullptr;
+            head = cur;
+            return first;
+        }
+
+        //归并两条以nullptr结尾的有序单链, 只有right严格更小时才取right, 保证稳定
+        template <class Compare>
+        static Nodeptr Merge_chain(Nodeptr left, Nodeptr right, const Compare& comp) {
+            Nodeptr res = nullptr;
+            Nodeptr* link = &res;
+            while (left && right) {
+                if (comp(right->val, left->val)) {
+                    *link = right;
+                    link = &right->next;
+                    right = right->next;
+                }
+                else {
+                    *link = left;
+                    link = &left->next;
+                    left = left->next;
+                }
+            }
+            *link = left ? left : right;
+            return res;
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid forward_list size");
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid forward_list iterator");
+        }
+    };
+
+    template <typename Ref, typename Ty, typename Allocator, std::size_t SlabSize>
+    forward_list<Ty, Allocator, SlabSize>& operator>>(Ref&& elem, forward_list<Ty, Allocator, SlabSize>& f_list) {
+        f_list.push_front(std::forward<Ref>(elem));
+        return f_list;
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator==(const forward_list<Ty1, Alloc1, Slab1>& left, const forward_list<Ty2, Alloc2, Slab2>& right) noexcept {
+        if (!std::is_same_v<Ty1, Ty2> || left.size() != right.size())
+            return false;
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (!(*l == *r))
+                return false;
+        return true;
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator!=(const forward_list<Ty1, Alloc1, Slab1>& left, const forward_list<Ty2, Alloc2, Slab2>& right) noexcept {
+        return !(left == right);
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator<(const forward_list<Ty1, Alloc1, Slab1>& left, const forward_list<Ty2, Alloc2, Slab2>& right) noexcept {
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (*l == *r)
+                continue;
+            else return *l < *r;
+        return left.size() < right.size();
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator<=(const forward_list<Ty1, Alloc1, Slab1>& left, const forward_list<Ty2, Alloc2, Slab2>& right) noexcept {
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (*l == *r)
+                continue;
+            else return *l < *r;
+        return left.size() <= right.size();
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator>(const forward_list<Ty1, Alloc1, Slab1>& left, const forward_list<Ty2, Alloc2, Slab2>& right) noexcept {
+        return !(left <= right);
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator>=(const forward_list<Ty1, Alloc1, Slab1>& left, const forward_list<Ty2, Alloc2, Slab2>& right) noexcept {
+        return !(left > right);
+    }
+}
+
 #endif // !OCT_FORWARD_LIST
\ No newline at end of file
@@ -0,0 +1,288 @@
+#pragma once
+
+#ifndef OCT_INTRUSIVE_LIST
+#define OCT_INTRUSIVE_LIST
+
+#include "utility.hpp"
+#include "type_traits.hpp"
+
+namespace oct {
+    /*
+    * characteristics:
+    * [intrusive]
+    */
+    //嵌入元素中的链表挂钩; 复制元素时挂钩不随之复制, 新元素未链接
+    struct intrusive_list_hook {
+        intrusive_list_hook* next = nullptr;
+        intrusive_list_hook* prev = nullptr;
+
+        intrusive_list_hook() = default;
+
+        intrusive_list_hook(const intrusive_list_hook&) noexcept {}
+
+        intrusive_list_hook& operator=(const intrusive_list_hook&) noexcept {
+            return *this;
+        }
+
+        bool is_linked() const noexcept {
+            return next != nullptr;
+        }
+    };
+
+    //元素由使用者分配并管理生命周期, 容器只链接元素中的挂钩, 任何操作都不分配内存;
+    //元素被链接期间不能移动或销毁, 清空或析构容器只断开链接
+    template <
+        typename Ty,
+        typename HookTraits = intrusive_base_hook<Ty, intrusive_list_hook>
+    >
+    class intrusive_list {
+    private:
+        using Hook    = intrusive_list_hook;
+        using Hookptr = Hook*;
+
+    public:
+        static_assert(std::is_same_v<typename HookTraits::hook_type, intrusive_list_hook>,
+            "intrusive_list requires an intrusive_list_hook");
+
+        using value_type      = Ty;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = Ty&;
+        using const_reference = const Ty&;
+        using pointer         = Ty*;
+        using const_pointer   = const Ty*;
+        using hook_traits     = HookTraits;
+        using iterator        = intrusive_list_iterator<intrusive_list>;
+
+    private:
+        friend iterator;
+
+        mutable Hook dummy;
+        size_type val_size = 0;
+
+    public:
+        intrusive_list() noexcept {
+            dummy.next = dummy.prev = &dummy;
+        }
+
+        intrusive_list(const intrusive_list&)            = delete;
+        intrusive_list& operator=(const intrusive_list&) = delete;
+
+        intrusive_list(intrusive_list&& another) noexcept : intrusive_list() {
+            Take(another);
+        }
+
+        intrusive_list& operator=(intrusive_list&& another) noexcept {
+            if (this == &another)
+                return *this;
+            clear();
+            Take(another);
+            return *this;
+        }
+
+        ~intrusive_list() {
+            clear();
+        }
+
+        reference front() const {
+            if (!val_size)
+                Logic_error();
+            return *begin();
+        }
+
+        reference back() const {
+            if (!val_size)
+                Logic_error();
+            return *iterator(dummy.prev);
+        }
+
+        iterator begin() const noexcept {
+            return iterator(dummy.next);
+        }
+
+        iterator end() const noexcept {
+            return iterator(&dummy);
+        }
+
+        bool empty() const noexcept {
+            return !val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_size;
+        }
+
+        //逐个断开元素的挂钩, 使其可以再次链接
+        void clear() noexcept {
+            Hookptr cur = dummy.next;
+            while (cur != &dummy) {
+                Hookptr next = cur->next;
+                cur->next = cur->prev = nullptr;
+                cur = next;
+            }
+            dummy.next = dummy.prev = &dummy;
+            val_size = 0;
+        }
+
+        //由元素得到指向它的迭代器, O(1); 配合erase可在任意位置O(1)摘下元素
+        iterator iterator_to(reference value) const noexcept {
+            return iterator(HookTraits::To_hook(value));
+        }
+
+        iterator insert(iterator pos, reference value) {
+            Hookptr hook = HookTraits::To_hook(value);
+            if (hook->is_linked())
+                Link_error();
+            Link_before(pos.ptr, hook);
+            val_size++;
+            return iterator(hook);
+        }
+
+        void push_front(reference value) {
+            insert(begin(), value);
+        }
+
+        void push_back(reference value) {
+            insert(end(), value);
+        }
+
+        void pop_front() {
+            if (!val_size)
+                Logic_error();
+            erase(begin());
+        }
+
+        void pop_back() {
+            if (!val_size)
+                Logic_error();
+            erase(iterator(dummy.prev));
+        }
+
+        iterator erase(iterator pos) {
+            if (!pos.ptr || pos.ptr == &dummy)
+                Iterator_error();
+            Hookptr next = pos.ptr->next;
+            Unlink(pos.ptr);
+            val_size--;
+            return iterator(next);
+        }
+
+        iterator erase(iterator begin, iterator end) {
+            while (begin != end)
+                begin = erase(begin);
+            return end;
+        }
+
+        template <class Predicate>
+        size_type remove_if(Predicate pr) {
+            size_type res = 0;
+            for (iterator it = begin(); it != end(); )
+                if (pr(*it)) {
+                    it = erase(it);
+                    res++;
+                }
+                else ++it;
+            return res;
+        }
+
+        void reverse() noexcept {
+            Hookptr cur = &dummy;
+            do {
+                Hookptr next = cur->next;
+                cur->next = cur->prev;
+                cur->prev = next;
+                cur = next;
+            } while (cur != &dummy);
+        }
+
+        //整个another接到pos之前, O(1)
+        void splice(iterator pos, intrusive_list& another) noexcept {
+            if (this == &another || another.empty())
+                return;
+            Transfer(pos.ptr, another.dummy.next, &another.dummy);
+            val_size += another.val_size;
+            another.val_size = 0;
+        }
+
+        void splice(iterator pos, intrusive_list& another, iterator it) noexcept {
+            Hookptr next = it.ptr->next;
+            if (pos.ptr == it.ptr || pos.ptr == next)
+                return;
+            Transfer(pos.ptr, it.ptr, next);
+            val_size++;
+            another.val_size--;
+        }
+
+        //another与本链表不同时需要数出区间长度, O(区间长度)
+        void splice(iterator pos, intrusive_list& another, iterator begin, iterator end) {
+            if (begin == end)
+                return;
+            if (this != &another) {
+                size_type count = std::distance(begin, end);
+                val_size += count;
+                another.val_size -= count;
+            }
+            Transfer(pos.ptr, begin.ptr, end.ptr);
+        }
+
+        void swap(intrusive_list& another) noexcept {
+            if (this == &another)
+                return;
+            intrusive_list temp(std::move(another));
+            another.Take(*this);
+            Take(temp);
+        }
+
+    private:
+        void Take(intrusive_list& another) noexcept {
+            if (another.empty())
+                return;
+            dummy.next = another.dummy.next;
+            dummy.prev = another.dummy.prev;
+            dummy.next->prev = &dummy;
+            dummy.prev->next = &dummy;
+            val_size = another.val_size;
+            another.dummy.next = another.dummy.prev = &another.dummy;
+            another.val_size = 0;
+        }
+
+        static void Link_before(Hookptr pos, Hookptr hook) noexcept {
+            hook->prev = pos->prev;
+            hook->next = pos;
+            pos->prev->next = hook;
+            pos->prev = hook;
+        }
+
+        static void Unlink(Hookptr hook) noexcept {
+            hook->prev->next = hook->next;
+            hook->next->prev = hook->prev;
+            hook->next = hook->prev = nullptr;
+        }
+
+        //把[first, last)整段移到pos之前
+        static void Transfer(Hookptr pos, Hookptr first, Hookptr last) noexcept {
+            Hookptr before_last = last->prev;
+            first->prev->next = last;
+            last->prev = first->prev;
+
+            before_last->next = pos;
+            first->prev = pos->prev;
+            pos->prev->next = first;
+            pos->prev = before_last;
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid intrusive_list size");
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid intrusive_list iterator");
+        }
+
+        [[noreturn]] static void Link_error() {
+            throw std::logic_error("element is already linked into an intrusive container");
+        }
+    };
+}
+
+#endif // !OCT_INTRUSIVE_LIST
\ No newline at end of file
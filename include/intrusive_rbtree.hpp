@@ -0,0 +1,378 @@
+#pragma once
+
+#ifndef OCT_INTRUSIVE_RBTREE
+#define OCT_INTRUSIVE_RBTREE
+
+#include "utility.hpp"
+#include "type_traits.hpp"
+#include "oct_tree.hpp"
+
+namespace oct {
+    /*
+    * characteristics:
+    * [intrusive]
+    * [EBO]
+    */
+    //嵌入元素中的红黑树挂钩, 字段与tree_node一致, 以便直接复用red_black_tree_algorithm;
+    //复制元素时挂钩不随之复制, 新元素未链接
+    struct intrusive_rbtree_hook {
+        using Color = red_black_tree_feature::Color;
+
+        intrusive_rbtree_hook* parent = nullptr;
+        intrusive_rbtree_hook* left   = nullptr;
+        intrusive_rbtree_hook* right  = nullptr;
+        Color color = Color::red;
+
+        intrusive_rbtree_hook() = default;
+
+        intrusive_rbtree_hook(const intrusive_rbtree_hook&) noexcept {}
+
+        intrusive_rbtree_hook& operator=(const intrusive_rbtree_hook&) noexcept {
+            return *this;
+        }
+
+        bool is_linked() const noexcept {
+            return parent != nullptr;
+        }
+    };
+
+    template <typename Tree>
+    struct intrusive_rbtree_val {
+        using size_type = typename Tree::size_type;
+        using Hook      = intrusive_rbtree_hook;
+        using Hookptr   = Hook*;
+
+        Hook dummy;                                 //header: left与right指向根, parent为空
+        Hookptr root       = nullptr;
+        Hookptr begin_node = &dummy;                //最小元素, 定时器取最早到期者O(1)
+        size_type val_size = 0;
+
+        intrusive_rbtree_val() = default;
+
+        intrusive_rbtree_val(const intrusive_rbtree_val&)            = delete;
+        intrusive_rbtree_val& operator=(const intrusive_rbtree_val&) = delete;
+    };
+
+#define OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP Hook&        dummy      = val_pack.second.dummy;      \
+                                             Hookptr&     root       = val_pack.second.root;       \
+                                             Hookptr&     begin_node = val_pack.second.begin_node; \
+                                             size_type&   val_size   = val_pack.second.val_size;   \
+                                             key_compare& kcomp      = val_pack.get_first();
+
+    //元素由使用者分配并管理生命周期, 树只链接元素中的挂钩, 任何操作都不分配内存;
+    //允许相等元素(插入到相等元素之后), insert_unique只在不存在相等元素时插入
+    //元素被链接期间不能移动、销毁或改变参与比较的字段, 清空或析构树只断开链接
+    template <
+        typename Ty,
+        class Compare = less<Ty>,
+        typename HookTraits = intrusive_base_hook<Ty, intrusive_rbtree_hook>
+    >
+    class intrusive_rbtree {
+    private:
+        using Hook         = intrusive_rbtree_hook;
+        using Hookptr      = Hook*;
+        using Algorithm    = tree_algorithm<Hookptr>;
+        using Rb_algorithm = red_black_tree_algorithm<Hookptr>;
+        using Color        = red_black_tree_feature::Color;
+
+    public:
+        static_assert(std::is_same_v<typename HookTraits::hook_type, intrusive_rbtree_hook>,
+            "intrusive_rbtree requires an intrusive_rbtree_hook");
+
+        using key_type        = Ty;
+        using value_type      = Ty;
+        using key_compare     = Compare;
+        using value_compare   = Compare;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = Ty&;
+        using const_reference = const Ty&;
+        using pointer         = Ty*;
+        using const_pointer   = const Ty*;
+        using hook_traits     = HookTraits;
+        using iterator        = intrusive_tree_iterator<intrusive_rbtree>;
+
+    private:
+        friend iterator;
+
+        mutable compressed_pair<key_compare, intrusive_rbtree_val<intrusive_rbtree>> val_pack;
+
+    public:
+        intrusive_rbtree() : val_pack(key_compare()) {}
+
+        explicit intrusive_rbtree(const key_compare& comp) : val_pack(comp) {}
+
+        intrusive_rbtree(const intrusive_rbtree&)            = delete;
+        intrusive_rbtree& operator=(const intrusive_rbtree&) = delete;
+
+        intrusive_rbtree(intrusive_rbtree&& another) noexcept
+            : val_pack(another.val_pack.get_first()) {
+            Take(another);
+        }
+
+        intrusive_rbtree& operator=(intrusive_rbtree&& another) noexcept {
+            if (this == &another)
+                return *this;
+            clear();
+            val_pack.get_first() = another.val_pack.get_first();
+            Take(another);
+            return *this;
+        }
+
+        ~intrusive_rbtree() {
+            clear();
+        }
+
+        reference front() const {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            return *begin();
+        }
+
+        reference back() const {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            return *HookTraits::To_value(Algorithm::Max_node(val_pack.second.root));
+        }
+
+        iterator begin() const noexcept {
+            return iterator(val_pack.second.begin_node);
+        }
+
+        iterator end() const noexcept {
+            return iterator(&val_pack.second.dummy);
+        }
+
+        bool empty() const noexcept {
+            return !val_pack.second.val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.val_size;
+        }
+
+        //沿左链展开逐个断开挂钩, 不递归
+        void clear() noexcept {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            Hookptr node = root;
+            while (node) {
+                if (node->left) {
+                    Hookptr left = node->left;
+                    node->left = left->right;
+                    left->right = node;
+                    node = left;
+                }
+                else {
+                    Hookptr right = node->right;
+                    node->parent = node->right = nullptr;
+                    node->color = Color::red;
+                    node = right;
+                }
+            }
+            dummy.left = dummy.right = nullptr;
+            root = nullptr;
+            begin_node = &dummy;
+            val_size = 0;
+        }
+
+        //由元素得到指向它的迭代器, O(1)
+        iterator iterator_to(reference value) const noexcept {
+            return iterator(HookTraits::To_hook(value));
+        }
+
+        //相等元素之后插入, 保持相等元素的插入顺序
+        iterator insert(reference value) {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            Hookptr  parent = &dummy;
+            Hookptr* address = &root;
+            while (*address) {
+                parent = *address;
+                address = kcomp(value, Value_of(parent)) ? &parent->left : &parent->right;
+            }
+            return iterator(Link_at(parent, address, value));
+        }
+
+        pair<iterator, bool> insert_unique(reference value) {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            Hookptr  parent = &dummy;
+            Hookptr* address = &root;
+            while (*address) {
+                parent = *address;
+                if (kcomp(value, Value_of(parent)))
+                    address = &parent->left;
+                else if (kcomp(Value_of(parent), value))
+                    address = &parent->right;
+                else
+                    return pair<iterator, bool>(iterator(parent), false);
+            }
+            return pair<iterator, bool>(iterator(Link_at(parent, address, value)), true);
+        }
+
+        iterator erase(iterator pos) {
+            if (!pos.ptr || pos.ptr == &val_pack.second.dummy)
+                Iterator_error();
+            return iterator(Unlink(pos.ptr));
+        }
+
+        //摘下指定元素而不查找, O(log n)
+        iterator erase(reference value) {
+            return erase(iterator_to(value));
+        }
+
+        iterator erase(iterator begin, iterator end) {
+            while (begin != end)
+                begin = erase(begin);
+            return end;
+        }
+
+        void pop_front() {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            erase(begin());
+        }
+
+        template <typename Key>
+        size_type count(const Key& key) const {
+            pair<iterator, iterator> range = equal_range(key);
+            return std::distance(range.first, range.second);
+        }
+
+        template <typename Key>
+        bool contains(const Key& key) const {
+            return find(key) != end();
+        }
+
+        template <typename Key>
+        iterator find(const Key& key) const {
+            iterator it = lower_bound(key);
+            if (it == end() || val_pack.get_first()(key, *it))
+                return end();
+            return it;
+        }
+
+        template <typename Key>
+        iterator lower_bound(const Key& key) const {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            Hookptr cur = root, pre = &dummy;
+            while (cur) {
+                if (!kcomp(Value_of(cur), key)) {
+                    pre = cur;
+                    cur = cur->left;
+                }
+                else {
+                    cur = cur->right;
+                }
+            }
+            return iterator(pre);
+        }
+
+        template <typename Key>
+        iterator upper_bound(const Key& key) const {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            Hookptr cur = root, pre = &dummy;
+            while (cur) {
+                if (kcomp(key, Value_of(cur))) {
+                    pre = cur;
+                    cur = cur->left;
+                }
+                else {
+                    cur = cur->right;
+                }
+            }
+            return iterator(pre);
+        }
+
+        template <typename Key>
+        pair<iterator, iterator> equal_range(const Key& key) const {
+            return pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+        }
+
+        void swap(intrusive_rbtree& another) noexcept {
+            if (this == &another)
+                return;
+            intrusive_rbtree temp(std::move(another));
+            another.val_pack.get_first() = val_pack.get_first();
+            another.Take(*this);
+            val_pack.get_first() = temp.val_pack.get_first();
+            Take(temp);
+        }
+
+        key_compare key_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+        value_compare value_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+    private:
+        static reference Value_of(Hookptr hook) noexcept {
+            return *HookTraits::To_value(hook);
+        }
+
+        void Take(intrusive_rbtree& another) noexcept {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            intrusive_rbtree_val<intrusive_rbtree>& other = another.val_pack.second;
+            if (!other.root)
+                return;
+            Algorithm::New_root(&dummy, root, other.root);
+            begin_node = other.begin_node;
+            val_size = other.val_size;
+            other.dummy.left = other.dummy.right = nullptr;
+            other.root = nullptr;
+            other.begin_node = &other.dummy;
+            other.val_size = 0;
+        }
+
+        Hookptr Link_at(Hookptr parent, Hookptr* address, reference value) {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            Hookptr node = HookTraits::To_hook(value);
+            if (node->is_linked())
+                Link_error();
+            node->parent = parent;
+            node->left = node->right = nullptr;
+            node->color = Color::red;
+            *address = node;
+            if (begin_node == &dummy || address == &begin_node->left)
+                begin_node = node;
+            Rb_algorithm::Fix_after_insert(&dummy, root, node);
+            dummy.left = dummy.right = root;
+            val_size++;
+            return node;
+        }
+
+        //把node从树中摘下并重置其挂钩, 返回其后继
+        Hookptr Unlink(Hookptr node) {
+            OCT_INTRUSIVE_RBTREE_VAL_PACK_UNWRAP
+            if (begin_node == node)
+                begin_node = Algorithm::Next_node(node);
+            Hookptr next = Rb_algorithm::Fix_before_erase(&dummy, root, node);
+            if (node == node->parent->left)
+                node->parent->left = nullptr;
+            else if (node == node->parent->right)
+                node->parent->right = nullptr;
+            if (!(--val_size)) {
+                dummy.left = dummy.right = nullptr;
+                root = nullptr;
+                begin_node = &dummy;
+            }
+            node->parent = node->left = node->right = nullptr;
+            node->color = Color::red;
+            return next;
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid intrusive_rbtree size");
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid intrusive_rbtree iterator");
+        }
+
+        [[noreturn]] static void Link_error() {
+            throw std::logic_error("element is already linked into an intrusive container");
+        }
+    };
+}
+
+#endif // !OCT_INTRUSIVE_RBTREE
\ No newline at end of file
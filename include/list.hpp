@@ -1,636 +1,850 @@
-#pragma once
-
-#ifndef OCT_LIST
-#define OCT_LIST
-
-#include "utility.hpp"
-#include "type_traits.hpp"
-
-namespace oct {
-    /*
-    * characteristics:
-    * [EBO]
-    */
-    template <typename Ty>
-    struct list_node {
-        using value_type      = Ty;
-        using const_reference = const Ty&;
-
-        using Node    = list_node;
-        using Nodeptr = list_node*;
-
-        value_type val;
-        Nodeptr next;
-        Nodeptr prev;
-
-        Node(const_reference target = value_type(), Nodeptr prev = nullptr, Nodeptr next = nullptr)
-            : val(target), prev(prev), next(next) {
-            if (!prev && !next)
-                this->prev = this->next = this;
-        }
-
-        Node(const Node&)            = default;
-        Node& operator=(const Node&) = default;
-
-        Node(Node&&) {
-            another.next->prev = this;
-            another.prev->next = this;
-            next = another.next;
-            prev = another.prev;
-            another.prev = another.next = &another;
-        }
-        
-        Node& operator=(Node&& another) noexcept {
-            another.next->prev = this;
-            another.prev->next = this;
-            next = another.next;
-            prev = another.prev;
-            another.prev = another.next = &another;
-            return *this;
-        }
-    };
-
-    template <typename List>
-    struct list_val {
-        using size_type = typename List::size_type;
-
-        using Node    = typename List::Node;
-        using Nodeptr = typename List::Nodeptr;
-
-        mutable Node dummy;
-        size_type val_size = 0;
-
-        list_val() = default;
-
-        list_val(size_type count) : dummy{}, val_size(count) {}
-
-        list_val(const Node& node, size_type count) : dummy(node), val_size(count) {}
-
-        list_val(Node&& node, size_type count) noexcept
-            : dummy(std::move(node)), val_size(count) {
-        }
-    };
-
-#define OCT_LIST_VAL_PACK_UNWRAP Node&      dummy    = val_pack.second.dummy;    \
-                                 size_type& val_size = val_pack.second.val_size; \
-                                 Alnode&      alloc  = val_pack.get_first();     \
-
-    template <typename Ty, typename Allocator = allocator<Ty>>
-    class list {
-    private:    //内部类与内部配置器
-        using Alty          = rebind_alloc_t<Allocator, Ty>;
-        using Alty_traits   = std::allocator_traits<Alty>;
-        using Node          = list_node<Ty>;
-        using Alnode        = rebind_alloc_t<Allocator, Node>;
-        using Alnode_traits = std::allocator_traits<Alnode>;
-        using Nodeptr       = typename Alnode_traits::pointer;
-
-    public:     //统一接口
-        static_assert(std::is_object_v<Ty>, "list requires object types");
-
-        using value_type      = Ty;
-        using allocator_type  = Allocator;
-        using size_type       = typename Alty_traits::size_type;
-        using difference_type = typename Alty_traits::difference_type;
-        using reference       = Ty&;
-        using const_reference = const Ty&;
-        using pointer         = typename Alty_traits::pointer;
-        using const_pointer   = typename Alty_traits::const_pointer;
-        using iterator        = list_iterator<list>;
-
-    private:    //成员变量
-        friend class iterator;
-        friend class list_val<list>;
-
-        mutable compressed_pair<Alnode, list_val<list>> val_pack;
-
-    public:     //成员函数
-        list() : val_pack(Alnode()) {}
-
-        explicit list(size_type count, const allocator_type& al = allocator_type())
-            : list(count, value_type(), al) {}
-
-        explicit list(size_type count, const_reference target, const allocator_type& al = allocator_type())
-            : val_pack(al, count) {//提供初始长度和初值的构造
-            OCT_LIST_VAL_PACK_UNWRAP
-            Insert_n(&dummy, target, count);
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        list(ForwardIt begin, ForwardIt end, const allocator_type& al = allocator_type())
-            : val_pack(al) {//从迭代器中获取数据进行构造
-            OCT_LIST_VAL_PACK_UNWRAP
-            val_size = std::distance(begin, end);
-            Insert_n(&dummy, begin, end);
-        }
-
-        explicit list(const list& another, const allocator_type& al = allocator_type())
-            : list(another.begin(), another.end(), al) {}
-
-        explicit list(list&& another, const allocator_type& al = allocator_type()) noexcept
-            : val_pack(al, std::move(another.val_pack.second.dummy)
-            , another.val_pack.second.val_size) {//移动构造
-            another.val_pack.second.val_size = 0;//置空对方，防止对方析构时破坏数据
-        }
-
-        list(std::initializer_list<value_type> ini_list, const allocator_type& al = allocator_type())
-            : list(ini_list.begin(), ini_list.end(), al) {}
-
-        ~list() {
-            OCT_LIST_VAL_PACK_UNWRAP
-            Destroy_n(dummy.next, val_size);
-            dummy.next = dummy.prev = &dummy;
-            val_size = 0;
-        }
-
-        list& operator=(const list& another) {//重载拷贝赋值运算符
-            if (this == &another)
-                return *this;
-            *this = list(another);
-            return *this;
-        }
-
-        list& operator=(list&& another) noexcept {//重载移动赋值运算符
-            if (this == &another)
-                return *this;
-            this->~list();
-            OCT_LIST_VAL_PACK_UNWRAP
-            dummy = std::move(another.val_pack.second.dummy);
-            val_size = another.val_pack.second.val_size;
-            another.val_pack.second.val_size = 0;
-            return *this;
-        }
-
-        void assign(size_type count, const_reference target = value_type()) {//以下是三个再分配的重载
-            list temp(count, target);
-            swap(temp);
-        }
-
-        template <typename ForwardIt>
-        void assign(ForwardIt begin, ForwardIt end) {
-            list temp(begin, end);
-            swap(temp);
-        }
-
-        void assign(std::initializer_list<value_type> ini_list) {
-            list temp(ini_list);
-            swap(temp);
-        }
-
-        allocator_type get_allocator() noexcept {
-            return val_pack.get_first();
-        }
-
-        reference front() const {
-            if (!val_pack.second.val_size)
-                Logic_error();
-            return val_pack.second.dummy.next->val;
-        }
-
-        reference back() const {
-            if (!val_pack.second.val_size)
-                Logic_error();
-            return val_pack.second.dummy.prev->val;
-        }
-
-        iterator begin() const noexcept {
-            return iterator(val_pack.second.dummy.next);
-        }
-
-        iterator end() const noexcept {
-            return iterator(&val_pack.second.dummy);
-        }
-
-        bool empty() const noexcept {
-            return !val_pack.second.val_size;
-        }
-
-        size_type size() const noexcept {
-            return val_pack.second.val_size;
-        }
-
-        void clear() {
-            OCT_LIST_VAL_PACK_UNWRAP
-            Destroy_n(dummy.next, val_size);
-            val_size = 0;
-        }
-
-        template <typename Ref>
-        iterator insert(iterator it, Ref&& target) {
-            if (!it.ptr)
-                Iterator_error();
-            val_size++;
-            return iterator(Insert_n(it->prev, std::forward<Ref>(target), 1));
-        }
-
-        iterator insert(iterator it, size_type count, const_reference target) {
-            if (!it.ptr)
-                Iterator_error();
-            val_pack.second.val_size += count;
-            return iterator(Insert_n(it->prev, target, count));
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        iterator insert(iterator it, ForwardIt begin, ForwardIt end) {
-            if (!it.ptr)
-                Iterator_error();
-            Nodeptr temp = it->prev;
-            Insert_n(temp, begin, end);
-            temp = temp->next;
-            val_pack.second.val_size += std::distance(begin, end);
-            return iterator(it->prev->next);
-        }
-
-        iterator insert(iterator it, std::initializer_list<value_type> ini_list) {
-            return insert(it, ini_list.begin(), ini_list.end());
-        }
-
-        iterator erase(iterator it) {
-            if (!it.ptr)
-                Iterator_error();
-            Nodeptr next = Destroy_n(it.ptr, 1);
-            val_pack.second.val_size--;
-            return iterator(next);
-        }
-
-        iterator erase(iterator begin, iterator end) {
-            if (!after_begin.ptr || !(after_begin->next))
-                Iterator_error();
-            size_type count = std::distance(begin, end);
-            Nodeptr next = Destroy_n(it.ptr, count);
-            val_pack.second.val_size -= count;
-            return iterator(next);
-        }
-
-        template <typename Ref>
-        void push_back(Ref&& target) {
-            OCT_LIST_VAL_PACK_UNWRAP
-            Insert_n(dummy.prev, std::forward<Ref>(target), 1);
-            val_size++;
-        }
-
-        template<typename Ref>
-        list& operator<<(Ref&& elem) {//尾部压入元素（似乎重载运算符会更直观，返回*this的引用使得支持arr<<1<<2<<3）
-            push_back(std::forward<Ref>(elem));
-            return *this;
-        }
-
-        void pop_back() {
-            OCT_LIST_VAL_PACK_UNWRAP
-            Destroy_n(dummy.prev, 1);
-            val_size--;
-        }
-
-        template <typename Ref>
-        void push_front(Ref&& target) {
-            OCT_LIST_VAL_PACK_UNWRAP
-            Insert_n(&dummy, std::forward<Ref>(target), 1);
-            val_size++;
-        }
-
-        void pop_front() {
-            OCT_LIST_VAL_PACK_UNWRAP
-            if (!val_size)
-                Logic_error();
-            Destroy_n(dummy.next, 1);
-            val_size--;
-        }
-
-        void resize(size_type count, const_reference value = value_type()) {
-            OCT_LIST_VAL_PACK_UNWRAP
-            if (val_size == count) {
-                return;
-            }
-            else if (val_size < count) {
-                Insert_n(dummy.prev, value, count - val_size);
-            }
-            else {
-                Nodeptr last = &dummy;
-                for (size_type i = 0; i < count; i++)
-                    last = last->next;
-                Destroy_n(last, val_size - count);
-            }
-            val_size = count;
-        };
-
-        void swap(list& another) noexcept {
-            OCT_LIST_VAL_PACK_UNWRAP
-
-            Nodeptr temp_prev = dummy.prev;
-            Nodeptr temp_next = dummy.next;
-
-            another.val_pack.second.dummy.prev->next = &dummy;
-            another.val_pack.second.dummy.next->prev = &dummy;
-            dummy.next = another.val_pack.second.dummy.next;
-            dummy.prev = another.val_pack.second.dummy.prev;
-
-            temp_next->prev = &another.val_pack.second.dummy;
-            temp_prev->next = &another.val_pack.second.dummy;
-            another.val_pack.second.dummy.prev = temp_prev;
-            another.val_pack.second.dummy.next = temp_next;
-
-            size_type temp_size = val_size;
-            val_size = another.val_pack.second.val_size;
-            another.val_pack.second.val_size = temp_size;
-        }
-
-        template <class Compare = less<value_type>>
-        void merge(list& another, const Compare& comp = Compare()) {
-            iterator A = begin(), B = another.begin();
-            for (; A != end() && B != another.end(); A++) {
-                if (comp(*A, *B)) {
-                    Link_from(A.ptr, (B++).ptr);
-                    A++;
-                }
-            }
-            if (B != another.end())
-                Link_from(A.ptr->prev, B.ptr, another.end().ptr);
-            val_pack.second.val_size += another.val_pack.second.val_size;
-            another.val_pack.second.val_size = 0;
-        }
-
-        template <class Compare = less<value_type>>
-        void merge(list&& another, const Compare& comp = Compare()) {
-            merge(another, comp);
-        }
-
-        void splice(iterator pos, list& another, iterator begin = another.begin(), iterator end = another.end()) {
-            size_type count = std::distance(begin, end);
-            Link_from(pos.ptr->prev, begin.ptr, end.ptr);
-            val_pack.second.val_size += count;
-            another.val_pack.second.val_size -= count;
-        }
-
-        void splice_after(iterator pos, list&& another, iterator begin = another.begin(), iterator end = another.end()) {
-            splice_after(pos, another, begin, end);
-        }
-        
-        size_type remove(const value_type elem) {
-            OCT_LIST_VAL_PACK_UNWRAP
-            size_type res = 0;
-            for (iterator it = begin(); it != end(); it++) {
-                while (it != end() && *it = elem) {
-                    it = iterator(Destroy_n(it.ptr, 1));
-                    res++;
-                }
-            }
-            val_size -= res;
-            return res;
-        }
-
-        template <class Predicate>
-        size_type remove_if(Predicate pr) {
-            OCT_LIST_VAL_PACK_UNWRAP
-                size_type res = 0;
-            for (iterator it = begin(); it != end(); it++) {
-                while (it != end() && pr(*it)) {
-                    it = iterator(Destroy_n(it.ptr, 1));
-                    res++;
-                }
-            }
-            val_size -= res;
-            return res;
-        }
-
-        void reverse() noexcept {
-            OCT_LIST_VAL_PACK_UNWRAP
-            if (val_size <= 1)
-                 return;
-            iterator pre = begin(), cur = ++begin();
-            while (cur != end()) {
-                pre->next = cur->next;
-                pre->next->prev = pre.ptr;
-
-                cur->next = dummy.next;
-                cur->next->prev = cur.ptr;
-                dummy.next = cur.ptr;
-                cur->prev = &dummy;
-
-                cur = pre;
-                cur++;
-            }
-        }
-
-        size_type unique() {
-            OCT_LIST_VAL_PACK_UNWRAP
-            size_type res = 0;
-            for (iterator it = begin(); it != end(); it++) {
-                while (it->next != &dummy && it->val == it->next->val) {
-                    Destroy_n(it->next, 1);
-                    res++;
-                }
-            }
-            val_size -= res;
-            return res;
-        }
-
-        template < class BinaryPredicate >
-        size_type unique(BinaryPredicate bpr) {
-            OCT_LIST_VAL_PACK_UNWRAP
-                size_type res = 0;
-            for (iterator it = begin(); it != end(); it++) {
-                while (it->next != &dummy && bpr(it->val, it->next->val)) {
-                    Destroy_n(it->next, 1);
-                    res++;
-                }
-            }
-            val_size -= res;
-            return res;
-        }
-
-        template <class Compare = less<value_type>>
-        void sort(const Compare& comp = Compare()) {
-            Node& dummy = val_pack.second.dummy;
-            dummy.prev->next = nullptr;
-            dummy.prev = nullptr;
-
-            Recursion(begin(), comp);
-
-            iterator it = begin();
-            it->prev = &dummy;
-            while (it->next) {
-                it->next->prev = it.ptr;
-                it++;
-            }
-            it->next = &dummy;
-            dummy.prev = it.ptr;
-        }
-        
-    private:
-        template <typename Ref>
-        Nodeptr Insert_n(Nodeptr pre, Ref&& target, size_type n) {
-            Alnode& alloc = val_pack.get_first();
-            Nodeptr res = Alnode_traits::allocate(alloc, 1);
-            Alnode_traits::construct(alloc, res, std::forward<Ref>(target), pre, pre->next);
-            res->prev->next = res;
-            res->next->prev = res;
-
-            Nodeptr node = res;
-            pre = pre->next;
-            while (--n) {
-                node = Alnode_traits::allocate(alloc, 1);
-                Alnode_traits::construct(alloc, node, std::forward<Ref>(target), pre, pre->next);
-
-                node->prev->next = node;
-                node->next->prev = node;
-
-                pre = pre->next;
-            }
-            return res;
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        Nodeptr Insert_n(Nodeptr pre, ForwardIt begin, ForwardIt end) {
-            Alnode& alloc = val_pack.get_first();
-            Nodeptr res = Alnode_traits::allocate(alloc, 1);
-            Alnode_traits::construct(alloc, res, *begin++, pre, pre->next);
-            res->prev->next = res;
-            res->next->prev = res;
-
-            Nodeptr node = res;
-            pre = pre->next;
-            while (begin != end) {
-                node = Alnode_traits::allocate(alloc, 1);
-                Alnode_traits::construct(alloc, node, *begin++, pre, pre->next);
-
-                node->prev->next = node;
-                node->next->prev = node;
-
-                pre = pre->next;
-            }
-            return res;
-        }
-
-        Nodeptr Destroy_n(Nodeptr ptr, size_type n) {
-            Alnode& alloc = val_pack.get_first();
-            Nodeptr pre = ptr->prev;
-            while (n--) {
-                pre->next = ptr->next;
-                Alnode_traits::destroy(alloc, ptr);
-                Alnode_traits::deallocate(alloc, ptr, 1);
-                ptr = pre->next;
-            }
-            ptr->prev = pre;
-            return ptr;
-        }
-
-        void Link_from(Nodeptr pre, Nodeptr node) {
-            node->next->prev = node->prev;
-            node->prev->next = node->next;
-
-            node->next = pre->next;
-            node->prev = pre;
-
-            node->prev->next = node;
-            node->next->prev = node;
-        }
-
-        void Link_from(Nodeptr pre, Nodeptr l, Nodeptr r) {
-            Nodeptr before_r = r->prev;
-
-            l->prev->next = r;
-            r->prev = l->prev;
-
-            before_r->next = pre->next;
-            before_r->next->prev = before_r;
-
-            pre->next = l;
-            l->prev = pre;
-        }
-
-        template <class Compare>
-        iterator Recursion(iterator head, const Compare& comp) {
-            if (!head.ptr || !head->next)
-                return head;
-            iterator slow = head, fast = head->next;
-            while (fast.ptr && fast->next) {
-                slow++;
-                fast++, fast++;
-            }
-            iterator left = head, right(slow->next);
-            slow->next = nullptr;
-            return Merge(Recursion(left, comp), Recursion(right, comp), comp);
-        }
-
-        template <class Compare>
-        iterator Merge(iterator left, iterator right, const Compare& comp) {
-            Node dummy_node;
-            iterator pre(&val_pack.second.dummy);
-            for (; left.ptr && right.ptr; pre++)
-                if (comp(*left, *right))
-                    pre->next = (left++).ptr;
-                else 
-                    pre->next = (right++).ptr;
-            if (left.ptr)
-                pre->next = left.ptr;
-            if (right.ptr)
-                pre->next = right.ptr;
-            return val_pack.second.dummy.next;
-        }
-
-        [[noreturn]] static void Logic_error() {
-            throw std::logic_error("invalid list size");
-        }
-
-        [[noreturn]] static void Iterator_error() {
-            throw std::out_of_range("invalid list iterator");
-        }
-    };
-
-    template <typename Ref, typename Ty, typename Allocator>
-    list<Ty, Allocator>& operator>>(Ref&& elem, list<Ty, Allocator>& lst) {
-        lst.push_front(std::forward<Ref>(elem));
-        return lst;
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator==(const list<Ty1, Alloc1>& left, const list<Ty2, Alloc2>& right) noexcept {
-        if (!std::is_same_v<Ty1, Ty2> || left.size() != right.size())
-            return false;
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (!(*l == *r))
-                return false;
-        return true;
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator!=(const list<Ty1, Alloc1>& left, const list<Ty2, Alloc2>& right) noexcept {
-        return !(left == right);
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator<(const list<Ty1, Alloc1>& left, const list<Ty2, Alloc2>& right) noexcept {
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (*l == *r)
-                continue;
-            else return *l < *r;
-        return left.size() < right.size();
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator<=(const list<Ty1, Alloc1>& left, const list<Ty2, Alloc2>& right) noexcept {
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (*l == *r)
-                continue;
-            else return *l < *r;
-        return left.size() <= right.size();
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator>(const list<Ty1, Alloc1>& left, const list<Ty2, Alloc2>& right) noexcept {
-        return !(left <= right);
-    }
-
-    template <typename Ty1, typename Alloc1, typename Ty2, typename Alloc2>
-    bool operator>=(const list<Ty1, Alloc1>& left, const list<Ty2, Alloc2>& right) noexcept {
-        return !(left > right);
-    }
-}
-
+#pragma once
+
+#ifndef OCT_LIST
+#define OCT_LIST
+
+#include "utility.hpp"
+#include "type_traits.hpp"
+#include "oct_node_handle.hpp"
+#include "oct_node_pool.hpp"
+
+namespace oct {
+    /*
+    * characteristics:
+    * [EBO]
+    * [node pool]
+    */
+    template <typename Ty>
+    struct list_node {
+        using value_type      = Ty;
+        using const_reference = const Ty&;
+
+        using Node    = list_node;
+        using Nodeptr = list_node*;
+
+        value_type val;
+        Nodeptr next;
+        Nodeptr prev;
+
+        Node(const_reference target = value_type(), Nodeptr prev = nullptr, Nodeptr next = nullptr)
+            : val(target), prev(prev), next(next) {
+            if (!prev && !next)
+                this->prev = this->next = this;
+        }
+
+        template <typename... Args>
+        Node(std::in_place_t, Nodeptr prev, Nodeptr next, Args&&... args)
+            : val(std::forward<Args>(args)...), prev(prev), next(next) {}
+
+        Node(const Node&)            = default;
+        Node& operator=(const Node&) = default;
+
+        Node(Node&& another) noexcept {
+            *this = std::move(another);
+        }
+        
+        Node& operator=(Node&& another) noexcept {
+            if (another.next == &another) {//空链表的哨兵指向自身
+                next = prev = this;
+                return *this;
+            }
+            another.next->prev = this;
+            another.prev->next = this;
+            next = another.next;
+            prev = another.prev;
+            another.prev = another.next = &another;
+            return *this;
+        }
+    };
+
+    template <typename List>
+    struct list_val {
+        using size_type = typename List::size_type;
+
+        using Node    = typename List::Node;
+        using Nodeptr = typename List::Nodeptr;
+
+        mutable Node dummy;
+        size_type val_size = 0;
+
+        list_val() = default;
+
+        list_val(size_type count) : dummy{}, val_size(count) {}
+
+        list_val(const Node& node, size_type count) : dummy(node), val_size(count) {}
+
+        list_val(Node&& node, size_type count) noexcept
+            : dummy(std::move(node)), val_size(count) {
+        }
+    };
+
+#define OCT_LIST_VAL_PACK_UNWRAP Node&      dummy    = val_pack.second.dummy;    \
+                                 size_type& val_size = val_pack.second.val_size; \
+                                 Node_pool&   alloc  = val_pack.get_first();     \
+
+    //SlabSize非零时启用容器独占的节点池, 节点按SlabSize个一批申请, 删除的节点留待复用, 见node_pool;
+    //池中的节点不能离开容器, 此时没有跨容器的splice/merge与extract/insert(node_type&&), 编译期即被拒绝,
+    //同一链表内的移动用splice(pos, begin, end)
+    template <typename Ty, typename Allocator = allocator<Ty>, std::size_t SlabSize = 0>
+    class list {
+    private:    //内部类与内部配置器
+        using Alty          = rebind_alloc_t<Allocator, Ty>;
+        using Alty_traits   = std::allocator_traits<Alty>;
+        using Node          = list_node<Ty>;
+        using Alnode        = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+        using Node_pool     = node_pool<Alnode, SlabSize>;
+
+    public:     //统一接口
+        static_assert(std::is_object_v<Ty>, "list requires object types");
+
+        using value_type      = Ty;
+        using allocator_type  = Allocator;
+        using size_type       = typename Alty_traits::size_type;
+        using difference_type = typename Alty_traits::difference_type;
+        using reference       = Ty&;
+        using const_reference = const Ty&;
+        using pointer         = typename Alty_traits::pointer;
+        using const_pointer   = typename Alty_traits::const_pointer;
+        using iterator        = list_iterator<list>;
+        using node_type       = node_handle<Node, Alnode>;
+
+    private:    //成员变量
+        friend class iterator;
+        friend class list_val<list>;
+
+        mutable compressed_pair<Node_pool, list_val<list>> val_pack;
+
+    public:     //成员函数
+        list() : val_pack(Alnode()) {}
+
+        explicit list(size_type count, const allocator_type& al = allocator_type())
+            : list(count, value_type(), al) {}
+
+        explicit list(size_type count, const_reference target, const allocator_type& al = allocator_type())
+            : val_pack(al, count) {//提供初始长度和初值的构造
+            OCT_LIST_VAL_PACK_UNWRAP
+            Insert_n(&dummy, target, count);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        list(ForwardIt begin, ForwardIt end, const allocator_type& al = allocator_type())
+            : val_pack(al) {//从迭代器中获取数据进行构造
+            OCT_LIST_VAL_PACK_UNWRAP
+            val_size = std::distance(begin, end);
+            Insert_n(&dummy, begin, end);
+        }
+
+        explicit list(const list& another, const allocator_type& al = allocator_type())
+            : list(another.begin(), another.end(), al) {}
+
+        explicit list(list&& another, const allocator_type& al = allocator_type()) noexcept
+            : val_pack(al, std::move(another.val_pack.second.dummy)
+            , another.val_pack.second.val_size) {//移动构造
+            another.val_pack.second.val_size = 0;//置空对方，防止对方析构时破坏数据
+            val_pack.get_first().Swap(another.val_pack.get_first());
+        }
+
+        list(std::initializer_list<value_type> ini_list, const allocator_type& al = allocator_type())
+            : list(ini_list.begin(), ini_list.end(), al) {}
+
+        ~list() {
+            Tidy();
+        }
+
+        list& operator=(const list& another) {//重载拷贝赋值运算符
+            if (this == &another)
+                return *this;
+            *this = list(another);
+            return *this;
+        }
+
+        list& operator=(list&& another) noexcept {//重载移动赋值运算符
+            if (this == &another)
+                return *this;
+            this->~list();
+            OCT_LIST_VAL_PACK_UNWRAP
+            dummy = std::move(another.val_pack.second.dummy);
+            val_size = another.val_pack.second.val_size;
+            another.val_pack.second.val_size = 0;
+            alloc.Swap(another.val_pack.get_first());
+            return *this;
+        }
+
+        void assign(size_type count, const_reference target = value_type()) {//以下是三个再分配的重载
+            list temp(count, target);
+            swap(temp);
+        }
+
+        template <typename ForwardIt>
+        void assign(ForwardIt begin, ForwardIt end) {
+            list temp(begin, end);
+            swap(temp);
+        }
+
+        void assign(std::initializer_list<value_type> ini_list) {
+            list temp(ini_list);
+            swap(temp);
+        }
+
+        allocator_type get_allocator() noexcept {
+            return val_pack.get_first();
+        }
+
+        reference front() const {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            return val_pack.second.dummy.next->val;
+        }
+
+        reference back() const {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            return val_pack.second.dummy.prev->val;
+        }
+
+        iterator begin() const noexcept {
+            return iterator(val_pack.second.dummy.next);
+        }
+
+        iterator end() const noexcept {
+            return iterator(&val_pack.second.dummy);
+        }
+
+        bool empty() const noexcept {
+            return !val_pack.second.val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.val_size;
+        }
+
+        //启用节点池时同时归还全部slab
+        void clear() {
+            Tidy();
+        }
+
+        //启用节点池时按链表顺序把元素搬入紧凑的新slab并归还旧slab, 遍历时访问连续; 迭代器全部失效
+        //未启用时无操作
+        void shrink_to_fit() {
+            if constexpr (SlabSize > 0) {
+                OCT_LIST_VAL_PACK_UNWRAP
+                if (!val_size) {
+                    alloc.Release();
+                    return;
+                }
+                Node_pool fresh(static_cast<Alnode&>(alloc));
+                Nodeptr head = nullptr, tail = &dummy;
+                try {
+                    for (Nodeptr cur = dummy.next; cur != &dummy; cur = cur->next) {
+                        Nodeptr node = fresh.Allocate();
+                        Alnode_traits::construct(alloc, node, std::in_place, tail, nullptr, std::move_if_noexcept(cur->val));
+                        (head ? tail->next : head) = node;
+                        tail = node;
+                    }
+                }
+                catch (...) {//新节点全部销毁, 原链表不变
+                    while (head) {
+                        Nodeptr next = head->next;
+                        Alnode_traits::destroy(alloc, head);
+                        head = next;
+                    }
+                    throw;
+                }
+                for (Nodeptr cur = dummy.next; cur != &dummy; ) {
+                    Nodeptr next = cur->next;
+                    Alnode_traits::destroy(alloc, cur);
+                    cur = next;
+                }
+                alloc.Swap(fresh);
+                dummy.next = head;
+                dummy.prev = tail;
+                tail->next = &dummy;
+            }
+        }
+
+        template <typename Ref>
+        iterator insert(iterator it, Ref&& target) {
+            return emplace(it, std::forward<Ref>(target));
+        }
+
+        //以args在it之前原位构造元素
+        template <typename... Args>
+        iterator emplace(iterator it, Args&&... args) {
+            if (!it.ptr)
+                Iterator_error();
+            return iterator(Emplace_after(it->prev, std::forward<Args>(args)...));
+        }
+
+        iterator insert(iterator it, size_type count, const_reference target) {
+            if (!it.ptr)
+                Iterator_error();
+            val_pack.second.val_size += count;
+            return iterator(Insert_n(it->prev, target, count));
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        iterator insert(iterator it, ForwardIt begin, ForwardIt end) {
+            if (!it.ptr)
+                Iterator_error();
+            Nodeptr temp = it->prev;
+            Insert_n(temp, begin, end);
+            temp = temp->next;
+            val_pack.second.val_size += std::distance(begin, end);
+            return iterator(it->prev->next);
+        }
+
+        iterator insert(iterator it, std::initializer_list<value_type> ini_list) {
+            return insert(it, ini_list.begin(), ini_list.end());
+        }
+
+        iterator erase(iterator it) {
+            if (!it.ptr)
+                Iterator_error();
+            Nodeptr next = Destroy_n(it.ptr, 1);
+            val_pack.second.val_size--;
+            return iterator(next);
+        }
+
+        iterator erase(iterator begin, iterator end) {
+            if (!after_begin.ptr || !(after_begin->next))
+                Iterator_error();
+            size_type count = std::distance(begin, end);
+            Nodeptr next = Destroy_n(it.ptr, count);
+            val_pack.second.val_size -= count;
+            return iterator(next);
+        }
+
+        //摘下it处的节点交给句柄, 不释放内存
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        node_type extract(iterator it) {
+            OCT_LIST_VAL_PACK_UNWRAP
+            if (!it.ptr || it.ptr == &dummy)
+                Iterator_error();
+            Nodeptr node = it.ptr;
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            node->prev = node->next = node;
+            val_size--;
+            return node_type(node, alloc);
+        }
+
+        //句柄中的节点直接链接到it之前, 句柄为空时返回it
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        iterator insert(iterator it, node_type&& handle) {
+            if (!it.ptr)
+                Iterator_error();
+            if (handle.empty())
+                return it;
+            Nodeptr node = handle.Release();
+            node->prev = it->prev;
+            node->next = it.ptr;
+            node->prev->next = node;
+            node->next->prev = node;
+            val_pack.second.val_size++;
+            return iterator(node);
+        }
+
+        template <typename Ref>
+        void push_back(Ref&& target) {
+            emplace_back(std::forward<Ref>(target));
+        }
+
+        template <typename... Args>
+        reference emplace_back(Args&&... args) {
+            return Emplace_after(val_pack.second.dummy.prev, std::forward<Args>(args)...)->val;
+        }
+
+        template<typename Ref>
+        list& operator<<(Ref&& elem) {//尾部压入元素（似乎重载运算符会更直观，返回*this的引用使得支持arr<<1<<2<<3）
+            push_back(std::forward<Ref>(elem));
+            return *this;
+        }
+
+        void pop_back() {
+            OCT_LIST_VAL_PACK_UNWRAP
+            Destroy_n(dummy.prev, 1);
+            val_size--;
+        }
+
+        template <typename Ref>
+        void push_front(Ref&& target) {
+            emplace_front(std::forward<Ref>(target));
+        }
+
+        template <typename... Args>
+        reference emplace_front(Args&&... args) {
+            return Emplace_after(&val_pack.second.dummy, std::forward<Args>(args)...)->val;
+        }
+
+        void pop_front() {
+            OCT_LIST_VAL_PACK_UNWRAP
+            if (!val_size)
+                Logic_error();
+            Destroy_n(dummy.next, 1);
+            val_size--;
+        }
+
+        void resize(size_type count, const_reference value = value_type()) {
+            OCT_LIST_VAL_PACK_UNWRAP
+            if (val_size == count) {
+                return;
+            }
+            else if (val_size < count) {
+                Insert_n(dummy.prev, value, count - val_size);
+            }
+            else {
+                Nodeptr last = &dummy;
+                for (size_type i = 0; i < count; i++)
+                    last = last->next;
+                Destroy_n(last, val_size - count);
+            }
+            val_size = count;
+        };
+
+        void swap(list& another) noexcept {
+            OCT_LIST_VAL_PACK_UNWRAP
+            alloc.Swap(another.val_pack.get_first());
+
+            //交换首尾指针后再让首尾节点指回各自的哨兵, 空链表的哨兵指向自身
+            Node& other = another.val_pack.second.dummy;
+            std::swap(dummy.next, other.next);
+            std::swap(dummy.prev, other.prev);
+            if (dummy.next == &other)
+                dummy.next = dummy.prev = &dummy;
+            else
+                dummy.next->prev = dummy.prev->next = &dummy;
+            if (other.next == &dummy)
+                other.next = other.prev = &other;
+            else
+                other.next->prev = other.prev->next = &other;
+
+            size_type temp_size = val_size;
+            val_size = another.val_pack.second.val_size;
+            another.val_pack.second.val_size = temp_size;
+        }
+
+        //两条链表拆成以nullptr结尾的链归并后接回哨兵; 相等元素中本链表的在前
+        template <class Compare = less<value_type>, std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void merge(list& another, const Compare& comp = Compare()) {
+            OCT_LIST_VAL_PACK_UNWRAP
+            Node& other = another.val_pack.second.dummy;
+            if (this == &another || !another.val_pack.second.val_size)
+                return;
+            Nodeptr left = nullptr;
+            if (val_size) {
+                left = dummy.next;
+                left->prev = dummy.prev;
+                dummy.prev->next = nullptr;
+            }
+            Nodeptr right = other.next;
+            right->prev = other.prev;
+            other.prev->next = nullptr;
+            other.next = other.prev = &other;
+            Close_chain(Merge_chain(left, right, comp));
+            val_size += another.val_pack.second.val_size;
+            another.val_pack.second.val_size = 0;
+        }
+
+        template <class Compare = less<value_type>, std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void merge(list&& another, const Compare& comp = Compare()) {
+            merge(another, comp);
+        }
+
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void splice(iterator pos, list& another, iterator begin = another.begin(), iterator end = another.end()) {
+            if (begin == end)
+                return;
+            size_type count = std::distance(begin, end);
+            Link_from(pos.ptr->prev, begin.ptr, end.ptr);
+            val_pack.second.val_size += count;
+            another.val_pack.second.val_size -= count;
+        }
+
+        template <std::size_t Slab = SlabSize, std::enable_if_t<Slab == 0, int> = 0>
+        void splice(iterator pos, list&& another, iterator begin = another.begin(), iterator end = another.end()) {
+            splice(pos, another, begin, end);
+        }
+
+        //同一链表内把[begin, end)移到pos之前, pos不能位于(begin, end)中; 只重新链接节点, 启用节点池时也可用
+        void splice(iterator pos, iterator begin, iterator end) {
+            if (begin == end || pos == end)
+                return;
+            Link_from(pos.ptr->prev, begin.ptr, end.ptr);
+        }
+        
+        size_type remove(const value_type elem) {
+            OCT_LIST_VAL_PACK_UNWRAP
+            size_type res = 0;
+            for (iterator it = begin(); it != end(); it++) {
+                while (it != end() && *it = elem) {
+                    it = iterator(Destroy_n(it.ptr, 1));
+                    res++;
+                }
+            }
+            val_size -= res;
+            return res;
+        }
+
+        template <class Predicate>
+        size_type remove_if(Predicate pr) {
+            OCT_LIST_VAL_PACK_UNWRAP
+                size_type res = 0;
+            for (iterator it = begin(); it != end(); it++) {
+                while (it != end() && pr(*it)) {
+                    it = iterator(Destroy_n(it.ptr, 1));
+                    res++;
+                }
+            }
+            val_size -= res;
+            return res;
+        }
+
+        void reverse() noexcept {
+            OCT_LIST_VAL_PACK_UNWRAP
+            if (val_size <= 1)
+                 return;
+            iterator pre = begin(), cur = ++begin();
+            while (cur != end()) {
+                pre->next = cur->next;
+                pre->next->prev = pre.ptr;
+
+                cur->next = dummy.next;
+                cur->next->prev = cur.ptr;
+                dummy.next = cur.ptr;
+                cur->prev = &dummy;
+
+                cur = pre;
+                cur++;
+            }
+        }
+
+        size_type unique() {
+            OCT_LIST_VAL_PACK_UNWRAP
+            size_type res = 0;
+            for (iterator it = begin(); it != end(); it++) {
+                while (it->next != &dummy && it->val == it->next->val) {
+                    Destroy_n(it->next, 1);
+                    res++;
+                }
+            }
+            val_size -= res;
+            return res;
+        }
+
+        template < class BinaryPredicate >
+        size_type unique(BinaryPredicate bpr) {
+            OCT_LIST_VAL_PACK_UNWRAP
+                size_type res = 0;
+            for (iterator it = begin(); it != end(); it++) {
+                while (it->next != &dummy && bpr(it->val, it->next->val)) {
+                    Destroy_n(it->next, 1);
+                    res++;
+                }
+            }
+            val_size -= res;
+            return res;
+        }
+
+        //自底向上归并排序, 稳定且不分配内存, 见Sort_chain
+        template <class Compare = less<value_type>>
+        void sort(const Compare& comp = Compare()) {
+            OCT_LIST_VAL_PACK_UNWRAP
+            if (val_size < 2)
+                return;
+            dummy.prev->next = nullptr;
+            Close_chain(Sort_chain(dummy.next, comp));
+        }
+        
+    private:
+        //单个元素直接以参数构造, 右值不再被复制
+        template <typename... Args>
+        Nodeptr Emplace_after(Nodeptr pre, Args&&... args) {
+            OCT_LIST_VAL_PACK_UNWRAP
+            Nodeptr node = alloc.Allocate();
+            try {
+                Alnode_traits::construct(alloc, node, std::in_place, pre, pre->next, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                alloc.Deallocate(node);
+                throw;
+            }
+            node->prev->next = node;
+            node->next->prev = node;
+            val_size++;
+            return node;
+        }
+
+        template <typename Ref>
+        Nodeptr Insert_n(Nodeptr pre, Ref&& target, size_type n) {
+            Node_pool& alloc = val_pack.get_first();
+            if (!n)
+                return pre->next;
+            Nodeptr res = alloc.Allocate();
+            Alnode_traits::construct(alloc, res, std::forward<Ref>(target), pre, pre->next);
+            res->prev->next = res;
+            res->next->prev = res;
+
+            Nodeptr node = res;
+            pre = pre->next;
+            while (--n) {
+                node = alloc.Allocate();
+                Alnode_traits::construct(alloc, node, std::forward<Ref>(target), pre, pre->next);
+
+                node->prev->next = node;
+                node->next->prev = node;
+
+                pre = pre->next;
+            }
+            return res;
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        Nodeptr Insert_n(Nodeptr pre, ForwardIt begin, ForwardIt end) {
+            Node_pool& alloc = val_pack.get_first();
+            if (begin == end)
+                return pre->next;
+            Nodeptr res = alloc.Allocate();
+            Alnode_traits::construct(alloc, res, *begin++, pre, pre->next);
+            res->prev->next = res;
+            res->next->prev = res;
+
+            Nodeptr node = res;
+            pre = pre->next;
+            while (begin != end) {
+                node = alloc.Allocate();
+                Alnode_traits::construct(alloc, node, *begin++, pre, pre->next);
+
+                node->prev->next = node;
+                node->next->prev = node;
+
+                pre = pre->next;
+            }
+            return res;
+        }
+
+        Nodeptr Destroy_n(Nodeptr ptr, size_type n) {
+            Node_pool& alloc = val_pack.get_first();
+            Nodeptr pre = ptr->prev;
+            while (n--) {
+                pre->next = ptr->next;
+                Alnode_traits::destroy(alloc, ptr);
+                alloc.Deallocate(ptr);
+                ptr = pre->next;
+            }
+            ptr->prev = pre;
+            return ptr;
+        }
+
+        //销毁全部元素并归还slab; 启用节点池且元素无需析构时不必遍历链表
+        void Tidy() {
+            OCT_LIST_VAL_PACK_UNWRAP
+            if constexpr (SlabSize == 0 || !std::is_trivially_destructible_v<Node>)
+                Destroy_n(dummy.next, val_size);
+            alloc.Release();
+            dummy.next = dummy.prev = &dummy;
+            val_size = 0;
+        }
+
+        void Link_from(Nodeptr pre, Nodeptr node) {
+            node->next->prev = node->prev;
+            node->prev->next = node->next;
+
+            node->next = pre->next;
+            node->prev = pre;
+
+            node->prev->next = node;
+            node->next->prev = node;
+        }
+
+        void Link_from(Nodeptr pre, Nodeptr l, Nodeptr r) {
+            Nodeptr before_r = r->prev;
+
+            l->prev->next = r;
+            r->prev = l->prev;
+
+            before_r->next = pre->next;
+            before_r->next->prev = before_r;
+
+            pre->next = l;
+            l->prev = pre;
+        }
+
+        //以nullptr结尾的有序链(链首的prev指向链尾)接回哨兵
+        void Close_chain(Nodeptr head) noexcept {
+            Node& dummy = val_pack.second.dummy;
+            Nodeptr tail = head->prev;
+            head->prev = &dummy;
+            tail->next = &dummy;
+            dummy.next = head;
+            dummy.prev = tail;
+        }
+
+        //依次切下自然有序段放入桶中, 桶i中至少有2^i段, 新段与低位桶逐个归并后进位, 与二进制加一相同;
+        //64个桶足以容纳任意长度的链表, 最后由低到高把各桶归并起来
+        template <class Compare>
+        static Nodeptr Sort_chain(Nodeptr head, const Compare& comp) {
+            Nodeptr bins[64] = {};
+            size_type fill = 0;
+            while (head) {
+                Nodeptr run = Take_run(head, comp);
+                size_type i = 0;
+                for (; i < fill && bins[i]; i++) {
+                    run = Merge_chain(bins[i], run, comp);
+                    bins[i] = nullptr;
+                }
+                bins[i] = run;
+                if (i == fill)
+                    fill++;
+            }
+            Nodeptr res = nullptr;
+            for (size_type i = 0; i < fill; i++)
+                if (bins[i])
+                    res = Merge_chain(bins[i], res, comp);
+            return res;
+        }
+
+        //从head切下最长的非降段, 或最长的严格降段并原地翻转(严格降序翻转不破坏稳定性), head移到段后;
+        //非降段内部的prev保持原样即正确
+        template <class Compare>
+        static Nodeptr Take_run(Nodeptr& head, const Compare& comp) {
+            Nodeptr first = head;
+            Nodeptr last = head;
+            Nodeptr cur = head->next;
+            if (cur && comp(cur->val, first->val)) {
+                first->next = nullptr;
+                while (cur && comp(cur->val, first->val)) {
+                    Nodeptr next = cur->next;
+                    cur->next = first;
+                    first->prev = cur;
+                    first = cur;
+                    cur = next;
+                }
+            }
+            else {
+                while (cur && !comp(cur->val, last->val)) {
+                    last = cur;
+                    cur = cur->next;
+                }
+                last->next = nullptr;
+            }
+            first->prev = last;
+            head = cur;
+            return first;
+        }
+
+        //归并两条以nullptr结尾、链首prev指向链尾的有序链, 只有right严格更小时才取right, 保证稳定;
+        //prev在链接时顺手写入, 这些节点正被比较, 已在缓存中
+        template <class Compare>
+        static Nodeptr Merge_chain(Nodeptr left, Nodeptr right, const Compare& comp) {
+            if (!left)
+                return right;
+            if (!right)
+                return left;
+            Nodeptr left_tail = left->prev;
+            Nodeptr right_tail = right->prev;
+            Nodeptr head;
+            if (comp(right->val, left->val)) {
+                head = right;
+                right = right->next;
+            }
+            else {
+                head = left;
+                left = left->next;
+            }
+            Nodeptr tail = head;
+            while (left && right) {
+                if (comp(right->val, left->val)) {
+                    tail->next = right;
+                    right->prev = tail;
+                    tail = right;
+                    right = right->next;
+                }
+                else {
+                    tail->next = left;
+                    left->prev = tail;
+                    tail = left;
+                    left = left->next;
+                }
+            }
+            if (left) {
+                tail->next = left;
+                left->prev = tail;
+                tail = left_tail;
+            }
+            else {
+                tail->next = right;
+                right->prev = tail;
+                tail = right_tail;
+            }
+            head->prev = tail;
+            return head;
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid list size");
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid list iterator");
+        }
+    };
+
+    template <typename Ref, typename Ty, typename Allocator, std::size_t SlabSize>
+    list<Ty, Allocator, SlabSize>& operator>>(Ref&& elem, list<Ty, Allocator, SlabSize>& lst) {
+        lst.push_front(std::forward<Ref>(elem));
+        return lst;
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator==(const list<Ty1, Alloc1, Slab1>& left, const list<Ty2, Alloc2, Slab2>& right) noexcept {
+        if (!std::is_same_v<Ty1, Ty2> || left.size() != right.size())
+            return false;
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (!(*l == *r))
+                return false;
+        return true;
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator!=(const list<Ty1, Alloc1, Slab1>& left, const list<Ty2, Alloc2, Slab2>& right) noexcept {
+        return !(left == right);
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator<(const list<Ty1, Alloc1, Slab1>& left, const list<Ty2, Alloc2, Slab2>& right) noexcept {
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (*l == *r)
+                continue;
+            else return *l < *r;
+        return left.size() < right.size();
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator<=(const list<Ty1, Alloc1, Slab1>& left, const list<Ty2, Alloc2, Slab2>& right) noexcept {
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (*l == *r)
+                continue;
+            else return *l < *r;
+        return left.size() <= right.size();
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator>(const list<Ty1, Alloc1, Slab1>& left, const list<Ty2, Alloc2, Slab2>& right) noexcept {
+        return !(left <= right);
+    }
+
+    template <typename Ty1, typename Alloc1, std::size_t Slab1, typename Ty2, typename Alloc2, std::size_t Slab2>
+    bool operator>=(const list<Ty1, Alloc1, Slab1>& left, const list<Ty2, Alloc2, Slab2>& right) noexcept {
+        return !(left > right);
+    }
+}
+
 #endif // !OCT_LIST
\ No newline at end of file
@@ -0,0 +1,369 @@
+#pragma once
+
+#ifndef OCT_LRU_CACHE
+#define OCT_LRU_CACHE
+
+#include <cstdint>
+#include <utility>
+#include "unordered_map.hpp"
+#include "intrusive_list.hpp"
+#include "vector.hpp"
+
+namespace oct {
+    //不做准入过滤, 缓存即普通的LRU
+    struct lru_admission {
+        static constexpr bool windowed = false;
+
+        void Reset(size_t) {}
+
+        void Record(size_t) noexcept {}
+
+        bool Admit(size_t, size_t) const noexcept {
+            return true;
+        }
+    };
+
+    //TinyLFU准入: 以4位计数器的count-min sketch近似记录访问频率, 累计记录capacity * 10次后全部计数减半, 使旧的热度逐渐衰减
+    //窗口中被挤出的候选者只有比主区的淘汰对象访问更频繁时才被接纳, 一次性扫描的元素因此进不了主区
+    class tiny_lfu_admission {
+    public:
+        static constexpr bool windowed = true;
+
+    private:
+        vector<uint64_t> table;         //每个字保存16个计数器
+        size_t mask        = 0;         //计数器个数减一
+        size_t samples     = 0;
+        size_t sample_size = 0;
+
+    public:
+        void Reset(size_t capacity) {
+            size_t words = 1;
+            while (words < capacity)
+                words <<= 1;
+            table.assign(words, 0);
+            mask = words * 16 - 1;
+            samples = 0;
+            sample_size = capacity * 10;
+        }
+
+        void Record(size_t hash) noexcept {
+            bool added = false;
+            for (unsigned i = 0; i < 4; i++) {
+                size_t index = Index_of(hash, i);
+                uint64_t& word = table[index >> 4];
+                unsigned shift = static_cast<unsigned>(index & 15) << 2;
+                if (((word >> shift) & 0xF) != 0xF) {
+                    word += uint64_t(1) << shift;
+                    added = true;
+                }
+            }
+            if (added && ++samples >= sample_size)
+                Halve();
+        }
+
+        unsigned Frequency(size_t hash) const noexcept {
+            unsigned res = 0xF;
+            for (unsigned i = 0; i < 4; i++) {
+                size_t index = Index_of(hash, i);
+                unsigned count = static_cast<unsigned>(table[index >> 4] >> ((index & 15) << 2)) & 0xF;
+                res = count < res ? count : res;
+            }
+            return res;
+        }
+
+        bool Admit(size_t candidate, size_t victim) const noexcept {
+            return Frequency(candidate) > Frequency(victim);
+        }
+
+    private:
+        size_t Index_of(size_t hash, unsigned i) const noexcept {
+            static constexpr uint64_t seeds[4] = {
+                0xC3A5C85C97CB3127ull, 0xB492B66FBE98F273ull, 0x9AE16A3B2F90404Full, 0xCBF29CE484222325ull
+            };
+            return hash_mix(hash + static_cast<size_t>(seeds[i])) & mask;
+        }
+
+        void Halve() noexcept {
+            for (size_t i = 0; i < table.size(); i++)
+                table[i] = (table[i] >> 1) & 0x7777777777777777ull;
+            samples >>= 1;
+        }
+    };
+
+    //缓存元素: 链表挂钩与值一同存放在哈希表节点中
+    template <typename Ty>
+    struct lru_cache_entry : public intrusive_list_hook {
+        Ty value;
+        unsigned char segment = 0;
+
+        template <typename... Args>
+        lru_cache_entry(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...) {}
+    };
+
+    /*
+    * characteristics:
+    * [intrusive] 链表挂钩嵌在拉链哈希表的节点中, 每个元素只分配一次, get/put/evict都是O(1)
+    * [splice promotion] 命中时以intrusive_list::splice把元素移到所在链表头部, 不分配也不移动元素
+    * [W-TinyLFU] Admission为tiny_lfu_admission时按窗口LRU(1%)与分段LRU主区(probation/protected 20%/80%)组织,
+    *             窗口挤出的元素经频率草图比较后才能进入主区
+    */
+    template <
+        typename Key,
+        typename Ty,
+        class Hash         = std::hash<Key>,
+        class KeyEqual     = equal_to<Key>,
+        typename Allocator = allocator<Ty>,
+        class Admission    = lru_admission
+    >
+    class lru_cache {
+    private:    //内部类
+        using Entry = lru_cache_entry<Ty>;
+        using Table = unordered_map<Key, Entry, Hash, KeyEqual, Allocator, chained_table>;
+        using Value = typename Table::value_type;
+
+        struct Hook_traits {
+            using value_type = Value;
+            using hook_type  = intrusive_list_hook;
+
+            static intrusive_list_hook* To_hook(Value& value) noexcept {
+                return &value.second;
+            }
+
+            static Value* To_value(intrusive_list_hook* hook) noexcept {
+                return intrusive_member_hook<Value, Entry, &Value::second>::To_value(static_cast<Entry*>(hook));
+            }
+        };
+
+        using List = intrusive_list<Value, Hook_traits>;
+
+        enum Segment : unsigned char {
+            WINDOW, PROBATION, PROTECTED
+        };
+
+    public:     //统一接口
+        static_assert(std::is_object_v<Ty>, "lru_cache requires object types");
+
+        using key_type       = Key;
+        using mapped_type    = Ty;
+        using size_type      = size_t;
+        using hasher         = Hash;
+        using key_equal      = KeyEqual;
+        using allocator_type = Allocator;
+        using admission_type = Admission;
+
+    private:    //成员变量
+        Table table;
+        List lists[3];                  //非窗口模式下所有元素都在lists[WINDOW]中
+        Admission admission;
+        size_type val_capacity  = 0;
+        size_type window_cap    = 0;
+        size_type protected_cap = 0;
+        size_type hit_count     = 0;
+        size_type miss_count    = 0;
+        size_type evict_count   = 0;
+
+    public:     //成员函数
+        explicit lru_cache(size_type capacity, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : table(capacity + 1, hash, equal, alloc) {
+            Set_capacity(capacity);
+            admission.Reset(capacity);
+        }
+
+        lru_cache(const lru_cache&)            = delete;
+        lru_cache& operator=(const lru_cache&) = delete;
+
+        //命中时把元素提到最近使用的位置; 返回的指针在元素被淘汰或擦除前有效
+        mapped_type* get(const key_type& key) {
+            if constexpr (Admission::windowed)
+                admission.Record(Hash_of(key));
+            auto it = table.find(key);
+            if (it == table.end()) {
+                miss_count++;
+                return nullptr;
+            }
+            hit_count++;
+            Touch(*it);
+            return &(*it).second.value;
+        }
+
+        //不改变访问顺序, 也不计入命中统计
+        mapped_type* peek(const key_type& key) {
+            auto it = table.find(key);
+            return it == table.end() ? nullptr : &(*it).second.value;
+        }
+
+        bool contains(const key_type& key) const {
+            return table.count(key);
+        }
+
+        //关键字已存在时赋值并提到最近使用的位置, 否则插入新元素, 超出容量时淘汰一个元素
+        template <typename Mref>
+        mapped_type& put(const key_type& key, Mref&& value) {
+            return Put(key, std::forward<Mref>(value));
+        }
+
+        template <typename Mref>
+        mapped_type& put(key_type&& key, Mref&& value) {
+            return Put(std::move(key), std::forward<Mref>(value));
+        }
+
+        bool erase(const key_type& key) {
+            auto it = table.find(key);
+            if (it == table.end())
+                return false;
+            Value& elem = *it;
+            lists[elem.second.segment].erase(lists[elem.second.segment].iterator_to(elem));
+            table.erase(it);
+            return true;
+        }
+
+        //按当前策略淘汰一个元素: 依次取probation/protected/窗口的最久未使用者
+        bool evict() {
+            List* victims = &lists[PROBATION];
+            if (victims->empty())
+                victims = lists[PROTECTED].empty() ? &lists[WINDOW] : &lists[PROTECTED];
+            if (victims->empty())
+                return false;
+            Remove(victims->back());
+            return true;
+        }
+
+        void clear() {
+            for (List& list : lists)
+                list.clear();
+            table.clear();
+            admission.Reset(val_capacity);
+        }
+
+        size_type size() const noexcept {
+            return table.size();
+        }
+
+        bool empty() const noexcept {
+            return table.empty();
+        }
+
+        size_type capacity() const noexcept {
+            return val_capacity;
+        }
+
+        //缩小容量时立即淘汰多出的元素
+        void set_capacity(size_type capacity) {
+            Set_capacity(capacity);
+            admission.Reset(capacity);
+            while (size() > val_capacity)
+                evict();
+            while (lists[PROTECTED].size() > protected_cap)
+                Move(lists[PROTECTED].back(), PROBATION);
+            while (lists[WINDOW].size() > window_cap)
+                Move(lists[WINDOW].back(), PROBATION);
+        }
+
+        size_type hits() const noexcept {
+            return hit_count;
+        }
+
+        size_type misses() const noexcept {
+            return miss_count;
+        }
+
+        size_type evictions() const noexcept {
+            return evict_count;
+        }
+
+        double hit_ratio() const noexcept {
+            size_type total = hit_count + miss_count;
+            return total ? static_cast<double>(hit_count) / total : 0.0;
+        }
+
+        void reset_stats() noexcept {
+            hit_count = miss_count = evict_count = 0;
+        }
+
+    private:
+        size_t Hash_of(const key_type& key) const {
+            return hash_mix(table.hash_function()(key));
+        }
+
+        void Set_capacity(size_type capacity) {
+            if (!capacity)
+                Capacity_error();
+            val_capacity = capacity;
+            window_cap = Admission::windowed ? (capacity / 100 ? capacity / 100 : 1) : capacity;
+            protected_cap = (capacity - window_cap) * 4 / 5;
+        }
+
+        template <typename Kref, typename Mref>
+        mapped_type& Put(Kref&& key, Mref&& value) {
+            if constexpr (Admission::windowed)
+                admission.Record(Hash_of(key));
+            auto res = table.try_emplace(std::forward<Kref>(key), std::in_place, std::forward<Mref>(value));
+            Value& elem = *res.first;
+            if (!res.second) {
+                elem.second.value = std::forward<Mref>(value);
+                Touch(elem);
+                return elem.second.value;
+            }
+            elem.second.segment = WINDOW;
+            lists[WINDOW].push_front(elem);
+            if (lists[WINDOW].size() > window_cap)
+                Evict_window();
+            while (size() > val_capacity)
+                evict();
+            return elem.second.value;
+        }
+
+        void Touch(Value& elem) {
+            switch (elem.second.segment) {
+            case PROBATION:
+                Move(elem, PROTECTED);
+                if (lists[PROTECTED].size() > protected_cap)
+                    Move(lists[PROTECTED].back(), PROBATION);
+                break;
+            default:
+                Move(elem, static_cast<Segment>(elem.second.segment));
+            }
+        }
+
+        //移到to链表的头部
+        void Move(Value& elem, Segment to) noexcept {
+            List& from = lists[elem.second.segment];
+            lists[to].splice(lists[to].begin(), from, from.iterator_to(elem));
+            elem.second.segment = to;
+        }
+
+        //窗口溢出: 主区未满时直接进入probation, 否则与主区的淘汰对象比较频率, 败者被淘汰
+        void Evict_window() {
+            Value& candidate = lists[WINDOW].back();
+            size_type main_cap = val_capacity - window_cap;
+            if (!main_cap) {
+                Remove(candidate);
+                return;
+            }
+            if (lists[PROBATION].size() + lists[PROTECTED].size() < main_cap) {
+                Move(candidate, PROBATION);
+                return;
+            }
+            List& victims = lists[PROBATION].empty() ? lists[PROTECTED] : lists[PROBATION];
+            Value& victim = victims.back();
+            if (admission.Admit(Hash_of(candidate.first), Hash_of(victim.first))) {
+                Remove(victim);
+                Move(candidate, PROBATION);
+            }
+            else Remove(candidate);
+        }
+
+        void Remove(Value& elem) {
+            lists[elem.second.segment].erase(lists[elem.second.segment].iterator_to(elem));
+            table.erase(elem.first);
+            evict_count++;
+        }
+
+        [[noreturn]] static void Capacity_error() {
+            throw std::invalid_argument("lru_cache capacity must be positive");
+        }
+    };
+}
+
+#endif // !OCT_LRU_CACHE
\ No newline at end of file
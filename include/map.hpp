@@ -1,318 +1,460 @@
-#pragma once
-
-#ifndef OCT_MAP
-#define OCT_MAP
-
-#include "oct_tree.hpp"
-
-namespace oct {
-    template <typename Pair, typename Kcompare>
-    struct map_value_compare {
-        Kcompare kcomp;
-        bool operator()(const Pair& left, const Pair& right) {
-            return kcomp(left.first, right.first);
-        }
-    };
-
-    template <
-        typename Key,
-        typename Ty,
-        class Compare = less<Key>,
-        typename Allocator = allocator<Ty>,
-        template <typename, typename, typename, typename, typename>
-        typename Tree = red_black_tree
-    >
-    class map : public Tree<Key, pair<Key, Ty>, Compare, map_value_compare<pair<Key, Ty>, Compare>, Allocator> {
-    private:
-        using Base          = Tree<Key, pair<Key, Ty>, Compare, map_value_compare<pair<Key, Ty>, Compare>, Allocator>;
-        using Alty          = typename Base::Alty;
-        using Alty_traits   = typename Base::Alty_traits;
-        using Node          = typename Base::Node;
-        using Alnode        = typename Base::Alnode;
-        using Alnode_traits = typename Base::Alnode_traits;
-        using Nodeptr       = typename Base::Nodeptr;
-
-    public:
-        static_assert(std::is_object_v<Ty>, "map requires object types");
-
-        using key_type           = typename Base::key_type;
-        using value_type         = typename Base::value_type;
-        using size_type          = typename Base::size_type;
-        using difference_type    = typename Base::difference_type;
-        using key_compare        = typename Base::key_compare;
-        using value_compare      = typename Base::value_type;
-        using allocator_type     = typename Base::allocator_type;
-        using reference          = typename Base::reference;
-        using const_reference    = typename Base::const_reference;
-        using pointer            = typename Base::pointer;
-        using const_pointer      = typename Base::const_pointer;
-        using iterator           = typename Base::iterator;
-        using node_type          = typename Base::node_type;
-        using insert_return_type = typename Base::insert_return_type;
-
-    private:
-        friend typename iterator;
-
-    public:
-        map() : Base() {}
-
-        explicit map(const key_compare& comp, const allocator_type& alloc = allocator_type())
-            : Base(comp, alloc) {
-        }
-
-        explicit map(const allocator_type& alloc)
-            : Base(key_compare(), alloc) {
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        map(ForwardIt begin, ForwardIt end,
-            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
-            : Base(begin, end, comp, alloc) {
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        map(ForwardIt begin, ForwardIt end,
-            const allocator_type& alloc)
-            : Base(begin, end, alloc) {
-        }
-
-        map(const map& another, const allocator_type& alloc = allocator_type())
-            : Base(another.begin(), another.end()) {
-        }
-
-        map(map&& another, const allocator_type& alloc = allocator_type()) noexcept
-            : Base(std::move(another)) {
-        }
-
-        map(std::initializer_list<value_type> ini_list,
-            const key_compare& comp = key_compare(),
-            const allocator_type& alloc = allocator_type())
-            : Base(ini_list, comp, alloc) {
-        }
-
-        map(std::initializer_list<value_type> ini_list,
-            const allocator_type& alloc)
-            : Base(ini_list, alloc) {
-        }
-
-        ~map() {}
-
-        map& operator=(const map& another) {
-            if (this == &another)
-                return *this;
-            Base::operator=(another);
-            return *this;
-        }
-
-        map& operator=(map&& another) noexcept {
-            if (this == &another)
-                return *this;
-            Base::operator=(std::move(another));
-            return *this;
-        }
-
-        allocator_type get_allocator() const noexcept {
-            return Base::Get_allocator();
-        }
-
-        Ty& at(const key_type& key) {
-            iterator it = find(key);
-            if (it == end())
-                Key_error();
-            return it->Val();
-        }
-
-        Ty& operator[](const key_type& key) {
-            return Base::operator[](key).second;
-        }
-
-        iterator begin() const noexcept {
-            return Base::Begin();
-        }
-
-        iterator end() const noexcept {
-            return Base::End();
-        }
-
-        bool empty() const noexcept {
-            return Base::Empty();
-        }
-
-        size_type size() const noexcept {
-            return Base::Size();
-        }
-
-        void clear() {
-            Base::Clear();
-        }
-
-        insert_return_type insert(const_reference target) {
-            return Base::Insert(target);
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        void insert(ForwardIt begin, ForwardIt end) {
-            Base::Insert(begin, end);
-        }
-
-        void insert(std::initializer_list<value_type> ini_list) {
-            Base::Insert(ini_list);
-        }
-
-        iterator erase(iterator pos) {
-            return Base::Erase(pos);
-        }
-
-        iterator erase(iterator begin, iterator end) {
-            return Base::Erase(begin, end);
-        }
-
-        template <typename Ref>
-        size_type erase(Ref&& key) {
-            return Base::Erase(std::forward<Ref>(key));
-        }
-
-        void swap(map& another) noexcept {
-            Base::Swap(another);
-        }
-
-        template <typename Ref>
-        size_type count(Ref&& key) {
-            return Base::Count(std::forward<Ref>(key));
-        }
-
-        template <typename Ref>
-        iterator find(Ref&& key) {
-            return Base::Find(std::forward<Ref>(key));
-        }
-
-        template <typename Ref>
-        pair<iterator, iterator> equal_range(Ref&& key) {
-            return Base::Equal_range(std::forward<Ref>(key));
-        }
-
-        template <typename Ref>
-        iterator lower_bound(Ref&& key) {
-            return Base::Lower_bound(std::forward<Ref>(key));
-        }
-
-        template <typename Ref>
-        iterator upper_bound(Ref&& key) {
-            return Base::Upper_bound(std::forward<Ref>(key));
-        }
-
-        key_compare key_comp() const noexcept {
-            return Base::Key_compare();
-        }
-
-        value_compare value_comp() const noexcept {
-            return Base::Value_compare();
-        }
-
-        [[noreturn]] static void Key_error() {
-            throw std::out_of_range("invalid map key");
-        }
-    };
-
-    template <
-        typename Key,
-        typename Ty,
-        class Compare,
-        typename Allocator,
-        template <typename, typename, typename, typename, typename>
-        typename Tree
-    >
-    bool operator==(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
-        if (!std::is_same_v<Ty1, Ty2> || left.size() != right.size())
-            return false;
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (!(*l == *r))
-                return false;
-        return true;
-    }
-
-    template <
-        typename Key,
-        typename Ty,
-        class Compare,
-        typename Allocator,
-        template <typename, typename, typename, typename, typename>
-        typename Tree
-    >
-    bool operator!=(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
-        return !(left == right);
-    }
-
-    template <
-        typename Key,
-        typename Ty,
-        class Compare,
-        typename Allocator,
-        template <typename, typename, typename, typename, typename>
-    typename Tree
-    >
-    bool operator<(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (*l == *r)
-                continue;
-            else return *l < *r;
-        return left.size() < right.size();
-    }
-
-    template <
-        typename Key,
-        typename Ty,
-        class Compare,
-        typename Allocator,
-        template <typename, typename, typename, typename, typename>
-    typename Tree
-    >
-    bool operator<=(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
-        auto l = left.begin();
-        auto r = right.begin();
-        for (; l != left.end() && r != right.end(); l++, r++)
-            if (*l == *r)
-                continue;
-            else return *l < *r;
-        return left.size() <= right.size();
-    }
-
-    template <
-        typename Key,
-        typename Ty,
-        class Compare,
-        typename Allocator,
-        template <typename, typename, typename, typename, typename>
-    typename Tree
-    >
-    bool operator>(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
-        return !(left <= right);
-    }
-
-    template <
-        typename Key,
-        typename Ty,
-        class Compare,
-        typename Allocator,
-        template <typename, typename, typename, typename, typename>
-    typename Tree
-    >
-    bool operator>=(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
-        return !(left > right);
-    }
-
-    template<typename Key, typename Ty, typename Compare = std::less<Ty>, typename Alloc = oct::allocator<Ty>>
-    map(std::initializer_list<std::pair<Key, Ty>>) -> map<Key, Ty, Compare, Alloc>;
-
-    template<typename Key, typename Ty, typename Compare = std::less<Ty>, typename Alloc = oct::allocator<Ty>>
-    map(std::initializer_list<std::pair<Key, Ty>>, Compare) -> map<Key, Ty, Compare, Alloc>;
-
-    template<typename Key, typename Ty, typename Compare = std::less<Ty>, typename Alloc = oct::allocator<Ty>>
-    map(std::initializer_list<std::pair<Key, Ty>>, Compare, Alloc) -> map<Key, Ty, Compare, Alloc>;
-}
-
+#pragma once
+
+#ifndef OCT_MAP
+#define OCT_MAP
+
+#include "oct_tree.hpp"
+#include "oct_btree.hpp"
+
+namespace oct {
+    template <typename Pair, typename Kcompare>
+    struct map_value_compare {
+        Kcompare kcomp;
+        bool operator()(const Pair& left, const Pair& right) {
+            return kcomp(left.first, right.first);
+        }
+    };
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare = less<Key>,
+        typename Allocator = allocator<Ty>,
+        template <typename...>
+        typename Tree = red_black_tree
+    >
+    class map : public Tree<Key, pair<Key, Ty>, Compare, map_value_compare<pair<Key, Ty>, Compare>, Allocator> {
+    protected:
+        using Base          = Tree<Key, pair<Key, Ty>, Compare, map_value_compare<pair<Key, Ty>, Compare>, Allocator>;
+        using Alty          = typename Base::Alty;
+        using Alty_traits   = typename Base::Alty_traits;
+        using Node          = typename Base::Node;
+        using Alnode        = typename Base::Alnode;
+        using Alnode_traits = typename Base::Alnode_traits;
+        using Nodeptr       = typename Base::Nodeptr;
+
+    public:
+        static_assert(std::is_object_v<Ty>, "map requires object types");
+
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using key_compare        = typename Base::key_compare;
+        using value_compare      = typename Base::value_type;
+        using allocator_type     = typename Base::allocator_type;
+        using reference          = typename Base::reference;
+        using const_reference    = typename Base::const_reference;
+        using pointer            = typename Base::pointer;
+        using const_pointer      = typename Base::const_pointer;
+        using iterator           = typename Base::iterator;
+        using node_type          = typename Base::node_type;
+        using insert_return_type = typename Base::insert_return_type;
+
+    private:
+        friend typename iterator;
+
+    public:
+        map() : Base() {}
+
+        explicit map(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : Base(comp, alloc) {
+        }
+
+        explicit map(const allocator_type& alloc)
+            : Base(key_compare(), alloc) {
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        map(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : Base(begin, end, comp, alloc) {
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        map(ForwardIt begin, ForwardIt end,
+            const allocator_type& alloc)
+            : Base(begin, end, alloc) {
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        map(sorted_unique_t, ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : Base(sorted_unique, begin, end, comp, alloc) {}
+
+        map(const map& another, const allocator_type& alloc = allocator_type())
+            : Base(another.begin(), another.end()) {
+        }
+
+        map(map&& another, const allocator_type& alloc = allocator_type()) noexcept
+            : Base(std::move(another)) {
+        }
+
+        map(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : Base(ini_list, comp, alloc) {
+        }
+
+        map(std::initializer_list<value_type> ini_list,
+            const allocator_type& alloc)
+            : Base(ini_list, alloc) {
+        }
+
+        ~map() {}
+
+        map& operator=(const map& another) {
+            if (this == &another)
+                return *this;
+            Base::operator=(another);
+            return *this;
+        }
+
+        map& operator=(map&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Base::operator=(std::move(another));
+            return *this;
+        }
+
+        allocator_type get_allocator() const noexcept {
+            return Base::Get_allocator();
+        }
+
+        Ty& at(const key_type& key) {
+            iterator it = find(key);
+            if (it == end())
+                Key_error();
+            return (*it).second;
+        }
+
+        Ty& operator[](const key_type& key) {
+            return Base::operator[](key).second;
+        }
+
+        iterator begin() const noexcept {
+            return Base::Begin();
+        }
+
+        iterator end() const noexcept {
+            return Base::End();
+        }
+
+        bool empty() const noexcept {
+            return Base::Empty();
+        }
+
+        size_type size() const noexcept {
+            return Base::Size();
+        }
+
+        void clear() {
+            Base::Clear();
+        }
+
+        pair<iterator, bool> insert(const_reference target) {
+            return Base::Insert(target);
+        }
+
+        pair<iterator, bool> insert(value_type&& target) {
+            return Base::Emplace(std::move(target));
+        }
+
+        template <typename... Args>
+        pair<iterator, bool> emplace(Args&&... args) {
+            return Base::Emplace(std::forward<Args>(args)...);
+        }
+
+        //关键字已存在时什么也不做, args不会被移走; 否则以key和args原位构造元素
+        template <typename... Args>
+        pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+            return Base::Try_emplace(key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+            return Base::Try_emplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename Mref>
+        pair<iterator, bool> insert_or_assign(const key_type& key, Mref&& value) {
+            pair<iterator, bool> res = Base::Try_emplace(key, std::forward<Mref>(value));
+            if (!res.second)
+                (*res.first).second = std::forward<Mref>(value);
+            return res;
+        }
+
+        template <typename Mref>
+        pair<iterator, bool> insert_or_assign(key_type&& key, Mref&& value) {
+            pair<iterator, bool> res = Base::Try_emplace(std::move(key), std::forward<Mref>(value));
+            if (!res.second)
+                (*res.first).second = std::forward<Mref>(value);
+            return res;
+        }
+
+        iterator insert(iterator hint, const_reference target) {
+            return Base::Insert(hint, target);
+        }
+
+        template <typename... Args>
+        iterator emplace_hint(iterator hint, Args&&... args) {
+            return Base::Emplace_hint(hint, std::forward<Args>(args)...);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void insert(ForwardIt begin, ForwardIt end) {
+            Base::Insert(begin, end);
+        }
+
+        //输入按关键字升序时每个元素从上一次插入的位置出发查找, 整批只遍历树一次
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void insert_sorted(ForwardIt begin, ForwardIt end) {
+            Base::Insert_sorted(begin, end);
+        }
+
+        void insert(std::initializer_list<value_type> ini_list) {
+            Base::Insert(ini_list);
+        }
+
+        insert_return_type insert(node_type&& handle) {
+            return Base::Insert(std::move(handle));
+        }
+
+        iterator insert(iterator hint, node_type&& handle) {
+            return Base::Insert(hint, std::move(handle));
+        }
+
+        iterator erase(iterator pos) {
+            return Base::Erase(pos);
+        }
+
+        iterator erase(iterator begin, iterator end) {
+            return Base::Erase(begin, end);
+        }
+
+        template <typename Ref>
+        size_type erase(Ref&& key) {
+            return Base::Erase(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        void swap(map& another) noexcept {
+            Base::Swap(another);
+        }
+
+        //以下节点句柄操作在节点式后端上不分配内存也不移动元素, B+树后端不提供
+        node_type extract(iterator pos) {
+            return Base::Extract(pos);
+        }
+
+        template <typename Ref>
+        node_type extract(const Ref& key) {
+            return Base::Extract(lookup_key<key_type, key_compare>(key));
+        }
+
+        //source中关键字不重复的元素转入本容器, 其余留在source中
+        void merge(map& source) {
+            Base::Merge(source);
+        }
+
+        void merge(map&& source) {
+            Base::Merge(source);
+        }
+
+        //以下操作仅treap后端提供, another中的节点被直接接入本容器或销毁, 操作后another为空
+        map split(const key_type& key) {
+            map right(key_comp(), get_allocator());
+            Base::Split(key, right);
+            return right;
+        }
+
+        void join(map& right) {
+            Base::Join(right);
+        }
+
+        void set_union(map& another) {
+            Base::Union(another);
+        }
+
+        void set_intersection(map& another) {
+            Base::Intersection(another);
+        }
+
+        void set_difference(map& another) {
+            Base::Difference(another);
+        }
+
+        //以下操作要求Tree带有子树大小(order_statistic_*或treap后端), O(log n)
+        iterator find_by_order(size_type k) const {
+            return Base::Find_by_order(k);
+        }
+
+        template <typename Ref>
+        size_type order_of_key(const Ref& key) const {
+            return Base::Order_of_key(lookup_key<key_type, key_compare>(key));
+        }
+
+        template <typename Ref>
+        size_type count(Ref&& key) {
+            return Base::Count(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        size_type count(Ref&& key) const {
+            return Base::Count(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator find(Ref&& key) {
+            return Base::Find(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator find(Ref&& key) const {
+            return Base::Find(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> equal_range(Ref&& key) {
+            return Base::Equal_range(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> equal_range(Ref&& key) const {
+            return Base::Equal_range(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator lower_bound(Ref&& key) {
+            return Base::Lower_bound(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator lower_bound(Ref&& key) const {
+            return Base::Lower_bound(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator upper_bound(Ref&& key) {
+            return Base::Upper_bound(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator upper_bound(Ref&& key) const {
+            return Base::Upper_bound(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        key_compare key_comp() const noexcept {
+            return Base::Key_comp();
+        }
+
+        value_compare value_comp() const noexcept {
+            return Base::Value_compare();
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::out_of_range("invalid map key");
+        }
+    };
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare,
+        typename Allocator,
+        template <typename...>
+        typename Tree
+    >
+    bool operator==(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
+        if (!std::is_same_v<Ty1, Ty2> || left.size() != right.size())
+            return false;
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (!(*l == *r))
+                return false;
+        return true;
+    }
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare,
+        typename Allocator,
+        template <typename...>
+        typename Tree
+    >
+    bool operator!=(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
+        return !(left == right);
+    }
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare,
+        typename Allocator,
+        template <typename...>
+    typename Tree
+    >
+    bool operator<(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (*l == *r)
+                continue;
+            else return *l < *r;
+        return left.size() < right.size();
+    }
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare,
+        typename Allocator,
+        template <typename...>
+    typename Tree
+    >
+    bool operator<=(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (*l == *r)
+                continue;
+            else return *l < *r;
+        return left.size() <= right.size();
+    }
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare,
+        typename Allocator,
+        template <typename...>
+    typename Tree
+    >
+    bool operator>(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
+        return !(left <= right);
+    }
+
+    template <
+        typename Key,
+        typename Ty,
+        class Compare,
+        typename Allocator,
+        template <typename...>
+    typename Tree
+    >
+    bool operator>=(const map<Key, Ty, Compare, Allocator, Tree>& left, const map<Key, Ty, Compare, Allocator, Tree>& right) noexcept {
+        return !(left > right);
+    }
+
+    template<typename Key, typename Ty, typename Compare = std::less<Ty>, typename Alloc = oct::allocator<Ty>>
+    map(std::initializer_list<std::pair<Key, Ty>>) -> map<Key, Ty, Compare, Alloc>;
+
+    template<typename Key, typename Ty, typename Compare = std::less<Ty>, typename Alloc = oct::allocator<Ty>>
+    map(std::initializer_list<std::pair<Key, Ty>>, Compare) -> map<Key, Ty, Compare, Alloc>;
+
+    template<typename Key, typename Ty, typename Compare = std::less<Ty>, typename Alloc = oct::allocator<Ty>>
+    map(std::initializer_list<std::pair<Key, Ty>>, Compare, Alloc) -> map<Key, Ty, Compare, Alloc>;
+}
+
 #endif
\ No newline at end of file
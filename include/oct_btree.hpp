@@ -0,0 +1,921 @@
+#pragma once
+
+#ifndef OCT_BTREE
+#define OCT_BTREE
+
+#include <cstring>
+#include <functional>
+#include "utility.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OCT_BTREE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace oct {
+    inline constexpr std::size_t btree_node_bytes = 256;    //节点目标大小, 4条缓存行
+
+    //统计有序数组[first, first + n)中小于key(Upper为true时: 不大于key)的元素个数, 即lower_bound/upper_bound的下标
+    template <bool Upper, typename Ty>
+    std::size_t btree_rank(const Ty* first, std::size_t n, Ty key) noexcept {
+        std::size_t i = 0;
+#ifdef OCT_BTREE_SSE2
+        constexpr unsigned char bits[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+        if constexpr (std::is_integral_v<Ty> && std::is_signed_v<Ty> && sizeof(Ty) == 4) {
+            __m128i target = _mm_set1_epi32(static_cast<int>(key));
+            for (; i + 4 <= n; i += 4) {
+                __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+                int mask = Upper ? ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(cur, target))) & 0xF
+                                 : _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(cur, target)));
+                if (mask != 0xF)
+                    return i + bits[mask];
+            }
+        }
+        else if constexpr (std::is_same_v<Ty, float>) {
+            __m128 target = _mm_set1_ps(key);
+            for (; i + 4 <= n; i += 4) {
+                __m128 cur = _mm_loadu_ps(first + i);
+                int mask = _mm_movemask_ps(Upper ? _mm_cmple_ps(cur, target) : _mm_cmplt_ps(cur, target));
+                if (mask != 0xF)
+                    return i + bits[mask];
+            }
+        }
+        else if constexpr (std::is_same_v<Ty, double>) {
+            __m128d target = _mm_set1_pd(key);
+            for (; i + 2 <= n; i += 2) {
+                __m128d cur = _mm_loadu_pd(first + i);
+                int mask = _mm_movemask_pd(Upper ? _mm_cmple_pd(cur, target) : _mm_cmplt_pd(cur, target));
+                if (mask != 0x3)
+                    return i + bits[mask];
+            }
+        }
+#endif
+        std::size_t res = i;
+        for (; i < n; i++)                          //无分支计数, 便于编译器自动向量化
+            res += Upper ? !(key < first[i]) : first[i] < key;
+        return res;
+    }
+
+    struct btree_node_base {
+        std::size_t count;                          //叶子: 元素个数; 内部节点: 关键字个数
+    };
+
+    template <typename Ty>
+    struct btree_leaf : public btree_node_base {
+        using key_type   = key_of_v<Ty>;
+        using value_type = Ty;
+
+        using Nodeptr = btree_leaf*;
+
+        static constexpr std::size_t capacity =
+            (btree_node_bytes - sizeof(btree_node_base) - 2 * sizeof(Nodeptr)) / sizeof(Ty) > 4 ?
+            (btree_node_bytes - sizeof(btree_node_base) - 2 * sizeof(Nodeptr)) / sizeof(Ty) : 4;
+
+        Nodeptr prev;
+        Nodeptr next;
+        alignas(Ty) unsigned char buf[sizeof(Ty) * capacity];
+
+        btree_leaf() : btree_node_base{ 0 }, prev(nullptr), next(nullptr) {}
+
+        btree_leaf(const btree_leaf&)            = delete;
+        btree_leaf& operator=(const btree_leaf&) = delete;
+
+        value_type* Vals() noexcept {
+            return reinterpret_cast<value_type*>(buf);
+        }
+
+        value_type& Val(std::size_t pos) noexcept {
+            return Vals()[pos];
+        }
+
+        key_type& Key(std::size_t pos) noexcept {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return Val(pos);
+            else
+                return Val(pos).first;
+        }
+    };
+
+    template <typename Kty>
+    struct btree_inner : public btree_node_base {
+        using key_type = Kty;
+
+        static constexpr std::size_t capacity =
+            (btree_node_bytes - sizeof(btree_node_base) - sizeof(void*)) / (sizeof(Kty) + sizeof(void*)) > 4 ?
+            (btree_node_bytes - sizeof(btree_node_base) - sizeof(void*)) / (sizeof(Kty) + sizeof(void*)) : 4;
+
+        alignas(Kty) unsigned char buf[sizeof(Kty) * capacity];
+        btree_node_base* children[capacity + 1];    //keys[i]不大于children[i + 1]中的所有关键字, 且大于children[i]中的所有关键字
+
+        btree_inner() : btree_node_base{ 0 }, children() {}
+
+        btree_inner(const btree_inner&)            = delete;
+        btree_inner& operator=(const btree_inner&) = delete;
+
+        key_type* Keys() noexcept {
+            return reinterpret_cast<key_type*>(buf);
+        }
+
+        key_type& Key(std::size_t pos) noexcept {
+            return Keys()[pos];
+        }
+    };
+
+    template <typename Tree>
+    struct btree_val {
+        using size_type = typename Tree::size_type;
+        using Nodeptr   = typename Tree::Nodeptr;
+
+        btree_node_base* root;
+        Nodeptr first;                              //叶子按关键字顺序串成双向链表
+        Nodeptr last;
+        size_type height;                           //内部节点层数, 只有一个叶子时为0
+        size_type val_size;
+
+        btree_val()
+            : root(nullptr)
+            , first(nullptr)
+            , last(nullptr)
+            , height(0)
+            , val_size(0) {}
+
+        btree_val(btree_val&& another) noexcept : btree_val() {
+            operator=(std::move(another));
+        }
+
+        btree_val& operator=(btree_val&& another) noexcept {
+            if (this == &another)
+                return *this;
+            root = another.root;
+            first = another.first;
+            last = another.last;
+            height = another.height;
+            val_size = another.val_size;
+
+            another.root = nullptr;
+            another.first = another.last = nullptr;
+            another.height = another.val_size = 0;
+            return *this;
+        }
+    };
+
+#define OCT_BTREE_VAL_PACK_UNWRAP btree_node_base*& root       = val_pack.second.second.root;     \
+                                  Nodeptr&          first      = val_pack.second.second.first;    \
+                                  Nodeptr&          last       = val_pack.second.second.last;     \
+                                  size_type&        height     = val_pack.second.second.height;   \
+                                  key_compare&      kcomp      = val_pack.get_first();            \
+                                  size_type&        val_size   = val_pack.second.second.val_size; \
+                                  Alnode&           alloc      = val_pack.second.get_first();
+
+    //B+树: 元素只存放在叶子中, 内部节点存放关键字副本用于导航; 每个节点约btree_node_bytes字节
+    //插入和删除会在节点内移动元素, 使所有迭代器失效
+    template <
+        typename Kty,
+        typename Vty,
+        typename Kcompare,
+        typename Vcompare,
+        typename Allocator
+    >
+    class btree {
+    protected:
+        using Alty          = rebind_alloc_t<Allocator, Vty>;
+        using Alty_traits   = std::allocator_traits<Alty>;
+        using Node          = btree_leaf<Vty>;
+        using Alnode        = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+        using Inner         = btree_inner<Kty>;
+        using Alinner       = rebind_alloc_t<Allocator, Inner>;
+        using Alinner_traits= std::allocator_traits<Alinner>;
+
+    public:
+        using key_type           = Kty;
+        using value_type         = Vty;
+        using size_type          = typename Alty_traits::size_type;
+        using difference_type    = typename Alty_traits::difference_type;
+        using key_compare        = Kcompare;
+        using value_compare      = Vcompare;
+        using allocator_type     = Allocator;
+        using reference          = Vty&;
+        using const_reference    = const Vty&;
+        using pointer            = typename Alty_traits::pointer;
+        using const_pointer      = typename Alty_traits::const_pointer;
+
+        using iterator           = btree_iterator<btree>;
+        using node_type          = Node;
+        using insert_return_type = pair<iterator, bool>;
+
+        static_assert(std::is_copy_constructible_v<key_type>, "btree requires copy constructible keys");
+
+    private:
+        friend iterator;
+        friend struct btree_val<btree>;
+
+        static constexpr size_type leaf_capacity  = Node::capacity;
+        static constexpr size_type leaf_min       = Node::capacity / 2;
+        static constexpr size_type inner_capacity = Inner::capacity;
+        static constexpr size_type inner_min      = Inner::capacity / 2;
+        static constexpr size_type max_height     = 64;
+
+        struct Path_node {
+            Inner* node;
+            size_type index;                        //下降时经过的孩子下标
+        };
+
+    protected:
+        mutable compressed_pair<key_compare,
+                                compressed_pair<Alnode, btree_val<btree>>
+                               > val_pack;
+
+        btree() : val_pack(key_compare(), Alnode()) {}
+
+        explicit btree(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : val_pack(comp, alloc) {}
+
+        explicit btree(const allocator_type& alloc)
+            : val_pack(key_compare(), alloc) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        btree(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : btree(comp, alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        btree(ForwardIt begin, ForwardIt end,
+            const allocator_type& alloc)
+            : btree(alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        btree(sorted_unique_t, ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : btree(comp, alloc) {
+            Insert(begin, end);
+        }
+
+        btree(const btree& another, const allocator_type& alloc = allocator_type())
+            : btree(another.Begin(), another.End()) {}
+
+        btree(btree&& another, const allocator_type& alloc = allocator_type()) noexcept
+            : val_pack(std::move(another.val_pack)) {}
+
+        btree(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : btree(ini_list.begin(), ini_list.end(), comp, alloc) {}
+
+        btree(std::initializer_list<value_type> ini_list,
+            const allocator_type& alloc)
+            : btree(ini_list.begin(), ini_list.end(), alloc) {}
+
+        ~btree() {
+            Clear();
+        }
+
+        btree& operator=(const btree& another) {
+            if (this == &another)
+                return *this;
+            *this = btree(another);
+            return *this;
+        }
+
+        btree& operator=(btree&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Clear();
+            val_pack.second.second = std::move(another.val_pack.second.second);
+            return *this;
+        }
+
+        allocator_type Get_allocator() const noexcept {
+            return val_pack.second.get_first();
+        }
+
+        iterator Begin() const noexcept {
+            return iterator(val_pack.second.second.first, 0);
+        }
+
+        iterator End() const noexcept {
+            Nodeptr last = val_pack.second.second.last;
+            return last ? iterator(last, last->count) : iterator();
+        }
+
+        bool Empty() const noexcept {
+            return !val_pack.second.second.val_size;
+        }
+
+        size_type Size() const noexcept {
+            return val_pack.second.second.val_size;
+        }
+
+        void Clear() {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            if (root)
+                Tidy(root, height);
+            root = nullptr;
+            first = last = nullptr;
+            height = val_size = 0;
+        }
+
+        void Swap(btree& another) noexcept {
+            btree_val<btree> temp(std::move(val_pack.second.second));
+            val_pack.second.second = std::move(another.val_pack.second.second);
+            another.val_pack.second.second = std::move(temp);
+        }
+
+        key_compare Key_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+        reference operator[](const key_type& key) {
+            return *Try_emplace(key).first;
+        }
+
+        insert_return_type Insert(const_reference target) {
+            return Insert_unique(target);
+        }
+
+        //元素存放在叶子中, 先构造出元素再移动进叶子
+        template <typename... Args>
+        insert_return_type Emplace(Args&&... args) {
+            return Insert_unique(value_type(std::forward<Args>(args)...));
+        }
+
+        //关键字已存在时不构造元素
+        template <typename Kref, typename... Args>
+        insert_return_type Try_emplace(Kref&& key, Args&&... args) {
+            iterator pos = Find(key);
+            if (pos != End())
+                return insert_return_type(pos, false);
+            return Insert_unique(value_type(std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Kref>(key)), std::forward_as_tuple(std::forward<Args>(args)...)));
+        }
+
+        //target恰好落在hint之前且该叶子未满时直接放入叶子, 不必从根下降; 提示为end()即有序追加, 均摊O(1)
+        iterator Insert(iterator hint, const_reference target) {
+            return Insert_hint(hint, target);
+        }
+
+        //元素存放在叶子中, 先构造出元素再按提示插入
+        template <typename... Args>
+        iterator Emplace_hint(iterator hint, Args&&... args) {
+            return Insert_hint(hint, value_type(std::forward<Args>(args)...));
+        }
+
+        //有序输入以上一个元素之后的位置为提示, 落在同一叶子内的连续元素不必从根下降
+        template <typename ForwardIt>
+        void Insert_sorted(ForwardIt begin, ForwardIt end) {
+            iterator hint = End();
+            for (; begin != end; ++begin) {
+                iterator pos = Insert_hint(hint, *begin);
+                hint = iterator(pos.ptr, pos.index + 1);
+            }
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void Insert(ForwardIt begin, ForwardIt end) {
+            for (; begin != end; ++begin)
+                Insert(End(), *begin);
+        }
+
+        void Insert(std::initializer_list<value_type> ini_list) {
+            Insert(ini_list.begin(), ini_list.end());
+        }
+
+        iterator Erase(iterator pos) {
+            Nodeptr leaf = pos.ptr;
+            if (!leaf || pos.index >= leaf->count)
+                Iterator_error();
+            Path_node path[max_height];
+            if (Descend(leaf->Key(pos.index), path) != leaf)
+                Iterator_error();
+            return Erase_at(leaf, pos.index, path);
+        }
+
+        iterator Erase(iterator begin, iterator end) {
+            size_type count = 0;                        //删除会移动元素, 先数出个数再逐个删除
+            for (iterator cur = begin; cur != end; ++cur)
+                count++;
+            while (count--)
+                begin = Erase(begin);
+            return begin;
+        }
+
+        template <typename Ref>
+        size_type Erase(Ref&& key) {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            if (!root)
+                return 0;
+            Path_node path[max_height];
+            Nodeptr leaf = Descend(key, path);
+            size_type pos = Leaf_lower(leaf, key);
+            if (pos == leaf->count || kcomp(key, leaf->Key(pos)))
+                return 0;
+            Erase_at(leaf, pos, path);
+            return 1;
+        }
+
+        template <typename Ref>
+        size_type Count(Ref&& key) const {
+            return Find(std::forward<Ref>(key)) != End();
+        }
+
+        template <typename Ref>
+        iterator Find(Ref&& key) const {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            if (!root)
+                return End();
+            Nodeptr leaf = Descend(key, nullptr);
+            size_type pos = Leaf_lower(leaf, key);
+            if (pos == leaf->count || kcomp(key, leaf->Key(pos)))
+                return End();
+            return iterator(leaf, pos);
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> Equal_range(Ref&& key) const {
+            return pair<iterator, iterator>(Lower_bound(key), Upper_bound(key));
+        }
+
+        template <typename Ref>
+        iterator Lower_bound(Ref&& key) const {
+            if (!val_pack.second.second.root)
+                return End();
+            Nodeptr leaf = Descend(key, nullptr);
+            return Normalize(leaf, Leaf_lower(leaf, key));
+        }
+
+        template <typename Ref>
+        iterator Upper_bound(Ref&& key) const {
+            if (!val_pack.second.second.root)
+                return End();
+            Nodeptr leaf = Descend(key, nullptr);
+            return Normalize(leaf, Leaf_upper(leaf, key));
+        }
+
+        static const key_type& Key_of(const_reference val) {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val;
+            else
+                return val.first;
+        }
+
+    private:
+        //仅在比较器为less(含透明的less<>)且关键字与查找参数为同一算术类型时, 节点内使用SIMD线性查找; 否则使用二分查找
+        template <typename Ref>
+        static constexpr bool simd_search_v = std::is_arithmetic_v<key_type>
+            && std::is_same_v<std::remove_cv_t<std::remove_reference_t<Ref>>, key_type>
+            && (std::is_same_v<key_compare, less<key_type>> || std::is_same_v<key_compare, std::less<key_type>>
+             || std::is_same_v<key_compare, less<>> || std::is_same_v<key_compare, std::less<>>);
+
+        template <typename Ref>
+        size_type Leaf_lower(Nodeptr leaf, const Ref& key) const {
+            if constexpr (simd_search_v<Ref> && std::is_same_v<key_type, value_type>) {
+                return btree_rank<false>(leaf->Vals(), leaf->count, key);
+            }
+            else {
+                key_compare& kcomp = val_pack.get_first();
+                size_type low = 0, high = leaf->count;
+                while (low < high) {
+                    size_type mid = (low + high) >> 1;
+                    if (kcomp(leaf->Key(mid), key))
+                        low = mid + 1;
+                    else
+                        high = mid;
+                }
+                return low;
+            }
+        }
+
+        template <typename Ref>
+        size_type Leaf_upper(Nodeptr leaf, const Ref& key) const {
+            if constexpr (simd_search_v<Ref> && std::is_same_v<key_type, value_type>) {
+                return btree_rank<true>(leaf->Vals(), leaf->count, key);
+            }
+            else {
+                key_compare& kcomp = val_pack.get_first();
+                size_type low = 0, high = leaf->count;
+                while (low < high) {
+                    size_type mid = (low + high) >> 1;
+                    if (kcomp(key, leaf->Key(mid)))
+                        high = mid;
+                    else
+                        low = mid + 1;
+                }
+                return low;
+            }
+        }
+
+        template <typename Ref>
+        size_type Inner_upper(Inner* node, const Ref& key) const {
+            if constexpr (simd_search_v<Ref>) {
+                return btree_rank<true>(node->Keys(), node->count, key);
+            }
+            else {
+                key_compare& kcomp = val_pack.get_first();
+                size_type low = 0, high = node->count;
+                while (low < high) {
+                    size_type mid = (low + high) >> 1;
+                    if (kcomp(key, node->Key(mid)))
+                        high = mid;
+                    else
+                        low = mid + 1;
+                }
+                return low;
+            }
+        }
+
+        //从根下降到key所在的叶子, path非空时记录经过的内部节点
+        template <typename Ref>
+        Nodeptr Descend(const Ref& key, Path_node* path) const {
+            btree_node_base* node = val_pack.second.second.root;
+            size_type height = val_pack.second.second.height;
+            for (size_type depth = 0; depth < height; depth++) {
+                Inner* inner = static_cast<Inner*>(node);
+                size_type pos = Inner_upper(inner, key);
+                if (path)
+                    path[depth] = Path_node{ inner, pos };
+                node = inner->children[pos];
+            }
+            return static_cast<Nodeptr>(node);
+        }
+
+        //叶尾位置转为下一个叶子的开头, 最后一个叶子的叶尾即end()
+        static iterator Normalize(Nodeptr leaf, size_type pos) noexcept {
+            if (pos == leaf->count && leaf->next)
+                return iterator(leaf->next, 0);
+            return iterator(leaf, pos);
+        }
+
+        template <typename Ref>
+        iterator Insert_at(Nodeptr leaf, size_type pos, Path_node* path, Ref&& target) {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            if (leaf->count < leaf_capacity) {
+                Insert_value(leaf, pos, std::forward<Ref>(target));
+                return iterator(leaf, pos);
+            }
+
+            Nodeptr right = New_leaf();
+            size_type half = (leaf_capacity + 1) / 2;
+            iterator res;
+            if (pos == leaf_capacity && !leaf->next) {      //在末尾顺序追加时新叶子只放新元素, 使旧叶子保持满
+                Insert_value(right, 0, std::forward<Ref>(target));
+                res = iterator(right, 0);
+            }
+            else if (pos < half) {
+                Move_values(right->Vals(), leaf->Vals() + half - 1, leaf_capacity - half + 1);
+                right->count = leaf_capacity - half + 1;
+                leaf->count = half - 1;
+                Insert_value(leaf, pos, std::forward<Ref>(target));
+                res = iterator(leaf, pos);
+            }
+            else {
+                Move_values(right->Vals(), leaf->Vals() + half, leaf_capacity - half);
+                right->count = leaf_capacity - half;
+                leaf->count = half;
+                Insert_value(right, pos - half, std::forward<Ref>(target));
+                res = iterator(right, pos - half);
+            }
+
+            right->prev = leaf;
+            right->next = leaf->next;
+            if (leaf->next)
+                leaf->next->prev = right;
+            else
+                last = right;
+            leaf->next = right;
+            Insert_inner(path, height, leaf, key_type(right->Key(0)), right);
+            return res;
+        }
+
+        //把分裂出的right连同分隔关键字插入到left的父节点中, 父节点满时继续向上分裂
+        void Insert_inner(Path_node* path, size_type depth, btree_node_base* left, key_type&& sep, btree_node_base* right) {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            while (depth) {
+                Inner* node = path[depth - 1].node;
+                size_type pos = path[depth - 1].index;
+                if (node->count < inner_capacity) {
+                    Insert_key(node, pos, std::move(sep), right);
+                    return;
+                }
+
+                Inner* sibling = New_inner();
+                size_type half = (inner_capacity + 1) / 2;
+                key_type* keys = node->Keys();
+                if (pos < half) {
+                    key_type up(std::move(keys[half - 1]));
+                    Destroy(keys + half - 1);
+                    Move_keys(sibling, 0, node, half, inner_capacity - half);
+                    sibling->children[0] = node->children[half];
+                    sibling->count = inner_capacity - half;
+                    node->count = half - 1;
+                    Insert_key(node, pos, std::move(sep), right);
+                    sep = std::move(up);
+                }
+                else if (pos == half) {
+                    Move_keys(sibling, 0, node, half, inner_capacity - half);
+                    sibling->children[0] = right;
+                    sibling->count = inner_capacity - half;
+                    node->count = half;
+                }
+                else {
+                    key_type up(std::move(keys[half]));
+                    Destroy(keys + half);
+                    Move_keys(sibling, 0, node, half + 1, inner_capacity - half - 1);
+                    sibling->children[0] = node->children[half + 1];
+                    sibling->count = inner_capacity - half - 1;
+                    node->count = half;
+                    Insert_key(sibling, pos - half - 1, std::move(sep), right);
+                    sep = std::move(up);
+                }
+                left = node;
+                right = sibling;
+                depth--;
+            }
+
+            Inner* new_root = New_inner();                  //根分裂, 树长高一层
+            Construct(new_root->Keys(), std::move(sep));
+            new_root->children[0] = left;
+            new_root->children[1] = right;
+            new_root->count = 1;
+            root = new_root;
+            height++;
+        }
+
+        iterator Erase_at(Nodeptr leaf, size_type pos, Path_node* path) {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            Erase_value(leaf, pos);
+            val_size--;
+            if (!height) {
+                if (!leaf->count) {
+                    Free_leaf(leaf);
+                    root = nullptr;
+                    first = last = nullptr;
+                    return iterator();
+                }
+                return Normalize(leaf, pos);
+            }
+            if (leaf->count >= leaf_min)
+                return Normalize(leaf, pos);
+
+            //叶子不足半满: 先向兄弟借一个元素, 借不到则与兄弟合并; pos随元素移动一起修正
+            Inner* parent = path[height - 1].node;
+            size_type index = path[height - 1].index;
+            Nodeptr left = index ? static_cast<Nodeptr>(parent->children[index - 1]) : nullptr;
+            Nodeptr right = index < parent->count ? static_cast<Nodeptr>(parent->children[index + 1]) : nullptr;
+            if (left && left->count > leaf_min) {
+                Insert_value(leaf, 0, std::move(left->Val(left->count - 1)));
+                Erase_value(left, left->count - 1);
+                parent->Key(index - 1) = leaf->Key(0);
+                pos++;
+            }
+            else if (right && right->count > leaf_min) {
+                Insert_value(leaf, leaf->count, std::move(right->Val(0)));
+                Erase_value(right, 0);
+                parent->Key(index) = right->Key(0);
+            }
+            else if (left) {
+                pos += left->count;
+                Merge_leaf(left, leaf);
+                leaf = left;
+                Erase_inner(path, height - 1, index - 1);
+            }
+            else {
+                Merge_leaf(leaf, right);
+                Erase_inner(path, height - 1, index);
+            }
+            return Normalize(leaf, pos);
+        }
+
+        //删除path[depth]节点中的关键字pos与孩子pos + 1, 节点不足半满时向上借或合并
+        void Erase_inner(Path_node* path, size_type depth, size_type pos) {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            while (true) {
+                Inner* node = path[depth].node;
+                key_type* keys = node->Keys();
+                Destroy(keys + pos);
+                Move_keys(node, pos, node, pos + 1, node->count - pos - 1);
+                node->count--;
+                if (!depth) {
+                    if (!node->count) {                     //根只剩一个孩子, 树降低一层
+                        root = node->children[0];
+                        height--;
+                        Free_inner(node);
+                    }
+                    return;
+                }
+                if (node->count >= inner_min)
+                    return;
+
+                Inner* parent = path[depth - 1].node;
+                size_type index = path[depth - 1].index;
+                Inner* left = index ? static_cast<Inner*>(parent->children[index - 1]) : nullptr;
+                Inner* right = index < parent->count ? static_cast<Inner*>(parent->children[index + 1]) : nullptr;
+                if (left && left->count > inner_min) {      //经父节点右旋
+                    btree_node_base* child = left->children[left->count];
+                    Insert_key(node, 0, std::move(parent->Key(index - 1)), node->children[0]);
+                    node->children[0] = child;
+                    parent->Key(index - 1) = std::move(left->Key(left->count - 1));
+                    Destroy(left->Keys() + left->count - 1);
+                    left->count--;
+                    return;
+                }
+                if (right && right->count > inner_min) {    //经父节点左旋
+                    Insert_key(node, node->count, std::move(parent->Key(index)), right->children[0]);
+                    parent->Key(index) = std::move(right->Key(0));
+                    Destroy(right->Keys());
+                    right->children[0] = right->children[1];
+                    Move_keys(right, 0, right, 1, right->count - 1);
+                    right->count--;
+                    return;
+                }
+                if (left) {
+                    Merge_inner(left, std::move(parent->Key(index - 1)), node);
+                    pos = index - 1;
+                }
+                else {
+                    Merge_inner(node, std::move(parent->Key(index)), right);
+                    pos = index;
+                }
+                depth--;
+            }
+        }
+
+        void Merge_leaf(Nodeptr left, Nodeptr right) {
+            Move_values(left->Vals() + left->count, right->Vals(), right->count);
+            left->count += right->count;
+            left->next = right->next;
+            if (right->next)
+                right->next->prev = left;
+            else
+                val_pack.second.second.last = left;
+            Free_leaf(right);
+        }
+
+        void Merge_inner(Inner* left, key_type&& sep, Inner* right) {
+            Construct(left->Keys() + left->count, std::move(sep));
+            left->children[left->count + 1] = right->children[0];
+            Move_keys(left, left->count + 1, right, 0, right->count);
+            left->count += right->count + 1;
+            Free_inner(right);
+        }
+
+        //pos为叶尾时要求叶子是最后一个: 与后继叶子之间的分隔关键字可能小于后继叶子现存的首个关键字
+        template <typename Ref>
+        iterator Insert_hint(iterator hint, Ref&& target) {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            Nodeptr leaf = hint.ptr;
+            size_type pos = hint.index;
+            const key_type& key = Key_of(target);
+            if (leaf && pos > 0 && pos <= leaf->count && leaf->count < leaf_capacity
+                && kcomp(leaf->Key(pos - 1), key)
+                && (pos < leaf->count ? kcomp(key, leaf->Key(pos)) : !leaf->next)) {
+                Insert_value(leaf, pos, std::forward<Ref>(target));
+                val_size++;
+                return iterator(leaf, pos);
+            }
+            return Insert_unique(std::forward<Ref>(target)).first;
+        }
+
+        template <typename Ref>
+        insert_return_type Insert_unique(Ref&& target) {
+            OCT_BTREE_VAL_PACK_UNWRAP
+            if (!root) {
+                Nodeptr leaf = New_leaf();
+                Construct(leaf->Vals(), std::forward<Ref>(target));
+                leaf->count = 1;
+                root = first = last = leaf;
+                val_size = 1;
+                return insert_return_type(iterator(leaf, 0), true);
+            }
+            const key_type& key = Key_of(target);
+            Path_node path[max_height];
+            Nodeptr leaf = Descend(key, path);
+            size_type pos = Leaf_lower(leaf, key);
+            if (pos < leaf->count && !kcomp(key, leaf->Key(pos)))
+                return insert_return_type(iterator(leaf, pos), false);
+            iterator res = Insert_at(leaf, pos, path, std::forward<Ref>(target));
+            val_size++;
+            return insert_return_type(res, true);
+        }
+
+        template <typename Ref>
+        void Insert_value(Nodeptr leaf, size_type pos, Ref&& target) {
+            value_type* vals = leaf->Vals();
+            Shift(vals + pos, leaf->count - pos, 1);
+            Construct(vals + pos, std::forward<Ref>(target));
+            leaf->count++;
+        }
+
+        void Erase_value(Nodeptr leaf, size_type pos) {
+            value_type* vals = leaf->Vals();
+            Destroy(vals + pos);
+            Move_values(vals + pos, vals + pos + 1, leaf->count - pos - 1);
+            leaf->count--;
+        }
+
+        //keys[pos]处插入key, 其右侧孩子为child
+        void Insert_key(Inner* node, size_type pos, key_type&& key, btree_node_base* child) {
+            key_type* keys = node->Keys();
+            Shift(keys + pos, node->count - pos, 1);
+            Construct(keys + pos, std::move(key));
+            std::memmove(node->children + pos + 2, node->children + pos + 1, sizeof(btree_node_base*) * (node->count - pos));
+            node->children[pos + 1] = child;
+            node->count++;
+        }
+
+        //把from的关键字[from_pos, from_pos + n)及其右侧孩子移到to的to_pos处(目标区间需已空出)
+        void Move_keys(Inner* to, size_type to_pos, Inner* from, size_type from_pos, size_type n) {
+            Move_values(to->Keys() + to_pos, from->Keys() + from_pos, n);
+            std::memmove(to->children + to_pos + 1, from->children + from_pos + 1, sizeof(btree_node_base*) * n);
+        }
+
+        //把[from, from + n)移动构造到dest处并析构原对象, 区间可重叠
+        template <typename Ty>
+        void Move_values(Ty* dest, Ty* from, size_type n) {
+            if constexpr (std::is_trivially_copyable_v<Ty>) {
+                std::memmove(static_cast<void*>(dest), static_cast<void*>(from), sizeof(Ty) * n);
+            }
+            else if (dest < from) {
+                for (size_type i = 0; i < n; i++) {
+                    Construct(dest + i, std::move(from[i]));
+                    Destroy(from + i);
+                }
+            }
+            else {
+                for (size_type i = n; i; i--) {
+                    Construct(dest + i - 1, std::move(from[i - 1]));
+                    Destroy(from + i - 1);
+                }
+            }
+        }
+
+        template <typename Ty>
+        void Shift(Ty* from, size_type n, size_type offset) {
+            Move_values(from + offset, from, n);
+        }
+
+        template <typename Ty, typename... Args>
+        void Construct(Ty* ptr, Args&&... args) {
+            rebind_alloc_t<Allocator, Ty> al(val_pack.second.get_first());
+            std::allocator_traits<rebind_alloc_t<Allocator, Ty>>::construct(al, ptr, std::forward<Args>(args)...);
+        }
+
+        template <typename Ty>
+        void Destroy(Ty* ptr) {
+            rebind_alloc_t<Allocator, Ty> al(val_pack.second.get_first());
+            std::allocator_traits<rebind_alloc_t<Allocator, Ty>>::destroy(al, ptr);
+        }
+
+        Nodeptr New_leaf() {
+            Alnode& alloc = val_pack.second.get_first();
+            Nodeptr leaf = Alnode_traits::allocate(alloc, 1);
+            Alnode_traits::construct(alloc, leaf);
+            return leaf;
+        }
+
+        Inner* New_inner() {
+            Alinner alloc(val_pack.second.get_first());
+            Inner* node = Alinner_traits::allocate(alloc, 1);
+            Alinner_traits::construct(alloc, node);
+            return node;
+        }
+
+        void Free_leaf(Nodeptr leaf) {
+            Alnode& alloc = val_pack.second.get_first();
+            Alnode_traits::destroy(alloc, leaf);
+            Alnode_traits::deallocate(alloc, leaf, 1);
+        }
+
+        void Free_inner(Inner* node) {
+            Alinner alloc(val_pack.second.get_first());
+            Alinner_traits::destroy(alloc, node);
+            Alinner_traits::deallocate(alloc, node, 1);
+        }
+
+        void Tidy(btree_node_base* node, size_type level) {
+            if (!level) {
+                Nodeptr leaf = static_cast<Nodeptr>(node);
+                for (size_type i = 0; i < leaf->count; i++)
+                    Destroy(leaf->Vals() + i);
+                Free_leaf(leaf);
+                return;
+            }
+            Inner* inner = static_cast<Inner*>(node);
+            for (size_type i = 0; i <= inner->count; i++)
+                Tidy(inner->children[i], level - 1);
+            for (size_type i = 0; i < inner->count; i++)
+                Destroy(inner->Keys() + i);
+            Free_inner(inner);
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid map iterator");
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,595 @@
+#pragma once
+
+#ifndef OCT_CHAINED_TABLE
+#define OCT_CHAINED_TABLE
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include "utility.hpp"
+
+namespace oct {
+    template <typename Ty>
+    struct chained_table_node {
+        using value_type = Ty;
+
+        using Nodeptr = chained_table_node*;
+
+        Nodeptr next;
+        size_t hash;        //缓存混合后的哈希值, 重新分桶和查找时比较都不必再调用哈希函数
+        value_type val;
+
+        template <typename... Args>
+        chained_table_node(std::in_place_t, Args&&... args)
+            : next(nullptr), hash(0), val(std::forward<Args>(args)...) {}
+
+        chained_table_node(const chained_table_node&)            = delete;
+        chained_table_node& operator=(const chained_table_node&) = delete;
+    };
+
+    template <typename Table>
+    struct chained_table_val {
+        using size_type = typename Table::size_type;
+        using Nodeptr   = typename Table::Nodeptr;
+        using Linkptr   = typename Table::Linkptr;
+
+        Nodeptr head;               //单链表的首节点
+        Linkptr* buckets;           //非空桶保存指向其首节点的那个指针(head或前一节点的next)的地址, 空桶为nullptr
+        size_type bucket_count;     //0或2的幂
+        size_type val_size;
+        float max_load;
+
+        chained_table_val()
+            : head(nullptr)
+            , buckets(nullptr)
+            , bucket_count(0)
+            , val_size(0)
+            , max_load(1.0f) {}
+
+        chained_table_val(chained_table_val&& another) noexcept : chained_table_val() {
+            operator=(std::move(another));
+        }
+
+        //首节点所在的桶指向的是head本身, 搬移后必须改指向新的head
+        chained_table_val& operator=(chained_table_val&& another) noexcept {
+            if (this == &another)
+                return *this;
+            head = another.head;
+            buckets = another.buckets;
+            bucket_count = another.bucket_count;
+            val_size = another.val_size;
+            max_load = another.max_load;
+            if (head)
+                buckets[head->hash & (bucket_count - 1)] = &head;
+
+            another.head = nullptr;
+            another.buckets = nullptr;
+            another.bucket_count = another.val_size = 0;
+            return *this;
+        }
+    };
+
+#define OCT_CHAINED_TABLE_VAL_PACK_UNWRAP Nodeptr&   head         = val_pack.second.second.second.head;         \
+                                          Linkptr*&  buckets      = val_pack.second.second.second.buckets;      \
+                                          size_type& bucket_count = val_pack.second.second.second.bucket_count; \
+                                          size_type& val_size     = val_pack.second.second.second.val_size;     \
+                                          float&     max_load     = val_pack.second.second.second.max_load;     \
+                                          Alnode&    alloc        = val_pack.second.second.get_first();
+
+    //拉链法哈希表: 每个元素单独分配节点, 插入与重新分桶都只改指针, 元素的指针与引用在擦除前始终有效
+    //所有节点串成一条单链表, 同一个桶的节点相邻, 桶数组只记录进入该桶的位置; 节点缓存哈希值
+    template <
+        typename Kty,
+        typename Vty,
+        typename Hash,
+        typename KeyEqual,
+        typename Allocator
+    >
+    class chained_table {
+    protected:
+        using Alty            = rebind_alloc_t<Allocator, Vty>;
+        using Alty_traits     = std::allocator_traits<Alty>;
+        using Node            = chained_table_node<Vty>;
+        using Alnode          = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits   = std::allocator_traits<Alnode>;
+        using Nodeptr         = typename Alnode_traits::pointer;
+        using Linkptr         = Nodeptr*;
+        using Albucket        = rebind_alloc_t<Allocator, Linkptr>;
+        using Albucket_traits = std::allocator_traits<Albucket>;
+
+    public:
+        using key_type           = Kty;
+        using value_type         = Vty;
+        using size_type          = typename Alty_traits::size_type;
+        using difference_type    = typename Alty_traits::difference_type;
+        using hasher             = Hash;
+        using key_equal          = KeyEqual;
+        using allocator_type     = Allocator;
+        using reference          = Vty&;
+        using const_reference    = const Vty&;
+        using pointer            = typename Alty_traits::pointer;
+        using const_pointer      = typename Alty_traits::const_pointer;
+
+        using iterator           = chained_table_iterator<chained_table>;
+        using local_iterator     = chained_table_local_iterator<chained_table>;
+        using insert_return_type = pair<iterator, bool>;
+
+    private:
+        friend iterator;
+        friend local_iterator;
+        friend struct chained_table_val<chained_table>;
+
+        static constexpr size_type min_bucket_count = 8;
+
+    protected:
+        mutable compressed_pair<hasher,
+                                compressed_pair<key_equal,
+                                                compressed_pair<Alnode, chained_table_val<chained_table>>
+                                               >
+                               > val_pack;
+
+        chained_table() : val_pack(hasher(), key_equal(), Alnode()) {}
+
+        explicit chained_table(size_type bucket_count, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : val_pack(hash, equal, alloc) {
+            Rehash(bucket_count);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        chained_table(ForwardIt begin, ForwardIt end, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : chained_table(bucket_count, hash, equal, alloc) {
+            Insert(begin, end);
+        }
+
+        chained_table(const chained_table& another)
+            : val_pack(another.val_pack.get_first(), another.val_pack.second.get_first(), another.val_pack.second.second.get_first()) {
+            Copy_from(another);
+        }
+
+        chained_table(chained_table&& another) noexcept
+            : val_pack(std::move(another.val_pack)) {}
+
+        chained_table(std::initializer_list<value_type> ini_list, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : chained_table(ini_list.begin(), ini_list.end(), bucket_count, hash, equal, alloc) {}
+
+        ~chained_table() {
+            Tidy();
+        }
+
+        chained_table& operator=(const chained_table& another) {
+            if (this == &another)
+                return *this;
+            *this = chained_table(another);
+            return *this;
+        }
+
+        chained_table& operator=(chained_table&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Tidy();
+            val_pack.get_first() = std::move(another.val_pack.get_first());
+            val_pack.second.get_first() = std::move(another.val_pack.second.get_first());
+            val_pack.second.second.second = std::move(another.val_pack.second.second.second);
+            return *this;
+        }
+
+        allocator_type Get_allocator() const noexcept {
+            return val_pack.second.second.get_first();
+        }
+
+        iterator Begin() const noexcept {
+            return iterator(val_pack.second.second.second.head);
+        }
+
+        iterator End() const noexcept {
+            return iterator();
+        }
+
+        local_iterator Begin(size_type n) const noexcept {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            if (!bucket_count || !buckets[n])
+                return End(n);
+            return local_iterator(*buckets[n], n, bucket_count - 1);
+        }
+
+        local_iterator End(size_type n) const noexcept {
+            return local_iterator(nullptr, n, Bucket_count() - 1);
+        }
+
+        bool Empty() const noexcept {
+            return !val_pack.second.second.second.val_size;
+        }
+
+        size_type Size() const noexcept {
+            return val_pack.second.second.second.val_size;
+        }
+
+        //保留桶数组, 只释放节点
+        void Clear() {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            Free_nodes(head);
+            head = nullptr;
+            if (buckets)
+                std::memset(buckets, 0, bucket_count * sizeof(Linkptr));
+            val_size = 0;
+        }
+
+        void Swap(chained_table& another) noexcept {
+            std::swap(val_pack.get_first(), another.val_pack.get_first());
+            std::swap(val_pack.second.get_first(), another.val_pack.second.get_first());
+            chained_table_val<chained_table> temp(std::move(val_pack.second.second.second));
+            val_pack.second.second.second = std::move(another.val_pack.second.second.second);
+            another.val_pack.second.second.second = std::move(temp);
+        }
+
+        hasher Hash_function() const {
+            return val_pack.get_first();
+        }
+
+        key_equal Key_eq() const {
+            return val_pack.second.get_first();
+        }
+
+        reference operator[](const key_type& key) {
+            return *Try_emplace(key).first;
+        }
+
+        insert_return_type Insert(const_reference target) {
+            return Emplace(target);
+        }
+
+        iterator Insert(iterator hint, const_reference target) {
+            return Emplace(target).first;
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void Insert(ForwardIt begin, ForwardIt end) {
+            Reserve(Size() + std::distance(begin, end));
+            for (; begin != end; ++begin)
+                Emplace(*begin);
+        }
+
+        void Insert(std::initializer_list<value_type> ini_list) {
+            Insert(ini_list.begin(), ini_list.end());
+        }
+
+        //先在节点内原位构造元素, 关键字已存在时再销毁节点
+        template <typename... Args>
+        insert_return_type Emplace(Args&&... args) {
+            Nodeptr node = Construct_node(std::forward<Args>(args)...);
+            node->hash = Hash_of(Key_of(node->val));
+            Nodeptr pos = Find_node(Key_of(node->val), node->hash);
+            if (pos) {
+                Destroy_node(node);
+                return insert_return_type(iterator(pos), false);
+            }
+            return insert_return_type(iterator(Insert_node(node)), true);
+        }
+
+        template <typename... Args>
+        iterator Emplace_hint(iterator hint, Args&&... args) {
+            return Emplace(std::forward<Args>(args)...).first;
+        }
+
+        //关键字已存在时不构造节点
+        template <typename Kref, typename... Args>
+        insert_return_type Try_emplace(Kref&& key, Args&&... args) {
+            size_t hash = Hash_of(key);
+            Nodeptr pos = Find_node(key, hash);
+            if (pos)
+                return insert_return_type(iterator(pos), false);
+            Nodeptr node = Construct_node(std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Kref>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+            node->hash = hash;
+            return insert_return_type(iterator(Insert_node(node)), true);
+        }
+
+        iterator Erase(iterator pos) {
+            if (!pos.node)
+                Iterator_error();
+            Nodeptr next = pos.node->next;
+            Unlink(pos.node);
+            Destroy_node(pos.node);
+            return iterator(next);
+        }
+
+        iterator Erase(iterator begin, iterator end) {
+            while (begin != end)
+                begin = Erase(begin);
+            return end;
+        }
+
+        template <typename Ref>
+        size_type Erase(const Ref& key) {
+            Nodeptr pos = Find_node(key, Hash_of(key));
+            if (!pos)
+                return 0;
+            Unlink(pos);
+            Destroy_node(pos);
+            return 1;
+        }
+
+        template <typename Ref>
+        iterator Find(const Ref& key) const {
+            if (Empty())
+                return End();
+            return iterator(Find_node(key, Hash_of(key)));
+        }
+
+        template <typename Ref>
+        size_type Count(const Ref& key) const {
+            return Find(key) != End();
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> Equal_range(const Ref& key) const {
+            iterator pos = Find(key);
+            if (pos == End())
+                return pair<iterator, iterator>(pos, pos);
+            iterator next = pos;
+            return pair<iterator, iterator>(pos, ++next);
+        }
+
+        size_type Bucket_count() const noexcept {
+            return val_pack.second.second.second.bucket_count;
+        }
+
+        size_type Max_bucket_count() const noexcept {
+            Albucket albucket(val_pack.second.second.get_first());
+            return Albucket_traits::max_size(albucket);
+        }
+
+        //桶数组尚未分配时所有关键字都归入0号桶
+        template <typename Ref>
+        size_type Bucket(const Ref& key) const {
+            size_type bucket_count = Bucket_count();
+            return bucket_count ? Hash_of(key) & (bucket_count - 1) : 0;
+        }
+
+        size_type Bucket_size(size_type n) const noexcept {
+            size_type count = 0;
+            for (local_iterator it = Begin(n), end = End(n); it != end; ++it)
+                count++;
+            return count;
+        }
+
+        float Load_factor() const noexcept {
+            size_type bucket_count = Bucket_count();
+            return bucket_count ? static_cast<float>(Size()) / static_cast<float>(bucket_count) : 0.0f;
+        }
+
+        float Max_load_factor() const noexcept {
+            return val_pack.second.second.second.max_load;
+        }
+
+        //调小后若已超出新的负载上限则立即重新分桶
+        void Max_load_factor(float ml) {
+            if (!(ml > 0.0f))
+                Load_factor_error();
+            val_pack.second.second.second.max_load = ml;
+            Reserve(Size());
+        }
+
+        //至少容纳count个元素而不重新分桶
+        void Reserve(size_type count) {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            size_type need = Buckets_for(count);
+            if (need > bucket_count)
+                Rebucket(need);
+        }
+
+        //桶数调整为不小于max(count, 容纳现有元素所需)的2的幂; 节点不动, 只重新串链
+        void Rehash(size_type count) {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            if (!count && !val_size) {
+                Tidy();
+                return;
+            }
+            size_type need = Buckets_for(val_size);
+            size_type target = Normalize(count > need ? count : need);
+            if (target != bucket_count)
+                Rebucket(target);
+        }
+
+        static const key_type& Key_of(const_reference val) {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val;
+            else
+                return val.first;
+        }
+
+    private:
+        //不小于count的2的幂, 至少为min_bucket_count
+        static size_type Normalize(size_type count) noexcept {
+            size_type bucket_count = min_bucket_count;
+            while (bucket_count < count)
+                bucket_count <<= 1;
+            return bucket_count;
+        }
+
+        size_type Buckets_for(size_type count) const {
+            if (!count)
+                return 0;
+            return Normalize(static_cast<size_type>(std::ceil(count / Max_load_factor())));
+        }
+
+        template <typename Ref>
+        size_t Hash_of(const Ref& key) const {
+            return hash_mix(val_pack.get_first()(key));
+        }
+
+        size_type Index_of(Nodeptr node) const noexcept {
+            return node->hash & (Bucket_count() - 1);
+        }
+
+        //先比较缓存的哈希值, 相同时才调用判等函数
+        template <typename Ref>
+        Nodeptr Find_node(const Ref& key, size_t hash) const {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            if (!bucket_count)
+                return nullptr;
+            size_type index = hash & (bucket_count - 1);
+            if (!buckets[index])
+                return nullptr;
+            key_equal& kequal = val_pack.second.get_first();
+            for (Nodeptr node = *buckets[index]; node && Index_of(node) == index; node = node->next)
+                if (node->hash == hash && kequal(Key_of(node->val), key))
+                    return node;
+            return nullptr;
+        }
+
+        //node的哈希值已写好; 必要时先扩充桶数组, 节点地址不变
+        Nodeptr Insert_node(Nodeptr node) {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            if (val_size + 1 > bucket_count * max_load) {
+                size_type need = Buckets_for(val_size + 1);
+                try {
+                    Rebucket(need > bucket_count * 2 ? need : bucket_count * 2);
+                }
+                catch (...) {
+                    Destroy_node(node);
+                    throw;
+                }
+            }
+            Link(node);
+            val_size++;
+            return node;
+        }
+
+        //插到所在桶的开头; 空桶则插到整条链表的开头, 原首节点所在的桶改为从node->next进入
+        void Link(Nodeptr node) {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            size_type index = Index_of(node);
+            if (buckets[index]) {
+                node->next = *buckets[index];
+                *buckets[index] = node;
+            }
+            else {
+                node->next = head;
+                head = node;
+                if (node->next)
+                    buckets[Index_of(node->next)] = &node->next;
+                buckets[index] = &head;
+            }
+        }
+
+        //摘下节点后, 后继若属于别的桶则该桶改从原先指向node的位置进入; node是本桶唯一节点时本桶置空
+        void Unlink(Nodeptr node) {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            size_type index = Index_of(node);
+            Linkptr link = buckets[index];
+            while (*link != node)
+                link = &(*link)->next;
+            Nodeptr next = node->next;
+            bool last = !next || Index_of(next) != index;
+            if (next && last)
+                buckets[Index_of(next)] = link;
+            if (link == buckets[index] && last)
+                buckets[index] = nullptr;
+            *link = next;
+            val_size--;
+        }
+
+        //用缓存的哈希值把节点逐个串进新的桶数组
+        void Rebucket(size_type new_count) {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            Albucket albucket(alloc);
+            Linkptr* new_buckets = Albucket_traits::allocate(albucket, new_count);
+            std::memset(new_buckets, 0, new_count * sizeof(Linkptr));
+            if (buckets)
+                Albucket_traits::deallocate(albucket, buckets, bucket_count);
+            buckets = new_buckets;
+            bucket_count = new_count;
+            Nodeptr node = head;
+            head = nullptr;
+            while (node) {
+                Nodeptr next = node->next;
+                Link(node);
+                node = next;
+            }
+        }
+
+        template <typename... Args>
+        Nodeptr Construct_node(Args&&... args) {
+            Alnode& alloc = val_pack.second.second.get_first();
+            Nodeptr node = Alnode_traits::allocate(alloc, 1);
+            try {
+                Alnode_traits::construct(alloc, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Alnode_traits::deallocate(alloc, node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        void Destroy_node(Nodeptr node) {
+            Alnode& alloc = val_pack.second.second.get_first();
+            Alnode_traits::destroy(alloc, node);
+            Alnode_traits::deallocate(alloc, node, 1);
+        }
+
+        void Free_nodes(Nodeptr node) {
+            while (node) {
+                Nodeptr next = node->next;
+                Destroy_node(node);
+                node = next;
+            }
+        }
+
+        //桶数相同, 按原顺序复制节点并沿用缓存的哈希值, 各桶的进入位置与原表一致
+        void Copy_from(const chained_table& another) {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            const chained_table_val<chained_table>& source = another.val_pack.second.second.second;
+            max_load = source.max_load;
+            if (!source.val_size)
+                return;
+            Albucket albucket(alloc);
+            buckets = Albucket_traits::allocate(albucket, source.bucket_count);
+            std::memset(buckets, 0, source.bucket_count * sizeof(Linkptr));
+            bucket_count = source.bucket_count;
+            Linkptr tail = &head;
+            try {
+                for (Nodeptr from = source.head; from; from = from->next) {
+                    Nodeptr node = Construct_node(from->val);
+                    node->hash = from->hash;
+                    size_type index = Index_of(node);
+                    if (!buckets[index])
+                        buckets[index] = tail;
+                    *tail = node;
+                    tail = &node->next;
+                    val_size++;
+                }
+            }
+            catch (...) {
+                Tidy();
+                throw;
+            }
+        }
+
+        void Tidy() {
+            OCT_CHAINED_TABLE_VAL_PACK_UNWRAP
+            Free_nodes(head);
+            head = nullptr;
+            if (buckets) {
+                Albucket albucket(alloc);
+                Albucket_traits::deallocate(albucket, buckets, bucket_count);
+            }
+            buckets = nullptr;
+            bucket_count = val_size = 0;
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid chained_table iterator");
+        }
+
+        [[noreturn]] static void Load_factor_error() {
+            throw std::invalid_argument("max_load_factor must be positive");
+        }
+    };
+}
+
+#endif // !OCT_CHAINED_TABLE
\ No newline at end of file
@@ -1,438 +1,1060 @@
-#pragma once
-
-#ifndef OCT_ITERATOR
-#define OCT_ITERATOR
-
-#include <iterator>
-#include <type_traits>
-
-namespace oct {
-
-#ifndef OCT_FORWARD_LIST_ITERATOR
-#define OCT_FORWARD_LIST_ITERATOR
-
-    template <typename Flist>
-    class forward_list_iterator {
-    public:
-        using iterator_category = std::forward_iterator_tag;
-        using value_type        = typename Flist::value_type;
-        using difference_type   = typename Flist::difference_type;
-        using pointer           = typename Flist::pointer;
-        using reference         = value_type&;
-
-    private:
-        friend Flist;
-        using Iter    = forward_list_iterator;
-        using Nodeptr = typename Flist::Nodeptr;
-
-        Nodeptr ptr;
-
-    public:
-        forward_list_iterator(Nodeptr p = nullptr) : ptr(p) {}
-
-        Iter& operator=(const Iter& another) noexcept {
-            ptr = another.ptr;
-            return *this;
-        }
-
-        reference operator*() const {
-            return ptr->val;
-        }
-
-        Nodeptr operator->() const {
-            return ptr;
-        }
-
-        Iter& operator++() noexcept {
-            ptr = ptr->next;
-            return *this;
-        }
-
-        Iter operator++(int) noexcept {
-            Iter temp = *this;
-            ptr = ptr->next;
-            return temp;
-        }
-
-        bool operator==(const Iter& another) const noexcept {
-            return ptr == another.ptr;
-        }
-
-        bool operator!=(const Iter& another) const noexcept {
-            return ptr != another.ptr;
-        }
-    };
-
-#endif // !OCT_FORWARD_LIST_ITERATOR
-
-#ifndef OCT_LIST_ITERATOR
-#define OCT_LIST_ITERATOR
-
-    template <typename List>
-    class list_iterator {
-    public:
-        using iterator_category = std::bidirectional_iterator_tag;
-        using value_type        = typename List::value_type;
-        using difference_type   = typename List::difference_type;
-        using pointer           = typename List::pointer;
-        using reference         = value_type&;
-
-    private:
-        friend List;
-        using Iter = list_iterator;
-        using Nodeptr = typename List::Nodeptr;
-
-        Nodeptr ptr;
-
-    public:
-        list_iterator(Nodeptr p = nullptr) : ptr(p) {}
-
-        Iter& operator=(const Iter& another) noexcept {
-            ptr = another.ptr;
-            return *this;
-        }
-
-        reference operator*() const {
-            return ptr->val;
-        }
-
-        Nodeptr operator->() const {
-            return ptr;
-        }
-
-        Iter& operator++() noexcept {
-            ptr = ptr->next;
-            return *this;
-        }
-
-        Iter operator++(int) noexcept {
-            Iter temp = *this;
-            ptr = ptr->next;
-            return temp;
-        }
-
-        Iter& operator--() noexcept {
-            ptr = ptr->prev;
-            return *this;
-        }
-
-        Iter operator--(int) noexcept {
-            Iter temp = *this;
-            ptr = ptr->prev;
-            return temp;
-        }
-
-        bool operator==(const Iter& another) const noexcept {
-            return ptr == another.ptr;
-        }
-
-        bool operator!=(const Iter& another) const noexcept {
-            return ptr != another.ptr;
-        }
-    };
-
-#endif // !OCT_LIST_ITERATOR
-
-#ifndef OCT_TREE_ITERATOR
-#define OCT_TREE_ITERATOR
-
-    template <typename Tree>
-    class tree_iterator {
-    public:
-        using iterator_category = std::bidirectional_iterator_tag;
-        using value_type        = typename Tree::value_type;
-        using difference_type   = typename Tree::difference_type;
-        using pointer           = typename Tree::pointer;
-        using reference         = value_type&;
-
-    private:
-        friend Tree;
-        using Iter    = tree_iterator;
-        using Nodeptr = typename Tree::Nodeptr;
-
-        Nodeptr ptr;
-
-    public:
-        tree_iterator(Nodeptr ptr = nullptr) : ptr(ptr) {}
-
-        Iter& operator=(const Iter& another) noexcept {
-            ptr = another.ptr;
-            return *this;
-        }
-
-        reference operator*() const {
-            return ptr->val;
-        }
-
-        Nodeptr operator->() const {
-            return ptr;
-        }
-
-        Iter& operator++() noexcept {
-            ptr = ptr->Next_node();
-            return *this;
-        }
-
-        Iter operator++(int) noexcept {
-            Iter temp = *this;
-            ptr = ptr->Next_node();
-            return temp;
-        }
-
-        Iter& operator--() noexcept {
-            ptr = ptr->Prev_node();
-            return *this;
-        }
-
-        Iter operator--(int) noexcept {
-            Iter temp = *this;
-            ptr = ptr->Prev_node();
-            return temp;
-        }
-
-        bool operator==(const Iter& another) const noexcept {
-            return ptr == another.ptr;
-        }
-
-        bool operator!=(const Iter& another) const noexcept {
-            return ptr != another.ptr;
-        }
-    };
-
-#endif // !OCT_TREE_ITERATOR
-
-#ifndef OCT_DEQUE_ITERATOR
-#define OCT_DEQUE_ITERATOR
-
-    template <typename Deq>
-    class deque_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using value_type        = typename Deq::value_type;
-        using difference_type   = typename Deq::difference_type;
-        using pointer           = typename Deq::pointer;
-        using reference         = value_type&;
-
-    private:
-        friend Deq;
-        using Iter                = deque_iterator;
-        using Mapptr              = typename Deq::Mapptr;
-        using Deqptr              = const Deq* const;
-        using Map_difference_type = typename Deq::Map_difference_type;
-        using size_type           = typename Deq::size_type;
-
-        static constexpr size_type buf_size = Deq::buf_size;
-
-        Deqptr cont_ptr;
-        size_type offset;
-
-    public:
-        deque_iterator(Deqptr cont_ptr, size_type offset = 0) : cont_ptr(cont_ptr), offset(offset) {}
-
-        Iter& operator=(const Iter& another) noexcept {
-            if (cont_ptr != another.cont_ptr)
-                Logic_error();
-            offset = another.offset;
-            return *this;
-        }
-
-        reference operator*() const noexcept {
-            return *(cont_ptr->Visit(offset));
-        }
-
-        reference operator[](difference_type n) const noexcept {
-            return *(cont_ptr->Visit(offset + n));
-        }
-
-        pointer operator->() const noexcept {
-            return cont_ptr->Visit(offset);
-        }
-
-        Iter& operator++() noexcept {
-            ++offset;
-            return *this;
-        }
-
-        Iter operator++(int) noexcept {
-            Iter temp = *this;
-            offset++;
-            return temp;
-        }
-
-        Iter& operator--() noexcept {
-            --offset;
-            return *this;
-        }
-
-        Iter operator--(int) noexcept {
-            Iter temp = *this;
-            offset--;
-            return temp;
-        }
-
-        Iter& operator+=(difference_type n) noexcept {
-            offset += n;
-            return *this;
-        }
-
-        Iter& operator-=(difference_type n) noexcept {
-            offset -= n;
-            return *this;
-        }
-
-        Iter operator+(difference_type n) const noexcept {
-            return Iter(cont_ptr, offset + n);
-        }
-
-        Iter operator-(difference_type n) const noexcept {
-            return Iter(cont_ptr, offset - n);
-        }
-
-        difference_type operator-(const Iter& another) const noexcept {
-            return offset - another.offset;
-        }
-
-        bool operator==(const Iter& another) const noexcept {
-            return cont_ptr == another.cont_ptr && offset == another.offset;
-        }
-
-        bool operator!=(const Iter& another) const noexcept {
-            return cont_ptr != another.cont_ptr || offset != another.offset;
-        }
-
-        bool operator<(const Iter& another) const noexcept {
-            return offset - another.offset < 0;
-        }
-
-        bool operator<=(const Iter& another) const noexcept {
-            return offset - another.offset <= 0;
-        }
-
-        bool operator>(const Iter& another) const noexcept {continuous_memory_iterator
-            return offset - another.offset > 0;
-        }
-
-        bool operator>=(const Iter& another) const noexcept {
-            return offset - another.offset >= 0;
-        }
-
-        private:
-            [[noreturn]] static void Logic_error() {
-                throw std::logic_error("iterator can't from different deque");
-            }
-    };
-
-#endif // !OCT_DEQUE_ITERATOR
-
-#ifndef OCT_CONTINUOUS_MEMORY_ITERATOR
-#define OCT_CONTINUOUS_MEMORY_ITERATOR
-
-    template <typename Container>
-    class continuous_memory_iterator {
-    public:
-        using iterator_category = std::random_access_iterator_tag;
-        using value_type        = typename Container::value_type;
-        using difference_type   = typename Container::difference_type;
-        using pointer           = typename Container::pointer;
-        using reference         = value_type&;
-
-    private:
-        friend Container;
-        using Iter = continuous_memory_iterator;
-
-        pointer ptr;
-
-    public:
-        continuous_memory_iterator(pointer p = nullptr) :ptr(p) {}
-
-        Iter& operator=(const Iter& another) noexcept {
-            ptr = another.ptr;
-            return *this;
-        }
-
-        reference operator*() const noexcept {
-            return *ptr;
-        }
-
-        reference operator[](difference_type n) const noexcept {
-            return ptr[n];
-        }
-
-        pointer operator->() const noexcept {
-            return ptr;
-        }
-
-        Iter& operator++() noexcept {
-            ++ptr;
-            return *this;
-        }
-
-        Iter operator++(int) noexcept {
-            Iter temp = *this;
-            ptr++;
-            return temp;
-        }
-
-        Iter& operator--() noexcept {
-            --ptr;
-            return *this;
-        }
-
-        Iter operator--(int) noexcept {
-            Iter temp = *this;
-            ptr--;
-            return temp;
-        }
-
-        Iter& operator+=(difference_type n) noexcept {
-            ptr += n;
-            return *this;
-        }
-
-        Iter& operator-=(difference_type n) noexcept {
-            ptr -= n;
-            return *this;
-        }
-
-        Iter operator+(difference_type n) const noexcept {
-            return Iter(ptr + n);
-        }
-
-        Iter operator-(difference_type n) const noexcept {
-            return Iter(ptr - n);
-        }
-
-        difference_type operator-(const Iter& another) const noexcept {
-            return ptr - another.ptr;
-        }
-
-        bool operator==(const Iter& another) const noexcept {
-            return ptr == another.ptr;
-        }
-
-        bool operator!=(const Iter& another) const noexcept {
-            return ptr != another.ptr;
-        }
-
-        bool operator<(const Iter& another) const noexcept {
-            return another.ptr - ptr > 0;
-        }
-
-        bool operator<=(const Iter& another) const noexcept {
-            return another.ptr - ptr >= 0;
-        }
-
-        bool operator>(const Iter& another) const noexcept {
-            return another.ptr - ptr < 0;
-        }
-
-        bool operator>=(const Iter& another) const noexcept {
-            return another.ptr - ptr <= 0;
-        }
-    };
-
-#endif // !OCT_CONTINUOUS_MEMORY_ITERATOR
-
-}
-
+#pragma once
+
+#ifndef OCT_ITERATOR
+#define OCT_ITERATOR
+
+#include <iterator>
+#include <type_traits>
+
+namespace oct {
+
+#ifndef OCT_FORWARD_LIST_ITERATOR
+#define OCT_FORWARD_LIST_ITERATOR
+
+    template <typename Flist>
+    class forward_list_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename Flist::value_type;
+        using difference_type   = typename Flist::difference_type;
+        using pointer           = typename Flist::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Flist;
+        using Iter    = forward_list_iterator;
+        using Nodeptr = typename Flist::Nodeptr;
+
+        Nodeptr ptr;
+
+    public:
+        forward_list_iterator(Nodeptr p = nullptr) : ptr(p) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ptr = another.ptr;
+            return *this;
+        }
+
+        reference operator*() const {
+            return ptr->val;
+        }
+
+        Nodeptr operator->() const {
+            return ptr;
+        }
+
+        Iter& operator++() noexcept {
+            ptr = ptr->next;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ptr = ptr->next;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ptr == another.ptr;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return ptr != another.ptr;
+        }
+    };
+
+#endif // !OCT_FORWARD_LIST_ITERATOR
+
+#ifndef OCT_LIST_ITERATOR
+#define OCT_LIST_ITERATOR
+
+    template <typename List>
+    class list_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename List::value_type;
+        using difference_type   = typename List::difference_type;
+        using pointer           = typename List::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend List;
+        using Iter = list_iterator;
+        using Nodeptr = typename List::Nodeptr;
+
+        Nodeptr ptr;
+
+    public:
+        list_iterator(Nodeptr p = nullptr) : ptr(p) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ptr = another.ptr;
+            return *this;
+        }
+
+        reference operator*() const {
+            return ptr->val;
+        }
+
+        Nodeptr operator->() const {
+            return ptr;
+        }
+
+        Iter& operator++() noexcept {
+            ptr = ptr->next;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ptr = ptr->next;
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            ptr = ptr->prev;
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            ptr = ptr->prev;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ptr == another.ptr;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return ptr != another.ptr;
+        }
+    };
+
+#endif // !OCT_LIST_ITERATOR
+
+#ifndef OCT_UNROLLED_LIST_ITERATOR
+#define OCT_UNROLLED_LIST_ITERATOR
+
+    //保存当前元素与所在节点的尾后指针, 节点内前进只比较指针, 不必每步读取节点; end()的cur为空
+    template <typename List>
+    class unrolled_list_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename List::value_type;
+        using difference_type   = typename List::difference_type;
+        using pointer           = typename List::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend List;
+        using Iter    = unrolled_list_iterator;
+        using Baseptr = typename List::Baseptr;
+        using Nodeptr = typename List::Nodeptr;
+
+        Baseptr node;
+        pointer cur;
+        pointer last;
+
+    public:
+        unrolled_list_iterator(Baseptr node = nullptr, pointer cur = nullptr, pointer last = nullptr)
+            : node(node), cur(cur), last(last) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            node = another.node;
+            cur = another.cur;
+            last = another.last;
+            return *this;
+        }
+
+        reference operator*() const {
+            return *cur;
+        }
+
+        pointer operator->() const {
+            return cur;
+        }
+
+        Iter& operator++() noexcept {
+            if (++cur == last) {
+                node = node->next;
+                if (node->count) {
+                    cur = static_cast<Nodeptr>(node)->Vals();
+                    last = cur + node->count;
+                }
+                else cur = last = nullptr;
+            }
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            if (!cur || cur == static_cast<Nodeptr>(node)->Vals()) {
+                node = node->prev;
+                last = static_cast<Nodeptr>(node)->Vals() + node->count;
+                cur = last;
+            }
+            --cur;
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            --*this;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return cur == another.cur;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return !(*this == another);
+        }
+    };
+
+#endif // !OCT_UNROLLED_LIST_ITERATOR
+
+#ifndef OCT_TREE_ITERATOR
+#define OCT_TREE_ITERATOR
+
+    template <typename Tree>
+    class tree_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename Tree::value_type;
+        using difference_type   = typename Tree::difference_type;
+        using pointer           = typename Tree::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Tree;
+        using Iter    = tree_iterator;
+        using Nodeptr = typename Tree::Nodeptr;
+
+        Nodeptr ptr;
+
+    public:
+        tree_iterator(Nodeptr ptr = nullptr) : ptr(ptr) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ptr = another.ptr;
+            return *this;
+        }
+
+        reference operator*() const {
+            return ptr->val;
+        }
+
+        Nodeptr operator->() const {
+            return ptr;
+        }
+
+        Iter& operator++() noexcept {
+            ptr = ptr->Next_node();
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ptr = ptr->Next_node();
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            ptr = ptr->Prev_node();
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            ptr = ptr->Prev_node();
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ptr == another.ptr;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return ptr != another.ptr;
+        }
+
+        //通过ADL调用distance(first, last): 树带有子树大小时为O(log n), 否则逐个遍历
+        friend difference_type distance(const Iter& first, const Iter& last) noexcept {
+            return first.Distance_to(last);
+        }
+
+    private:
+        difference_type Distance_to(const Iter& last) const noexcept {
+            return Tree::Distance(ptr, last.ptr);
+        }
+    };
+
+#endif // !OCT_TREE_ITERATOR
+
+#ifndef OCT_BTREE_ITERATOR
+#define OCT_BTREE_ITERATOR
+
+    template <typename Tree>
+    class btree_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename Tree::value_type;
+        using difference_type   = typename Tree::difference_type;
+        using pointer           = typename Tree::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Tree;
+        using Iter      = btree_iterator;
+        using Nodeptr   = typename Tree::Nodeptr;
+        using size_type = typename Tree::size_type;
+
+        Nodeptr ptr;        //所在叶子, 空树时为nullptr
+        size_type index;    //叶内下标, end()为(最后一个叶子, 叶子元素个数)
+
+    public:
+        btree_iterator(Nodeptr ptr = nullptr, size_type index = 0) : ptr(ptr), index(index) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ptr = another.ptr;
+            index = another.index;
+            return *this;
+        }
+
+        reference operator*() const {
+            return ptr->Val(index);
+        }
+
+        pointer operator->() const {
+            return &ptr->Val(index);
+        }
+
+        Iter& operator++() noexcept {
+            if (++index == ptr->count && ptr->next) {
+                ptr = ptr->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            if (!index) {
+                ptr = ptr->prev;
+                index = ptr->count;
+            }
+            index--;
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            --*this;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ptr == another.ptr && index == another.index;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return !(*this == another);
+        }
+    };
+
+#endif // !OCT_BTREE_ITERATOR
+
+#ifndef OCT_SWISS_TABLE_ITERATOR
+#define OCT_SWISS_TABLE_ITERATOR
+
+    template <typename Table>
+    class swiss_table_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename Table::value_type;
+        using difference_type   = typename Table::difference_type;
+        using pointer           = typename Table::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Table;
+        using Iter    = swiss_table_iterator;
+        using Ctrlptr = typename Table::Ctrlptr;
+
+        Ctrlptr ctrl;       //槽位的控制字节, end()指向控制字节数组末尾的哨兵
+        pointer slot;
+
+    public:
+        swiss_table_iterator(Ctrlptr ctrl = nullptr, pointer slot = nullptr) : ctrl(ctrl), slot(slot) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ctrl = another.ctrl;
+            slot = another.slot;
+            return *this;
+        }
+
+        reference operator*() const {
+            return *slot;
+        }
+
+        pointer operator->() const {
+            return slot;
+        }
+
+        Iter& operator++() noexcept {
+            ++ctrl;
+            ++slot;
+            Skip_empty();
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ctrl == another.ctrl;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return !(*this == another);
+        }
+
+    private:
+        void Skip_empty() noexcept {
+            while (Table::Is_empty_or_deleted(*ctrl)) {
+                ++ctrl;
+                ++slot;
+            }
+        }
+    };
+
+#endif // !OCT_SWISS_TABLE_ITERATOR
+
+#ifndef OCT_CHAINED_TABLE_ITERATOR
+#define OCT_CHAINED_TABLE_ITERATOR
+
+    template <typename Table>
+    class chained_table_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename Table::value_type;
+        using difference_type   = typename Table::difference_type;
+        using pointer           = typename Table::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Table;
+        using Iter    = chained_table_iterator;
+        using Nodeptr = typename Table::Nodeptr;
+
+        Nodeptr node;       //所有节点串成一条单链表, end()为空指针
+
+    public:
+        chained_table_iterator(Nodeptr node = nullptr) : node(node) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            node = another.node;
+            return *this;
+        }
+
+        reference operator*() const {
+            return node->val;
+        }
+
+        pointer operator->() const {
+            return &node->val;
+        }
+
+        Iter& operator++() noexcept {
+            node = node->next;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return node == another.node;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return !(*this == another);
+        }
+    };
+
+    //只遍历一个桶: 同一个桶的节点在链表中相邻, 走到属于别的桶的节点即为结尾
+    template <typename Table>
+    class chained_table_local_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename Table::value_type;
+        using difference_type   = typename Table::difference_type;
+        using pointer           = typename Table::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Table;
+        using Iter      = chained_table_local_iterator;
+        using Nodeptr   = typename Table::Nodeptr;
+        using size_type = typename Table::size_type;
+
+        Nodeptr node;
+        size_type bucket;
+        size_type mask;     //桶数减一
+
+    public:
+        chained_table_local_iterator(Nodeptr node = nullptr, size_type bucket = 0, size_type mask = 0)
+            : node(node), bucket(bucket), mask(mask) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            node = another.node;
+            bucket = another.bucket;
+            mask = another.mask;
+            return *this;
+        }
+
+        reference operator*() const {
+            return node->val;
+        }
+
+        pointer operator->() const {
+            return &node->val;
+        }
+
+        Iter& operator++() noexcept {
+            node = node->next;
+            if (node && (node->hash & mask) != bucket)
+                node = nullptr;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return node == another.node;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return !(*this == another);
+        }
+    };
+
+#endif // !OCT_CHAINED_TABLE_ITERATOR
+
+#ifndef OCT_DEQUE_ITERATOR
+#define OCT_DEQUE_ITERATOR
+
+    template <typename Deq>
+    class deque_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = typename Deq::value_type;
+        using difference_type   = typename Deq::difference_type;
+        using pointer           = typename Deq::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Deq;
+        using Iter                = deque_iterator;
+        using Mapptr              = typename Deq::Mapptr;
+        using Deqptr              = const Deq* const;
+        using Map_difference_type = typename Deq::Map_difference_type;
+        using size_type           = typename Deq::size_type;
+
+        static constexpr size_type buf_size = Deq::buf_size;
+
+        Deqptr cont_ptr;
+        size_type offset;
+
+    public:
+        deque_iterator(Deqptr cont_ptr, size_type offset = 0) : cont_ptr(cont_ptr), offset(offset) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            if (cont_ptr != another.cont_ptr)
+                Logic_error();
+            offset = another.offset;
+            return *this;
+        }
+
+        reference operator*() const noexcept {
+            return *(cont_ptr->Visit(offset));
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(cont_ptr->Visit(offset + n));
+        }
+
+        pointer operator->() const noexcept {
+            return cont_ptr->Visit(offset);
+        }
+
+        Iter& operator++() noexcept {
+            ++offset;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            offset++;
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            --offset;
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            offset--;
+            return temp;
+        }
+
+        Iter& operator+=(difference_type n) noexcept {
+            offset += n;
+            return *this;
+        }
+
+        Iter& operator-=(difference_type n) noexcept {
+            offset -= n;
+            return *this;
+        }
+
+        Iter operator+(difference_type n) const noexcept {
+            return Iter(cont_ptr, offset + n);
+        }
+
+        Iter operator-(difference_type n) const noexcept {
+            return Iter(cont_ptr, offset - n);
+        }
+
+        difference_type operator-(const Iter& another) const noexcept {
+            return offset - another.offset;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return cont_ptr == another.cont_ptr && offset == another.offset;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return cont_ptr != another.cont_ptr || offset != another.offset;
+        }
+
+        bool operator<(const Iter& another) const noexcept {
+            return offset - another.offset < 0;
+        }
+
+        bool operator<=(const Iter& another) const noexcept {
+            return offset - another.offset <= 0;
+        }
+
+        bool operator>(const Iter& another) const noexcept {continuous_memory_iterator
+            return offset - another.offset > 0;
+        }
+
+        bool operator>=(const Iter& another) const noexcept {
+            return offset - another.offset >= 0;
+        }
+
+        private:
+            [[noreturn]] static void Logic_error() {
+                throw std::logic_error("iterator can't from different deque");
+            }
+    };
+
+#endif // !OCT_DEQUE_ITERATOR
+
+#ifndef OCT_CONTINUOUS_MEMORY_ITERATOR
+#define OCT_CONTINUOUS_MEMORY_ITERATOR
+
+    template <typename Container>
+    class continuous_memory_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = typename Container::value_type;
+        using difference_type   = typename Container::difference_type;
+        using pointer           = typename Container::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Container;
+        using Iter = continuous_memory_iterator;
+
+        pointer ptr;
+
+    public:
+        continuous_memory_iterator(pointer p = nullptr) :ptr(p) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ptr = another.ptr;
+            return *this;
+        }
+
+        reference operator*() const noexcept {
+            return *ptr;
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return ptr[n];
+        }
+
+        pointer operator->() const noexcept {
+            return ptr;
+        }
+
+        Iter& operator++() noexcept {
+            ++ptr;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ptr++;
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            --ptr;
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            ptr--;
+            return temp;
+        }
+
+        Iter& operator+=(difference_type n) noexcept {
+            ptr += n;
+            return *this;
+        }
+
+        Iter& operator-=(difference_type n) noexcept {
+            ptr -= n;
+            return *this;
+        }
+
+        Iter operator+(difference_type n) const noexcept {
+            return Iter(ptr + n);
+        }
+
+        Iter operator-(difference_type n) const noexcept {
+            return Iter(ptr - n);
+        }
+
+        difference_type operator-(const Iter& another) const noexcept {
+            return ptr - another.ptr;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ptr == another.ptr;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return ptr != another.ptr;
+        }
+
+        bool operator<(const Iter& another) const noexcept {
+            return another.ptr - ptr > 0;
+        }
+
+        bool operator<=(const Iter& another) const noexcept {
+            return another.ptr - ptr >= 0;
+        }
+
+        bool operator>(const Iter& another) const noexcept {
+            return another.ptr - ptr < 0;
+        }
+
+        bool operator>=(const Iter& another) const noexcept {
+            return another.ptr - ptr <= 0;
+        }
+    };
+
+#endif // !OCT_CONTINUOUS_MEMORY_ITERATOR
+
+#ifndef OCT_FLAT_MAP_ITERATOR
+#define OCT_FLAT_MAP_ITERATOR
+
+    //关键字与值分存于两个数组, 解引用得到由两者引用组成的代理pair
+    template <typename Map>
+    class flat_map_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = typename Map::value_type;
+        using difference_type   = typename Map::difference_type;
+        using reference         = typename Map::reference;
+
+        struct pointer {    //operator->返回的代理, 持有一个reference
+            reference ref;
+
+            reference* operator->() noexcept {
+                return &ref;
+            }
+        };
+
+    private:
+        friend Map;
+        using Iter     = flat_map_iterator;
+        using Keyptr   = typename Map::key_type*;
+        using Valueptr = typename Map::mapped_type*;
+
+        Keyptr   key;
+        Valueptr value;
+
+    public:
+        flat_map_iterator(Keyptr key = nullptr, Valueptr value = nullptr) : key(key), value(value) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            key = another.key;
+            value = another.value;
+            return *this;
+        }
+
+        reference operator*() const noexcept {
+            return reference(*key, *value);
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return reference(key[n], value[n]);
+        }
+
+        pointer operator->() const noexcept {
+            return pointer{ **this };
+        }
+
+        Iter& operator++() noexcept {
+            ++key;
+            ++value;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            --key;
+            --value;
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            --*this;
+            return temp;
+        }
+
+        Iter& operator+=(difference_type n) noexcept {
+            key += n;
+            value += n;
+            return *this;
+        }
+
+        Iter& operator-=(difference_type n) noexcept {
+            key -= n;
+            value -= n;
+            return *this;
+        }
+
+        Iter operator+(difference_type n) const noexcept {
+            return Iter(key + n, value + n);
+        }
+
+        Iter operator-(difference_type n) const noexcept {
+            return Iter(key - n, value - n);
+        }
+
+        difference_type operator-(const Iter& another) const noexcept {
+            return key - another.key;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return key == another.key;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return key != another.key;
+        }
+
+        bool operator<(const Iter& another) const noexcept {
+            return key < another.key;
+        }
+
+        bool operator<=(const Iter& another) const noexcept {
+            return key <= another.key;
+        }
+
+        bool operator>(const Iter& another) const noexcept {
+            return key > another.key;
+        }
+
+        bool operator>=(const Iter& another) const noexcept {
+            return key >= another.key;
+        }
+    };
+
+#endif // !OCT_FLAT_MAP_ITERATOR
+
+#ifndef OCT_INTRUSIVE_ITERATOR
+#define OCT_INTRUSIVE_ITERATOR
+
+    //迭代器只持有挂钩, 解引用时经挂钩特性换算回元素
+    template <typename List>
+    class intrusive_list_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename List::value_type;
+        using difference_type   = typename List::difference_type;
+        using pointer           = typename List::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend List;
+        using Iter    = intrusive_list_iterator;
+        using Hookptr = typename List::Hookptr;
+        using Traits  = typename List::hook_traits;
+
+        Hookptr ptr;
+
+    public:
+        intrusive_list_iterator(Hookptr ptr = nullptr) : ptr(ptr) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ptr = another.ptr;
+            return *this;
+        }
+
+        reference operator*() const {
+            return *Traits::To_value(ptr);
+        }
+
+        pointer operator->() const {
+            return Traits::To_value(ptr);
+        }
+
+        Iter& operator++() noexcept {
+            ptr = ptr->next;
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ptr = ptr->next;
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            ptr = ptr->prev;
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            ptr = ptr->prev;
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ptr == another.ptr;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return ptr != another.ptr;
+        }
+    };
+
+    template <typename Tree>
+    class intrusive_tree_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename Tree::value_type;
+        using difference_type   = typename Tree::difference_type;
+        using pointer           = typename Tree::pointer;
+        using reference         = value_type&;
+
+    private:
+        friend Tree;
+        using Iter      = intrusive_tree_iterator;
+        using Hookptr   = typename Tree::Hookptr;
+        using Traits    = typename Tree::hook_traits;
+        using Algorithm = typename Tree::Algorithm;
+
+        Hookptr ptr;
+
+    public:
+        intrusive_tree_iterator(Hookptr ptr = nullptr) : ptr(ptr) {}
+
+        Iter& operator=(const Iter& another) noexcept {
+            ptr = another.ptr;
+            return *this;
+        }
+
+        reference operator*() const {
+            return *Traits::To_value(ptr);
+        }
+
+        pointer operator->() const {
+            return Traits::To_value(ptr);
+        }
+
+        Iter& operator++() noexcept {
+            ptr = Algorithm::Next_node(ptr);
+            return *this;
+        }
+
+        Iter operator++(int) noexcept {
+            Iter temp = *this;
+            ptr = Algorithm::Next_node(ptr);
+            return temp;
+        }
+
+        Iter& operator--() noexcept {
+            ptr = Algorithm::Prev_node(ptr);
+            return *this;
+        }
+
+        Iter operator--(int) noexcept {
+            Iter temp = *this;
+            ptr = Algorithm::Prev_node(ptr);
+            return temp;
+        }
+
+        bool operator==(const Iter& another) const noexcept {
+            return ptr == another.ptr;
+        }
+
+        bool operator!=(const Iter& another) const noexcept {
+            return ptr != another.ptr;
+        }
+    };
+
+#endif // !OCT_INTRUSIVE_ITERATOR
+
+}
+
 #endif // !OCT_ITERATOR
\ No newline at end of file
@@ -0,0 +1,132 @@
+#pragma once
+
+#ifndef OCT_NODE_HANDLE
+#define OCT_NODE_HANDLE
+
+#include "utility.hpp"
+
+namespace oct {
+    template <typename Kty, typename Vty, typename Kcompare, typename Vcompare, typename Allocator, typename Feature, typename Augment, typename Derived>
+    class tree_base;
+
+    template <typename Ty, typename Allocator, std::size_t SlabSize>
+    class list;
+
+    template <typename Ty, typename Allocator, std::size_t SlabSize>
+    class forward_list;
+
+    //节点句柄: 独占一个从容器中摘下的节点及其配置器, 析构时销毁节点
+    //在配置器相等的同类容器之间转移元素时不再分配与释放内存, 也不移动元素
+    template <typename Node, typename Alnode>
+    class node_handle {
+    private:
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+
+    public:
+        using value_type     = typename Node::value_type;
+        using key_type       = key_of_v<value_type>;
+        using mapped_type    = value_of_v<value_type>;
+        using allocator_type = Alnode;
+
+    private:
+        template <typename, typename, typename, typename, typename, typename, typename, typename>
+        friend class tree_base;
+
+        template <typename, typename, std::size_t>
+        friend class list;
+
+        template <typename, typename, std::size_t>
+        friend class forward_list;
+
+        mutable compressed_pair<Alnode, Nodeptr> val_pack;
+
+    public:
+        node_handle() noexcept : val_pack(Alnode(), nullptr) {}
+
+        node_handle(node_handle&& another) noexcept
+            : val_pack(std::move(another.val_pack.get_first()), another.Release()) {}
+
+        node_handle& operator=(node_handle&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Clear();
+            val_pack.get_first() = std::move(another.val_pack.get_first());
+            val_pack.second = another.Release();
+            return *this;
+        }
+
+        node_handle(const node_handle&)            = delete;
+        node_handle& operator=(const node_handle&) = delete;
+
+        ~node_handle() {
+            Clear();
+        }
+
+        bool empty() const noexcept {
+            return !val_pack.second;
+        }
+
+        explicit operator bool() const noexcept {
+            return !empty();
+        }
+
+        allocator_type get_allocator() const {
+            return val_pack.get_first();
+        }
+
+        value_type& value() const noexcept {
+            return val_pack.second->val;
+        }
+
+        //关键字可在重新插入前修改, 修改后仍需满足目标容器的顺序要求
+        key_type& key() const noexcept {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val_pack.second->val;
+            else
+                return val_pack.second->val.first;
+        }
+
+        mapped_type& mapped() const noexcept {
+            return val_pack.second->val.second;
+        }
+
+        void swap(node_handle& another) noexcept {
+            std::swap(val_pack.get_first(), another.val_pack.get_first());
+            std::swap(val_pack.second, another.val_pack.second);
+        }
+
+    private:
+        node_handle(Nodeptr node, const Alnode& alloc) noexcept
+            : val_pack(alloc, node) {}
+
+        Nodeptr Release() noexcept {
+            Nodeptr node = val_pack.second;
+            val_pack.second = nullptr;
+            return node;
+        }
+
+        void Clear() {
+            if (val_pack.second) {
+                Alnode_traits::destroy(val_pack.get_first(), val_pack.second);
+                Alnode_traits::deallocate(val_pack.get_first(), val_pack.second, 1);
+                val_pack.second = nullptr;
+            }
+        }
+    };
+
+    template <typename Node, typename Alnode>
+    void swap(node_handle<Node, Alnode>& left, node_handle<Node, Alnode>& right) noexcept {
+        left.swap(right);
+    }
+
+    //以节点句柄插入的结果, 未插入时句柄归还给node
+    template <typename Iterator, typename NodeType>
+    struct node_insert_return {
+        Iterator position;
+        bool     inserted;
+        NodeType node;
+    };
+}
+
+#endif // !OCT_NODE_HANDLE
\ No newline at end of file
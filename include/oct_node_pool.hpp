@@ -0,0 +1,137 @@
+#pragma once
+
+#ifndef OCT_NODE_POOL
+#define OCT_NODE_POOL
+
+#include <new>
+#include "type_traits.hpp"
+
+namespace oct {
+    /*
+    * characteristics:
+    * [EBO]
+    */
+    //容器独占的节点池: 一次向配置器申请SlabSize个节点大小的slab, 释放的节点挂入空闲链表供下次复用,
+    //分配只是弹出空闲链表头或移动slab内的游标; slab只在Release时整体归还配置器
+    //池中的节点只能由所属容器使用, 容器之间不能直接交换节点
+    template <typename Alnode, std::size_t SlabSize>
+    class node_pool : public Alnode {
+    private:
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Node          = typename Alnode_traits::value_type;
+        using Nodeptr       = typename Alnode_traits::pointer;
+
+        //空闲节点的存储中只保存下一个空闲节点
+        struct Free_node {
+            Free_node* next;
+        };
+
+        struct Slab {
+            Slab* next;
+            alignas(Node) unsigned char storage[sizeof(Node) * SlabSize];
+        };
+
+        using Alslab        = rebind_alloc_t<Alnode, Slab>;
+        using Alslab_traits = std::allocator_traits<Alslab>;
+
+        Free_node* free_head = nullptr;
+        Slab*      slabs     = nullptr;
+        Nodeptr    bump      = nullptr;             //最新slab中尚未取用的部分为[bump, bump_end)
+        Nodeptr    bump_end  = nullptr;
+
+    public:
+        node_pool() = default;
+
+        template <typename Allocator>
+        explicit node_pool(const Allocator& al) : Alnode(al) {}
+
+        node_pool(node_pool&& another) noexcept : Alnode(static_cast<Alnode&>(another)) {
+            Swap(another);
+        }
+
+        node_pool(const node_pool&)            = delete;
+        node_pool& operator=(const node_pool&) = delete;
+
+        ~node_pool() {
+            Release();
+        }
+
+        Nodeptr Allocate() {
+            if (free_head) {
+                Nodeptr node = reinterpret_cast<Nodeptr>(free_head);
+                free_head = free_head->next;
+                return node;
+            }
+            if (bump == bump_end)
+                New_slab();
+            return bump++;
+        }
+
+        //node须已析构
+        void Deallocate(Nodeptr node) noexcept {
+            free_head = ::new (static_cast<void*>(node)) Free_node{ free_head };
+        }
+
+        //归还全部slab, 调用前池中的节点须已全部析构
+        void Release() noexcept {
+            Alslab al(static_cast<Alnode&>(*this));
+            while (slabs) {
+                Slab* next = slabs->next;
+                Alslab_traits::deallocate(al, slabs, 1);
+                slabs = next;
+            }
+            free_head = nullptr;
+            bump = bump_end = nullptr;
+        }
+
+        void Swap(node_pool& another) noexcept {
+            std::swap(free_head, another.free_head);
+            std::swap(slabs, another.slabs);
+            std::swap(bump, another.bump);
+            std::swap(bump_end, another.bump_end);
+        }
+
+    private:
+        void New_slab() {
+            Alslab al(static_cast<Alnode&>(*this));
+            Slab* slab = Alslab_traits::allocate(al, 1);
+            slab->next = slabs;
+            slabs = slab;
+            bump = reinterpret_cast<Nodeptr>(slab->storage);
+            bump_end = bump + SlabSize;
+        }
+    };
+
+    //SlabSize为0时不启用节点池, 每个节点直接向配置器申请与归还, 不占用额外空间
+    template <typename Alnode>
+    class node_pool<Alnode, 0> : public Alnode {
+    private:
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+
+    public:
+        node_pool() = default;
+
+        template <typename Allocator>
+        explicit node_pool(const Allocator& al) : Alnode(al) {}
+
+        node_pool(node_pool&& another) noexcept : Alnode(static_cast<Alnode&>(another)) {}
+
+        node_pool(const node_pool&)            = delete;
+        node_pool& operator=(const node_pool&) = delete;
+
+        Nodeptr Allocate() {
+            return Alnode_traits::allocate(*this, 1);
+        }
+
+        void Deallocate(Nodeptr node) noexcept {
+            Alnode_traits::deallocate(*this, node, 1);
+        }
+
+        void Release() noexcept {}
+
+        void Swap(node_pool&) noexcept {}
+    };
+}
+
+#endif // !OCT_NODE_POOL
\ No newline at end of file
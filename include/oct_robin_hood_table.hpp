@@ -0,0 +1,656 @@
+#pragma once
+
+#ifndef OCT_ROBIN_HOOD_TABLE
+#define OCT_ROBIN_HOOD_TABLE
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include "utility.hpp"
+
+namespace oct {
+    //每个槽位一字节探查信息: 0为空槽, d + 1表示元素离理想位置d格; 末尾哨兵为1, 探查与后移都会在此停下
+    using robin_hood_info_t = uint8_t;
+
+    inline constexpr robin_hood_info_t robin_hood_empty    = 0;
+    inline constexpr robin_hood_info_t robin_hood_sentinel = 1;
+    inline constexpr robin_hood_info_t robin_hood_max_info = 255;
+
+    template <typename Table>
+    struct robin_hood_table_val {
+        using size_type = typename Table::size_type;
+        using pointer   = typename Table::pointer;
+        using Infoptr   = typename Table::Ctrlptr;
+
+        Infoptr info;               //slot_count + 1个字节, 最后一个为哨兵
+        pointer slots;
+        size_type bucket_count;     //0或2的幂, 理想位置 = 哈希值 & (bucket_count - 1)
+        size_type slot_count;       //bucket_count加上末尾的溢出区, 探查不回绕
+        size_type val_size;
+        float max_load;
+
+        robin_hood_table_val()
+            : info(nullptr)
+            , slots(nullptr)
+            , bucket_count(0)
+            , slot_count(0)
+            , val_size(0)
+            , max_load(0.9f) {}
+
+        robin_hood_table_val(robin_hood_table_val&& another) noexcept : robin_hood_table_val() {
+            operator=(std::move(another));
+        }
+
+        robin_hood_table_val& operator=(robin_hood_table_val&& another) noexcept {
+            if (this == &another)
+                return *this;
+            info = another.info;
+            slots = another.slots;
+            bucket_count = another.bucket_count;
+            slot_count = another.slot_count;
+            val_size = another.val_size;
+            max_load = another.max_load;
+
+            another.info = nullptr;
+            another.slots = nullptr;
+            another.bucket_count = another.slot_count = another.val_size = 0;
+            return *this;
+        }
+    };
+
+#define OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP Infoptr&   info         = val_pack.second.second.second.info;         \
+                                             pointer&   slots        = val_pack.second.second.second.slots;        \
+                                             size_type& bucket_count = val_pack.second.second.second.bucket_count; \
+                                             size_type& slot_count   = val_pack.second.second.second.slot_count;   \
+                                             size_type& val_size     = val_pack.second.second.second.val_size;     \
+                                             float&     max_load     = val_pack.second.second.second.max_load;     \
+                                             Alty&      alloc        = val_pack.second.second.get_first();
+
+    //Robin Hood线性探查表: 插入时离理想位置更远的元素抢占更近的元素的槽位, 各元素的探查距离趋于均匀
+    //查找遇到距离比当前更小的槽位即可停止; 删除时把后继元素逐个前移(backward shift), 不留墓碑
+    //每个槽位只额外占一字节, 最大负载因子可设到0.9以上; 插入与删除都可能搬移元素, 使迭代器与引用失效
+    template <
+        typename Kty,
+        typename Vty,
+        typename Hash,
+        typename KeyEqual,
+        typename Allocator
+    >
+    class robin_hood_table {
+    protected:
+        using Alty          = rebind_alloc_t<Allocator, Vty>;
+        using Alty_traits   = std::allocator_traits<Alty>;
+        using Alinfo        = rebind_alloc_t<Allocator, robin_hood_info_t>;
+        using Alinfo_traits = std::allocator_traits<Alinfo>;
+        using Ctrlptr       = robin_hood_info_t*;
+        using Infoptr       = Ctrlptr;
+
+    public:
+        using key_type           = Kty;
+        using value_type         = Vty;
+        using size_type          = typename Alty_traits::size_type;
+        using difference_type    = typename Alty_traits::difference_type;
+        using hasher             = Hash;
+        using key_equal          = KeyEqual;
+        using allocator_type     = Allocator;
+        using reference          = Vty&;
+        using const_reference    = const Vty&;
+        using pointer            = typename Alty_traits::pointer;
+        using const_pointer      = typename Alty_traits::const_pointer;
+
+        using iterator           = swiss_table_iterator<robin_hood_table>;   //同为信息字节数组加槽位数组, 遍历方式相同
+        using local_iterator     = void;
+        using insert_return_type = pair<iterator, bool>;
+
+    private:
+        friend iterator;
+        friend struct robin_hood_table_val<robin_hood_table>;
+
+        static constexpr size_type min_bucket_count = 8;
+        static constexpr size_type max_overflow     = robin_hood_max_info - 1;
+        static constexpr size_type batch_size       = 64;
+        static constexpr float max_load_limit       = 0.98f;
+
+    protected:
+        mutable compressed_pair<hasher,
+                                compressed_pair<key_equal,
+                                                compressed_pair<Alty, robin_hood_table_val<robin_hood_table>>
+                                               >
+                               > val_pack;
+
+        robin_hood_table() : val_pack(hasher(), key_equal(), Alty()) {}
+
+        explicit robin_hood_table(size_type bucket_count, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : val_pack(hash, equal, alloc) {
+            Rehash(bucket_count);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        robin_hood_table(ForwardIt begin, ForwardIt end, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : robin_hood_table(bucket_count, hash, equal, alloc) {
+            Insert(begin, end);
+        }
+
+        robin_hood_table(const robin_hood_table& another)
+            : val_pack(another.val_pack.get_first(), another.val_pack.second.get_first(), another.val_pack.second.second.get_first()) {
+            Copy_from(another);
+        }
+
+        robin_hood_table(robin_hood_table&& another) noexcept
+            : val_pack(std::move(another.val_pack)) {}
+
+        robin_hood_table(std::initializer_list<value_type> ini_list, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : robin_hood_table(ini_list.begin(), ini_list.end(), bucket_count, hash, equal, alloc) {}
+
+        ~robin_hood_table() {
+            Tidy();
+        }
+
+        robin_hood_table& operator=(const robin_hood_table& another) {
+            if (this == &another)
+                return *this;
+            *this = robin_hood_table(another);
+            return *this;
+        }
+
+        robin_hood_table& operator=(robin_hood_table&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Tidy();
+            val_pack.get_first() = std::move(another.val_pack.get_first());
+            val_pack.second.get_first() = std::move(another.val_pack.second.get_first());
+            val_pack.second.second.second = std::move(another.val_pack.second.second.second);
+            return *this;
+        }
+
+        allocator_type Get_allocator() const noexcept {
+            return val_pack.second.second.get_first();
+        }
+
+        iterator Begin() const noexcept {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if (!val_size)
+                return End();
+            iterator res(info, slots);
+            res.Skip_empty();
+            return res;
+        }
+
+        iterator End() const noexcept {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            return info ? iterator(info + slot_count, slots + slot_count) : iterator();
+        }
+
+        bool Empty() const noexcept {
+            return !val_pack.second.second.second.val_size;
+        }
+
+        size_type Size() const noexcept {
+            return val_pack.second.second.second.val_size;
+        }
+
+        void Clear() {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if (!info)
+                return;
+            Destroy_slots();
+            Reset_info();
+            val_size = 0;
+        }
+
+        void Swap(robin_hood_table& another) noexcept {
+            std::swap(val_pack.get_first(), another.val_pack.get_first());
+            std::swap(val_pack.second.get_first(), another.val_pack.second.get_first());
+            robin_hood_table_val<robin_hood_table> temp(std::move(val_pack.second.second.second));
+            val_pack.second.second.second = std::move(another.val_pack.second.second.second);
+            another.val_pack.second.second.second = std::move(temp);
+        }
+
+        hasher Hash_function() const {
+            return val_pack.get_first();
+        }
+
+        key_equal Key_eq() const {
+            return val_pack.second.get_first();
+        }
+
+        reference operator[](const key_type& key) {
+            return *Try_emplace(key).first;
+        }
+
+        insert_return_type Insert(const_reference target) {
+            return Insert_unique(target);
+        }
+
+        iterator Insert(iterator hint, const_reference target) {
+            return Insert_unique(target).first;
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void Insert(ForwardIt begin, ForwardIt end) {
+            Reserve(Size() + std::distance(begin, end));
+            for (; begin != end; ++begin)
+                Insert_unique(*begin);
+        }
+
+        void Insert(std::initializer_list<value_type> ini_list) {
+            Insert(ini_list.begin(), ini_list.end());
+        }
+
+        template <typename... Args>
+        insert_return_type Emplace(Args&&... args) {
+            return Insert_unique(value_type(std::forward<Args>(args)...));
+        }
+
+        template <typename... Args>
+        iterator Emplace_hint(iterator hint, Args&&... args) {
+            return Emplace(std::forward<Args>(args)...).first;
+        }
+
+        //关键字已存在时不构造元素; 腾出槽位时扩容或后移都会搬动已有元素, args可能引用其中之一, 因此先构造出元素
+        template <typename Kref, typename... Args>
+        insert_return_type Try_emplace(Kref&& key, Args&&... args) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            size_t hash = Hash_of(key);
+            if (val_size) {
+                iterator pos = Find_hashed(key, hash);
+                if (pos != End())
+                    return insert_return_type(pos, false);
+            }
+            value_type temp(std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Kref>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+            size_type index = Prepare_slot(hash);
+            Construct_slot(index, std::move(temp));
+            return insert_return_type(iterator(info + index, slots + index), true);
+        }
+
+        //后继元素前移到pos处时返回pos本身, 因此边遍历边删除不会跳过元素
+        iterator Erase(iterator pos) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if (!pos.ctrl || pos.ctrl == info + slot_count || *pos.ctrl == robin_hood_empty)
+                Iterator_error();
+            Alty_traits::destroy(alloc, pos.slot);
+            Backward_shift(static_cast<size_type>(pos.ctrl - info));
+            if (*pos.ctrl == robin_hood_empty)
+                pos.Skip_empty();
+            return pos;
+        }
+
+        iterator Erase(iterator begin, iterator end) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if (begin == Begin() && end == End()) {
+                Clear();
+                return End();
+            }
+            size_type count = std::distance(begin, end);
+            while (count--)
+                begin = Erase(begin);
+            return begin;
+        }
+
+        template <typename Ref>
+        size_type Erase(const Ref& key) {
+            iterator pos = Find(key);
+            if (pos == End())
+                return 0;
+            Erase(pos);
+            return 1;
+        }
+
+        template <typename Ref>
+        iterator Find(const Ref& key) const {
+            if (!Size())
+                return End();
+            return Find_hashed(key, Hash_of(key));
+        }
+
+        //每批先算出全部哈希值并预取理想位置的信息字节与槽位, 再逐个探查, 让各次缓存缺失重叠
+        template <typename ForwardIt, typename OutputIt>
+        OutputIt Find_many(ForwardIt begin, ForwardIt end, OutputIt out) const {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            size_t hashes[batch_size];
+            while (begin != end) {
+                ForwardIt batch_begin = begin;
+                size_type count = 0;
+                for (; begin != end && count < batch_size; ++begin, ++count) {
+                    hashes[count] = Hash_of(*begin);
+                    if (val_size) {
+                        size_type index = hashes[count] & (bucket_count - 1);
+                        OCT_PREFETCH(info + index);
+                        OCT_PREFETCH(slots + index);
+                    }
+                }
+                for (size_type i = 0; i < count; ++i, ++batch_begin)
+                    *out++ = val_size ? Find_hashed(*batch_begin, hashes[i]) : End();
+            }
+            return out;
+        }
+
+        template <typename Ref>
+        size_type Count(const Ref& key) const {
+            return Find(key) != End();
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> Equal_range(const Ref& key) const {
+            iterator pos = Find(key);
+            if (pos == End())
+                return pair<iterator, iterator>(pos, pos);
+            iterator next = pos;
+            return pair<iterator, iterator>(pos, ++next);
+        }
+
+        size_type Bucket_count() const noexcept {
+            return val_pack.second.second.second.bucket_count;
+        }
+
+        float Load_factor() const noexcept {
+            size_type bucket_count = Bucket_count();
+            return bucket_count ? static_cast<float>(Size()) / static_cast<float>(bucket_count) : 0.0f;
+        }
+
+        float Max_load_factor() const noexcept {
+            return val_pack.second.second.second.max_load;
+        }
+
+        //上限为0.98, 更高的负载会使探查距离急剧增长
+        void Max_load_factor(float ml) {
+            if (!(ml > 0.0f))
+                Load_factor_error();
+            val_pack.second.second.second.max_load = ml < max_load_limit ? ml : max_load_limit;
+            Reserve(Size());
+        }
+
+        void Reserve(size_type count) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            size_type need = Buckets_for(count);
+            if (need > bucket_count)
+                Resize(need);
+        }
+
+        void Rehash(size_type count) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if (!count && !val_size) {
+                Tidy();
+                return;
+            }
+            size_type need = Buckets_for(val_size);
+            size_type target = Normalize(count > need ? count : need);
+            if (target != bucket_count)
+                Resize(target);
+        }
+
+        static const key_type& Key_of(const_reference val) {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val;
+            else
+                return val.first;
+        }
+
+    private:
+        static bool Is_empty_or_deleted(robin_hood_info_t info) noexcept {
+            return info == robin_hood_empty;
+        }
+
+        static size_type Normalize(size_type count) noexcept {
+            size_type bucket_count = min_bucket_count;
+            while (bucket_count < count)
+                bucket_count <<= 1;
+            return bucket_count;
+        }
+
+        size_type Buckets_for(size_type count) const {
+            if (!count)
+                return 0;
+            return Normalize(static_cast<size_type>(count / Max_load_factor()) + 1);
+        }
+
+        //溢出区让探查不必回绕, 最长探查距离受信息字节限制
+        static size_type Overflow_of(size_type bucket_count) noexcept {
+            return bucket_count < max_overflow ? bucket_count : max_overflow;
+        }
+
+        //桶数已是所需的64倍仍放不下, 说明大量关键字的哈希值相同, 继续扩容无济于事
+        size_type Degenerate_bound(size_type count) const {
+            return Buckets_for(count + 1) * 64;
+        }
+
+        template <typename Ref>
+        size_t Hash_of(const Ref& key) const {
+            return hash_mix(val_pack.get_first()(key));
+        }
+
+        //距离相同才可能命中; 遇到离理想位置更近的元素说明关键字不存在
+        template <typename Ref>
+        iterator Find_hashed(const Ref& key, size_t hash) const {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            key_equal& kequal = val_pack.second.get_first();
+            size_type index = hash & (bucket_count - 1);
+            robin_hood_info_t dist = 1;
+            for (; info[index] > dist; index++, dist++) {}
+            for (; info[index] == dist; index++, dist++)
+                if (kequal(Key_of(slots[index]), key))
+                    return iterator(info + index, slots + index);
+            return End();
+        }
+
+        //返回(槽位下标, 是否已存在); 不存在时槽位的信息字节已写好, 调用者负责构造元素
+        template <typename Ref>
+        pair<size_type, bool> Find_or_prepare(const Ref& key) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            size_t hash = Hash_of(key);
+            if (val_size) {
+                iterator pos = Find_hashed(key, hash);
+                if (pos != End())
+                    return pair<size_type, bool>(static_cast<size_type>(pos.ctrl - info), true);
+            }
+            return pair<size_type, bool>(Prepare_slot(hash), false);
+        }
+
+        //为不存在的关键字腾出槽位, 必要时扩容; 槽位的信息字节已写好, 调用者负责构造元素
+        size_type Prepare_slot(size_t hash) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if (val_size + 1 > bucket_count * max_load)
+                Resize(bucket_count ? bucket_count * 2 : min_bucket_count);
+            size_type index;
+            while ((index = Prepare_insert(hash)) == slot_count) {
+                if (bucket_count > Degenerate_bound(val_size))
+                    Probe_error();
+                Resize(bucket_count * 2);
+            }
+            val_size++;
+            return index;
+        }
+
+        //找到第一个空槽或比新元素更"富"的槽位: 后者连同其后直到空槽的一段整体后移一格再让出位置
+        //越过溢出区或距离超出一字节时返回slot_count, 调用者扩容后重试; Move_slots为false时只排信息字节
+        template <bool Move_slots = true>
+        size_type Prepare_insert(size_t hash) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            size_type index = hash & (bucket_count - 1);
+            size_type dist = 1;
+            for (; index < slot_count && info[index] >= dist; index++, dist++) {}
+            if (index == slot_count || dist >= robin_hood_max_info)
+                return slot_count;
+            size_type empty = index;
+            for (; empty < slot_count && info[empty] != robin_hood_empty; empty++)
+                if (info[empty] + 1 >= robin_hood_max_info)
+                    return slot_count;
+            if (empty == slot_count)
+                return slot_count;
+            for (size_type i = empty; i > index; i--) {
+                if constexpr (Move_slots) {
+                    Alty_traits::construct(alloc, slots + i, std::move(slots[i - 1]));
+                    Alty_traits::destroy(alloc, slots + i - 1);
+                }
+                info[i] = info[i - 1] + 1;
+            }
+            info[index] = static_cast<robin_hood_info_t>(dist);
+            return index;
+        }
+
+        template <typename Ref>
+        insert_return_type Insert_unique(Ref&& target) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            pair<size_type, bool> pos = Find_or_prepare(Key_of(target));
+            if (!pos.second)
+                Construct_slot(pos.first, std::forward<Ref>(target));
+            return insert_return_type(iterator(info + pos.first, slots + pos.first), !pos.second);
+        }
+
+        template <typename... Args>
+        void Construct_slot(size_type index, Args&&... args) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            try {
+                Alty_traits::construct(alloc, slots + index, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Backward_shift(index);
+                throw;
+            }
+        }
+
+        //index处的元素已销毁; 后继中不在理想位置上的元素逐个前移一格, 哨兵的值为1使前移在末尾停下
+        void Backward_shift(size_type index) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            for (; info[index + 1] > 1; index++) {
+                Alty_traits::construct(alloc, slots + index, std::move(slots[index + 1]));
+                Alty_traits::destroy(alloc, slots + index + 1);
+                info[index] = info[index + 1] - 1;
+            }
+            info[index] = robin_hood_empty;
+            val_size--;
+        }
+
+        void Reset_info() {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            std::memset(info, robin_hood_empty, slot_count);
+            info[slot_count] = robin_hood_sentinel;
+        }
+
+        void Allocate(size_type new_bucket_count) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            Alinfo alinfo(alloc);
+            size_type new_slot_count = new_bucket_count + Overflow_of(new_bucket_count);
+            slots = Alty_traits::allocate(alloc, new_slot_count);
+            try {
+                info = Alinfo_traits::allocate(alinfo, new_slot_count + 1);
+            }
+            catch (...) {
+                Alty_traits::deallocate(alloc, slots, new_slot_count);
+                throw;
+            }
+            bucket_count = new_bucket_count;
+            slot_count = new_slot_count;
+            Reset_info();
+        }
+
+        void Deallocate(Infoptr old_info, pointer old_slots, size_type old_slot_count) {
+            Alty& alloc = val_pack.second.second.get_first();
+            Alinfo alinfo(alloc);
+            Alinfo_traits::deallocate(alinfo, old_info, old_slot_count + 1);
+            Alty_traits::deallocate(alloc, old_slots, old_slot_count);
+        }
+
+        //按新桶数重新插入; 先只排信息字节确认放得下(溢出区不够时继续翻倍), 再按同样的顺序把元素移入
+        void Resize(size_type new_bucket_count) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            Infoptr old_info = info;
+            pointer old_slots = slots;
+            size_type old_bucket_count = bucket_count;
+            size_type old_slot_count = slot_count;
+            size_type count = val_size;
+            for (bool fit = false; !fit; new_bucket_count *= 2) {
+                Allocate(new_bucket_count);
+                fit = true;
+                for (size_type i = 0; i < old_slot_count && fit; i++)
+                    if (old_info[i] != robin_hood_empty)
+                        fit = Prepare_insert<false>(Hash_of(Key_of(old_slots[i]))) != slot_count;
+                if (fit)
+                    break;
+                Deallocate(info, slots, slot_count);
+                info = old_info;
+                slots = old_slots;
+                bucket_count = old_bucket_count;
+                slot_count = old_slot_count;
+                if (new_bucket_count > Degenerate_bound(count))
+                    Probe_error();
+            }
+            Reset_info();
+            for (size_type i = 0; i < old_slot_count; i++) {
+                if (old_info[i] == robin_hood_empty)
+                    continue;
+                size_type index = Prepare_insert(Hash_of(Key_of(old_slots[i])));
+                Alty_traits::construct(alloc, slots + index, std::move(old_slots[i]));
+                Alty_traits::destroy(alloc, old_slots + i);
+            }
+            val_size = count;
+            if (old_info)
+                Deallocate(old_info, old_slots, old_slot_count);
+        }
+
+        void Copy_from(const robin_hood_table& another) {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            const robin_hood_table_val<robin_hood_table>& source = another.val_pack.second.second.second;
+            max_load = source.max_load;
+            if (!source.val_size)
+                return;
+            Allocate(source.bucket_count);
+            std::memcpy(info, source.info, slot_count + 1);
+            size_type i = 0;
+            try {
+                for (; i < slot_count; i++)
+                    if (info[i] != robin_hood_empty)
+                        Alty_traits::construct(alloc, slots + i, source.slots[i]);
+            }
+            catch (...) {
+                while (i--)
+                    if (info[i] != robin_hood_empty)
+                        Alty_traits::destroy(alloc, slots + i);
+                Deallocate(info, slots, slot_count);
+                info = nullptr;
+                slots = nullptr;
+                bucket_count = slot_count = 0;
+                throw;
+            }
+            val_size = source.val_size;
+        }
+
+        void Destroy_slots() {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                for (size_type i = 0; i < slot_count; i++)
+                    if (info[i] != robin_hood_empty)
+                        Alty_traits::destroy(alloc, slots + i);
+            }
+        }
+
+        void Tidy() {
+            OCT_ROBIN_HOOD_TABLE_VAL_PACK_UNWRAP
+            if (!info)
+                return;
+            Destroy_slots();
+            Deallocate(info, slots, slot_count);
+            info = nullptr;
+            slots = nullptr;
+            bucket_count = slot_count = val_size = 0;
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid robin_hood_table iterator");
+        }
+
+        [[noreturn]] static void Probe_error() {
+            throw std::length_error("robin_hood_table probe length overflow, check the hash function");
+        }
+
+        [[noreturn]] static void Load_factor_error() {
+            throw std::invalid_argument("max_load_factor must be positive");
+        }
+    };
+}
+
+#endif // !OCT_ROBIN_HOOD_TABLE
\ No newline at end of file
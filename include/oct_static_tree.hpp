@@ -0,0 +1,201 @@
+#pragma once
+
+#ifndef OCT_STATIC_TREE
+#define OCT_STATIC_TREE
+
+#include <algorithm>
+#include "vector.hpp"
+#include "oct_btree.hpp"
+
+namespace oct {
+/*
+* characteristics:
+* [S+ tree]
+* [SIMD node search]
+* [batch prefetch]
+* [EBO]
+*/
+    //只读的隐式S+树: 叶子层就是有序关键字数组本身, 其上各层每个节点block个分隔关键字、block + 1个孩子,
+    //孩子编号由下标算出, 不存指针; 查找自根向下每层只访问一个节点(一条缓存行), 最终得到关键字在有序数组中的下标
+    template <typename Tree>
+    struct static_search_tree_val {
+        using size_type          = typename Tree::size_type;
+        using key_container_type = typename Tree::key_container_type;
+
+        static constexpr size_type max_height = 64;
+
+        key_container_type keys;                //有序关键字, 末尾以最大关键字补齐到block的整数倍
+        key_container_type inner;               //内部节点自顶向下逐层存放
+        size_type val_size = 0;
+        size_type height   = 0;                 //含叶子层的层数
+        size_type offset[max_height] = {};      //第h层(叶子为第0层)在inner中的起始位置
+    };
+
+#define OCT_STATIC_TREE_VAL_PACK_UNWRAP key_container_type& keys     = val_pack.second.keys;     \
+                                        key_container_type& inner    = val_pack.second.inner;    \
+                                        size_type&          val_size = val_pack.second.val_size; \
+                                        size_type&          height   = val_pack.second.height;   \
+                                        size_type*          offset   = val_pack.second.offset;   \
+                                        key_compare&        comp     = val_pack.get_first();
+
+    template <typename Key, typename Compare>
+    class static_search_tree {
+    public:
+        using key_type           = Key;
+        using key_compare        = Compare;
+        using size_type          = size_t;
+        using difference_type    = ptrdiff_t;
+        using key_container_type = vector<Key>;
+
+        //关键字不超过16字节时一个节点恰好占一条缓存行
+        static constexpr size_type block = sizeof(Key) <= 16 ? 64 / sizeof(Key) : 4;
+
+        static constexpr size_type batch_size = 64;
+
+    protected:
+        mutable compressed_pair<key_compare, static_search_tree_val<static_search_tree>> val_pack;
+
+        static_search_tree(const key_compare& comp) : val_pack(comp) {}
+
+        //val_pack为mutable, 不能依赖默认拷贝构造(会匹配到compressed_pair的转发构造函数)
+        static_search_tree(const static_search_tree& another)
+            : val_pack(another.val_pack.get_first(), another.val_pack.second) {}
+
+        static_search_tree(static_search_tree&& another) noexcept
+            : val_pack(another.val_pack.get_first(), std::move(another.val_pack.second)) {}
+
+        static_search_tree& operator=(const static_search_tree&) = default;
+        static_search_tree& operator=(static_search_tree&&)      = default;
+
+        key_container_type& Keys() const noexcept {
+            return val_pack.second.keys;
+        }
+
+        size_type Size() const noexcept {
+            return val_pack.second.val_size;
+        }
+
+        key_compare Key_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+        //sorted须已按比较器严格升序, 整个数组被接管作为叶子层
+        void Build(key_container_type&& sorted) {
+            OCT_STATIC_TREE_VAL_PACK_UNWRAP
+            key_container_type new_keys;
+            key_container_type new_inner;
+            new_keys.swap(sorted);
+            size_type count = new_keys.size();
+            size_type counts[static_search_tree_val<static_search_tree>::max_height] = { (count + block - 1) / block };
+            size_type new_height = 1;
+            while (counts[new_height - 1] > 1) {
+                counts[new_height] = (counts[new_height - 1] + block) / (block + 1);
+                ++new_height;
+            }
+            if (count) {
+                new_keys.reserve(counts[0] * block);
+                key_type last = new_keys[count - 1];
+                while (new_keys.size() < counts[0] * block)
+                    new_keys.emplace_back(last);
+            }
+
+            size_type total = 0;
+            for (size_type h = new_height - 1; h > 0; h--) {
+                offset[h] = total;
+                total += counts[h] * block;
+            }
+            new_inner.reserve(total);
+            size_type span = 1;                         //第h - 1层一个节点覆盖的叶子数
+            for (size_type h = 1; h < new_height; h++)
+                span *= block + 1;
+            for (size_type h = new_height - 1; h > 0; h--) {
+                span /= block + 1;
+                //第j个节点的第i个分隔关键字是第j * (block + 1) + i + 1个孩子子树中的最小关键字, 孩子不存在时取最大关键字
+                for (size_type j = 0; j < counts[h]; j++)
+                    for (size_type i = 0; i < block; i++) {
+                        size_type leaf = (j * (block + 1) + i + 1) * span;
+                        new_inner.emplace_back(leaf < counts[0] ? new_keys[leaf * block] : new_keys[count - 1]);
+                    }
+            }
+
+            keys.swap(new_keys);
+            inner.swap(new_inner);
+            val_size = count;
+            height = new_height;
+        }
+
+        //第一个不小于key的关键字的下标, 不存在时为Size()
+        template <typename Ref>
+        size_type Lower_index(const Ref& key) const {
+            OCT_STATIC_TREE_VAL_PACK_UNWRAP
+            if (!val_size || comp(keys[val_size - 1], key))
+                return val_size;
+            size_type j = 0;
+            for (size_type h = height - 1; h > 0; h--)
+                j = j * (block + 1) + Rank<false>(inner.data() + offset[h] + j * block, key);
+            return j * block + Rank<false>(keys.data() + j * block, key);
+        }
+
+        template <typename Ref>
+        size_type Upper_index(const Ref& key) const {
+            OCT_STATIC_TREE_VAL_PACK_UNWRAP
+            if (!val_size || !comp(key, keys[val_size - 1]))
+                return val_size;
+            size_type j = 0;
+            for (size_type h = height - 1; h > 0; h--)
+                j = j * (block + 1) + Rank<true>(inner.data() + offset[h] + j * block, key);
+            return j * block + Rank<true>(keys.data() + j * block, key);
+        }
+
+        //一批查找逐层交错推进: 每个查找算出下一层的节点后立即预取, 轮到它时该节点已在缓存中, 各次缓存缺失互相重叠
+        template <typename ForwardIt, typename OutputIt>
+        OutputIt Lower_index_many(ForwardIt begin, ForwardIt end, OutputIt out) const {
+            OCT_STATIC_TREE_VAL_PACK_UNWRAP
+            constexpr size_type done = static_cast<size_type>(-1);     //超出最大关键字, 结果为Size()
+            size_type pos[batch_size];
+            ForwardIt queries[batch_size];
+            while (begin != end) {
+                size_type count = 0;
+                for (; begin != end && count < batch_size; ++begin, ++count) {
+                    queries[count] = begin;
+                    pos[count] = !val_size || comp(keys[val_size - 1], *begin) ? done : 0;
+                }
+                for (size_type h = height - 1; h > 0; h--)
+                    for (size_type i = 0; i < count; i++) {
+                        if (pos[i] == done)
+                            continue;
+                        pos[i] = pos[i] * (block + 1) + Rank<false>(inner.data() + offset[h] + pos[i] * block, *queries[i]);
+                        OCT_PREFETCH(h > 1 ? inner.data() + offset[h - 1] + pos[i] * block : keys.data() + pos[i] * block);
+                    }
+                for (size_type i = 0; i < count; i++)
+                    *out++ = pos[i] == done ? val_size : pos[i] * block + Rank<false>(keys.data() + pos[i] * block, *queries[i]);
+            }
+            return out;
+        }
+
+    private:
+        //仅在比较器为less(含透明的less<>)且关键字与查找参数为同一算术类型时使用btree_rank的SIMD比较
+        template <typename Ref>
+        static constexpr bool simd_search_v = std::is_arithmetic_v<key_type>
+            && std::is_same_v<std::remove_cv_t<std::remove_reference_t<Ref>>, key_type>
+            && (std::is_same_v<key_compare, less<key_type>> || std::is_same_v<key_compare, std::less<key_type>>
+             || std::is_same_v<key_compare, less<>> || std::is_same_v<key_compare, std::less<>>);
+
+        //节点内小于key(Upper为true时: 不大于key)的关键字个数, 即应进入的孩子编号
+        template <bool Upper, typename Ref>
+        size_type Rank(const key_type* node, const Ref& key) const {
+            if constexpr (simd_search_v<Ref>) {
+                return btree_rank<Upper>(node, block, key);
+            }
+            else {
+                key_compare& comp = val_pack.get_first();
+                size_type res = 0;
+                for (size_type i = 0; i < block; i++)
+                    res += Upper ? !comp(key, node[i]) : comp(node[i], key);
+                return res;
+            }
+        }
+    };
+}
+
+#endif
\ No newline at end of file
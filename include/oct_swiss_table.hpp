@@ -0,0 +1,706 @@
+#pragma once
+
+#ifndef OCT_SWISS_TABLE
+#define OCT_SWISS_TABLE
+
+#include <cstring>
+#include <functional>
+#include "utility.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OCT_SWISS_TABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace oct {
+    //控制字节: 最高位为0表示槽位已占用, 低7位保存哈希值的低7位(H2); 其余为下面三种特殊值
+    using swiss_ctrl_t = signed char;
+
+    inline constexpr swiss_ctrl_t swiss_empty    = -128;     //0b10000000
+    inline constexpr swiss_ctrl_t swiss_deleted  = -2;       //0b11111110 墓碑
+    inline constexpr swiss_ctrl_t swiss_sentinel = -1;       //0b11111111 位于控制字节数组末尾, 迭代器在此停下
+
+    inline constexpr std::size_t swiss_group_width = 16;
+
+    inline unsigned swiss_trailing_zeros(unsigned mask) noexcept {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+
+    //16位掩码的前导零个数, mask不为0
+    inline unsigned swiss_leading_zeros16(unsigned mask) noexcept {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse(&index, mask);
+        return 15 - static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_clz(mask)) - 16;
+#endif
+    }
+
+    //连续16个控制字节, 匹配结果为16位掩码, 第i位对应组内第i个槽位
+    struct swiss_group {
+#ifdef OCT_SWISS_TABLE_SSE2
+        __m128i ctrl;
+
+        explicit swiss_group(const swiss_ctrl_t* pos) noexcept
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+        unsigned Match(swiss_ctrl_t h2) const noexcept {
+            return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+        }
+
+        unsigned Match_empty_or_deleted() const noexcept {
+            return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(swiss_sentinel), ctrl)));
+        }
+#else
+        swiss_ctrl_t ctrl[swiss_group_width];
+
+        explicit swiss_group(const swiss_ctrl_t* pos) noexcept {
+            std::memcpy(ctrl, pos, swiss_group_width);
+        }
+
+        unsigned Match(swiss_ctrl_t h2) const noexcept {
+            unsigned mask = 0;
+            for (unsigned i = 0; i < swiss_group_width; i++)
+                mask |= static_cast<unsigned>(ctrl[i] == h2) << i;
+            return mask;
+        }
+
+        unsigned Match_empty_or_deleted() const noexcept {
+            unsigned mask = 0;
+            for (unsigned i = 0; i < swiss_group_width; i++)
+                mask |= static_cast<unsigned>(ctrl[i] < swiss_sentinel) << i;
+            return mask;
+        }
+#endif
+
+        unsigned Match_empty() const noexcept {
+            return Match(swiss_empty);
+        }
+    };
+
+    template <typename Table>
+    struct swiss_table_val {
+        using size_type = typename Table::size_type;
+        using pointer   = typename Table::pointer;
+
+        swiss_ctrl_t* ctrl;                         //capacity + 16个字节: 槽位, 哨兵, 前15个槽位的副本(组读取越过末尾时无需回绕)
+        pointer slots;
+        size_type capacity;                         //0或2^k - 1, 下标与capacity按位与即完成回绕
+        size_type val_size;
+        size_type growth_left;                      //不扩容还能占用的空槽数, 墓碑不计入
+
+        swiss_table_val()
+            : ctrl(nullptr)
+            , slots(nullptr)
+            , capacity(0)
+            , val_size(0)
+            , growth_left(0) {}
+
+        swiss_table_val(swiss_table_val&& another) noexcept : swiss_table_val() {
+            operator=(std::move(another));
+        }
+
+        swiss_table_val& operator=(swiss_table_val&& another) noexcept {
+            if (this == &another)
+                return *this;
+            ctrl = another.ctrl;
+            slots = another.slots;
+            capacity = another.capacity;
+            val_size = another.val_size;
+            growth_left = another.growth_left;
+
+            another.ctrl = nullptr;
+            another.slots = nullptr;
+            another.capacity = another.val_size = another.growth_left = 0;
+            return *this;
+        }
+    };
+
+#define OCT_SWISS_TABLE_VAL_PACK_UNWRAP swiss_ctrl_t*& ctrl        = val_pack.second.second.second.ctrl;        \
+                                        pointer&       slots       = val_pack.second.second.second.slots;       \
+                                        size_type&     capacity    = val_pack.second.second.second.capacity;    \
+                                        size_type&     val_size    = val_pack.second.second.second.val_size;    \
+                                        size_type&     growth_left = val_pack.second.second.second.growth_left; \
+                                        Alty&          alloc       = val_pack.second.second.get_first();
+
+    //开放寻址哈希表(SwissTable): 元素直接存放在槽位数组中, 另有一字节控制字节数组
+    //查找时以16个控制字节为一组用SIMD同时比较H2, 只有H2相同的槽位才调用判等函数; 最大负载因子7/8
+    //插入可能整体搬移元素, 使所有迭代器与元素的引用失效
+    template <
+        typename Kty,
+        typename Vty,
+        typename Hash,
+        typename KeyEqual,
+        typename Allocator
+    >
+    class swiss_table {
+    protected:
+        using Alty          = rebind_alloc_t<Allocator, Vty>;
+        using Alty_traits   = std::allocator_traits<Alty>;
+        using Alctrl        = rebind_alloc_t<Allocator, swiss_ctrl_t>;
+        using Alctrl_traits = std::allocator_traits<Alctrl>;
+        using Ctrlptr       = swiss_ctrl_t*;
+
+    public:
+        using key_type           = Kty;
+        using value_type         = Vty;
+        using size_type          = typename Alty_traits::size_type;
+        using difference_type    = typename Alty_traits::difference_type;
+        using hasher             = Hash;
+        using key_equal          = KeyEqual;
+        using allocator_type     = Allocator;
+        using reference          = Vty&;
+        using const_reference    = const Vty&;
+        using pointer            = typename Alty_traits::pointer;
+        using const_pointer      = typename Alty_traits::const_pointer;
+
+        using iterator           = swiss_table_iterator<swiss_table>;
+        using local_iterator     = void;                //开放寻址表没有桶内链表, 不提供按桶遍历
+        using insert_return_type = pair<iterator, bool>;
+
+    private:
+        friend iterator;
+        friend struct swiss_table_val<swiss_table>;
+
+        static constexpr size_type min_capacity = swiss_group_width - 1;
+        static constexpr size_type npos         = static_cast<size_type>(-1);
+
+    protected:
+        mutable compressed_pair<hasher,
+                                compressed_pair<key_equal,
+                                                compressed_pair<Alty, swiss_table_val<swiss_table>>
+                                               >
+                               > val_pack;
+
+        swiss_table() : val_pack(hasher(), key_equal(), Alty()) {}
+
+        explicit swiss_table(size_type bucket_count, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : val_pack(hash, equal, alloc) {
+            Rehash(bucket_count);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        swiss_table(ForwardIt begin, ForwardIt end, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : swiss_table(bucket_count, hash, equal, alloc) {
+            Insert(begin, end);
+        }
+
+        swiss_table(const swiss_table& another)
+            : val_pack(another.val_pack.get_first(), another.val_pack.second.get_first(), another.val_pack.second.second.get_first()) {
+            Copy_from(another);
+        }
+
+        swiss_table(swiss_table&& another) noexcept
+            : val_pack(std::move(another.val_pack)) {}
+
+        swiss_table(std::initializer_list<value_type> ini_list, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : swiss_table(ini_list.begin(), ini_list.end(), bucket_count, hash, equal, alloc) {}
+
+        ~swiss_table() {
+            Tidy();
+        }
+
+        swiss_table& operator=(const swiss_table& another) {
+            if (this == &another)
+                return *this;
+            *this = swiss_table(another);
+            return *this;
+        }
+
+        swiss_table& operator=(swiss_table&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Tidy();
+            val_pack.get_first() = std::move(another.val_pack.get_first());
+            val_pack.second.get_first() = std::move(another.val_pack.second.get_first());
+            val_pack.second.second.second = std::move(another.val_pack.second.second.second);
+            return *this;
+        }
+
+        allocator_type Get_allocator() const noexcept {
+            return val_pack.second.second.get_first();
+        }
+
+        iterator Begin() const noexcept {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (!val_size)
+                return End();
+            iterator res(ctrl, slots);
+            res.Skip_empty();
+            return res;
+        }
+
+        iterator End() const noexcept {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            return ctrl ? iterator(ctrl + capacity, slots + capacity) : iterator();
+        }
+
+        bool Empty() const noexcept {
+            return !val_pack.second.second.second.val_size;
+        }
+
+        size_type Size() const noexcept {
+            return val_pack.second.second.second.val_size;
+        }
+
+        //保留槽位数组, 只销毁元素并把控制字节置空
+        void Clear() {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (!ctrl)
+                return;
+            Destroy_slots();
+            Reset_ctrl();
+            val_size = 0;
+            growth_left = Growth_of(capacity);
+        }
+
+        void Swap(swiss_table& another) noexcept {
+            std::swap(val_pack.get_first(), another.val_pack.get_first());
+            std::swap(val_pack.second.get_first(), another.val_pack.second.get_first());
+            swiss_table_val<swiss_table> temp(std::move(val_pack.second.second.second));
+            val_pack.second.second.second = std::move(another.val_pack.second.second.second);
+            another.val_pack.second.second.second = std::move(temp);
+        }
+
+        hasher Hash_function() const {
+            return val_pack.get_first();
+        }
+
+        key_equal Key_eq() const {
+            return val_pack.second.get_first();
+        }
+
+        reference operator[](const key_type& key) {
+            return *Try_emplace(key).first;
+        }
+
+        insert_return_type Insert(const_reference target) {
+            return Insert_unique(target);
+        }
+
+        //开放寻址表中提示位置无法利用
+        iterator Insert(iterator hint, const_reference target) {
+            return Insert_unique(target).first;
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void Insert(ForwardIt begin, ForwardIt end) {
+            Reserve(Size() + std::distance(begin, end));
+            for (; begin != end; ++begin)
+                Insert_unique(*begin);
+        }
+
+        void Insert(std::initializer_list<value_type> ini_list) {
+            Insert(ini_list.begin(), ini_list.end());
+        }
+
+        //必须先得到关键字才能探查, 因此先构造出元素再移动进槽位
+        template <typename... Args>
+        insert_return_type Emplace(Args&&... args) {
+            return Insert_unique(value_type(std::forward<Args>(args)...));
+        }
+
+        template <typename... Args>
+        iterator Emplace_hint(iterator hint, Args&&... args) {
+            return Emplace(std::forward<Args>(args)...).first;
+        }
+
+        //关键字已存在时不构造元素; 插入需要重建槽位数组时先构造出元素, args可能引用表中的元素
+        template <typename Kref, typename... Args>
+        insert_return_type Try_emplace(Kref&& key, Args&&... args) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            size_t hash = Hash_of(key);
+            size_type index = Find_slot(key, hash);
+            if (index != npos)
+                return insert_return_type(iterator(ctrl + index, slots + index), false);
+            if (Will_resize(hash)) {
+                value_type temp(std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<Kref>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+                index = Prepare_insert(hash);
+                Construct_slot(index, std::move(temp));
+            }
+            else {
+                index = Prepare_insert(hash);
+                Construct_slot(index, std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<Kref>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+            }
+            return insert_return_type(iterator(ctrl + index, slots + index), true);
+        }
+
+        iterator Erase(iterator pos) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (!pos.ctrl || pos.ctrl == ctrl + capacity || Is_empty_or_deleted(*pos.ctrl))
+                Iterator_error();
+            iterator next = pos;
+            ++next;
+            Alty_traits::destroy(alloc, pos.slot);
+            Erase_meta(static_cast<size_type>(pos.ctrl - ctrl));
+            return next;
+        }
+
+        iterator Erase(iterator begin, iterator end) {
+            while (begin != end)
+                begin = Erase(begin);
+            return end;
+        }
+
+        template <typename Ref>
+        size_type Erase(const Ref& key) {
+            iterator pos = Find(key);
+            if (pos == End())
+                return 0;
+            Erase(pos);
+            return 1;
+        }
+
+        template <typename Ref>
+        iterator Find(const Ref& key) const {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (!val_size)
+                return End();
+            key_equal& kequal = val_pack.second.get_first();
+            size_t hash = Hash_of(key);
+            swiss_ctrl_t h2 = H2(hash);
+            size_type offset = H1(hash) & capacity;
+            for (size_type step = swiss_group_width; ; step += swiss_group_width) {
+                swiss_group group(ctrl + offset);
+                for (unsigned mask = group.Match(h2); mask; mask &= mask - 1) {
+                    size_type index = (offset + swiss_trailing_zeros(mask)) & capacity;
+                    if (kequal(Key_of(slots[index]), key))
+                        return iterator(ctrl + index, slots + index);
+                }
+                if (group.Match_empty())        //组内还有空槽, 插入时不会越过这一组
+                    return End();
+                offset = (offset + step) & capacity;
+            }
+        }
+
+        template <typename Ref>
+        size_type Count(const Ref& key) const {
+            return Find(key) != End();
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> Equal_range(const Ref& key) const {
+            iterator pos = Find(key);
+            if (pos == End())
+                return pair<iterator, iterator>(pos, pos);
+            iterator next = pos;
+            return pair<iterator, iterator>(pos, ++next);
+        }
+
+        size_type Bucket_count() const noexcept {
+            return val_pack.second.second.second.capacity;
+        }
+
+        float Load_factor() const noexcept {
+            size_type capacity = Bucket_count();
+            return capacity ? static_cast<float>(Size()) / static_cast<float>(capacity) : 0.0f;
+        }
+
+        float Max_load_factor() const noexcept {
+            return 0.875f;
+        }
+
+        //最大负载因子固定为7/8, 设置值只作为提示而被忽略
+        void Max_load_factor(float) noexcept {}
+
+        //至少容纳count个元素而不扩容
+        void Reserve(size_type count) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (count > val_size + growth_left)
+                Resize(Capacity_for(count));
+        }
+
+        //槽位数调整为不小于max(count, 容纳现有元素所需)的2^k - 1, 同时清除全部墓碑
+        void Rehash(size_type count) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (!count && !val_size) {
+                Tidy();
+                return;
+            }
+            size_type need = Capacity_for(val_size);
+            size_type target = Normalize(count > need ? count : need);
+            if (target != capacity || val_size + growth_left < Growth_of(capacity))
+                Resize(target);
+        }
+
+        static const key_type& Key_of(const_reference val) {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val;
+            else
+                return val.first;
+        }
+
+    private:
+        static bool Is_empty_or_deleted(swiss_ctrl_t ctrl) noexcept {
+            return ctrl < swiss_sentinel;
+        }
+
+        static bool Is_full(swiss_ctrl_t ctrl) noexcept {
+            return ctrl >= 0;
+        }
+
+        static size_type Growth_of(size_type capacity) noexcept {
+            return capacity - capacity / 8;
+        }
+
+        //不小于count的2^k - 1, 至少为一组
+        static size_type Normalize(size_type count) noexcept {
+            size_type capacity = min_capacity;
+            while (capacity < count)
+                capacity = capacity * 2 + 1;
+            return capacity;
+        }
+
+        static size_type Capacity_for(size_type count) noexcept {
+            size_type capacity = min_capacity;
+            while (Growth_of(capacity) < count)
+                capacity = capacity * 2 + 1;
+            return capacity;
+        }
+
+        //混合后H1与H2都取到充分混合的位
+        template <typename Ref>
+        size_t Hash_of(const Ref& key) const {
+            return hash_mix(val_pack.get_first()(key));
+        }
+
+        static size_t H1(size_t hash) noexcept {
+            return hash >> 7;
+        }
+
+        static swiss_ctrl_t H2(size_t hash) noexcept {
+            return static_cast<swiss_ctrl_t>(hash & 0x7F);
+        }
+
+        //同时写入index处的控制字节及其在末尾的副本
+        void Set_ctrl(size_type index, swiss_ctrl_t h) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            ctrl[index] = h;
+            ctrl[((index - (swiss_group_width - 1)) & capacity) + (swiss_group_width - 1)] = h;
+        }
+
+        void Reset_ctrl() {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            std::memset(ctrl, static_cast<unsigned char>(swiss_empty), capacity + swiss_group_width);
+            ctrl[capacity] = swiss_sentinel;
+        }
+
+        //三角探查: 第i次探查的组起点为H1 + 16 * i * (i + 1) / 2, 槽位数加一为2的幂时能遍历所有组
+        size_type Find_first_non_full(size_t hash) const {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            size_type offset = H1(hash) & capacity;
+            for (size_type step = swiss_group_width; ; step += swiss_group_width) {
+                unsigned mask = swiss_group(ctrl + offset).Match_empty_or_deleted();
+                if (mask)
+                    return (offset + swiss_trailing_zeros(mask)) & capacity;
+                offset = (offset + step) & capacity;
+            }
+        }
+
+        //返回(槽位下标, 是否已存在); 不存在时槽位的控制字节已写好, 调用者负责构造元素
+        template <typename Ref>
+        pair<size_type, bool> Find_or_prepare(const Ref& key) {
+            size_t hash = Hash_of(key);
+            size_type index = Find_slot(key, hash);
+            if (index != npos)
+                return pair<size_type, bool>(index, true);
+            return pair<size_type, bool>(Prepare_insert(hash), false);
+        }
+
+        //返回关键字所在槽位的下标, 不存在时返回npos
+        template <typename Ref>
+        size_type Find_slot(const Ref& key, size_t hash) const {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (val_size) {
+                key_equal& kequal = val_pack.second.get_first();
+                swiss_ctrl_t h2 = H2(hash);
+                size_type offset = H1(hash) & capacity;
+                for (size_type step = swiss_group_width; ; step += swiss_group_width) {
+                    swiss_group group(ctrl + offset);
+                    for (unsigned mask = group.Match(h2); mask; mask &= mask - 1) {
+                        size_type index = (offset + swiss_trailing_zeros(mask)) & capacity;
+                        if (kequal(Key_of(slots[index]), key))
+                            return index;
+                    }
+                    if (group.Match_empty())
+                        break;
+                    offset = (offset + step) & capacity;
+                }
+            }
+            return npos;
+        }
+
+        //Prepare_insert是否会重建槽位数组
+        bool Will_resize(size_t hash) const {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            return !capacity || (!growth_left && ctrl[Find_first_non_full(hash)] != swiss_deleted);
+        }
+
+        size_type Prepare_insert(size_t hash) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (!capacity)
+                Resize(min_capacity);
+            size_type index = Find_first_non_full(hash);
+            if (!growth_left && ctrl[index] != swiss_deleted) {     //复用墓碑不占用增长额度
+                Grow();
+                index = Find_first_non_full(hash);
+            }
+            growth_left -= ctrl[index] == swiss_empty;
+            Set_ctrl(index, H2(hash));
+            val_size++;
+            return index;
+        }
+
+        //墓碑占了大半增长额度时原容量重建即可, 否则容量翻倍
+        void Grow() {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            Resize(val_size <= Growth_of(capacity) / 2 ? capacity : capacity * 2 + 1);
+        }
+
+        template <typename Ref>
+        insert_return_type Insert_unique(Ref&& target) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            pair<size_type, bool> pos = Find_or_prepare(Key_of(target));
+            if (!pos.second)
+                Construct_slot(pos.first, std::forward<Ref>(target));
+            return insert_return_type(iterator(ctrl + pos.first, slots + pos.first), !pos.second);
+        }
+
+        template <typename... Args>
+        void Construct_slot(size_type index, Args&&... args) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            try {
+                Alty_traits::construct(alloc, slots + index, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Erase_meta(index);
+                throw;
+            }
+        }
+
+        //包含index的任意连续16个槽位都不曾全满时, 没有探查会越过它, 可以直接置空而不留墓碑
+        void Erase_meta(size_type index) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            unsigned empty_before = swiss_group(ctrl + ((index - swiss_group_width) & capacity)).Match_empty();
+            unsigned empty_after = swiss_group(ctrl + index).Match_empty();
+            bool was_never_full = empty_before && empty_after
+                && swiss_trailing_zeros(empty_after) + swiss_leading_zeros16(empty_before) < swiss_group_width;
+            Set_ctrl(index, was_never_full ? swiss_empty : swiss_deleted);
+            growth_left += was_never_full;
+            val_size--;
+        }
+
+        void Allocate(size_type new_capacity) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            Alctrl alctrl(alloc);
+            slots = Alty_traits::allocate(alloc, new_capacity);
+            try {
+                ctrl = Alctrl_traits::allocate(alctrl, new_capacity + swiss_group_width);
+            }
+            catch (...) {
+                Alty_traits::deallocate(alloc, slots, new_capacity);
+                throw;
+            }
+            capacity = new_capacity;
+            Reset_ctrl();
+        }
+
+        void Deallocate(Ctrlptr old_ctrl, pointer old_slots, size_type old_capacity) {
+            Alty& alloc = val_pack.second.second.get_first();
+            Alctrl alctrl(alloc);
+            Alctrl_traits::deallocate(alctrl, old_ctrl, old_capacity + swiss_group_width);
+            Alty_traits::deallocate(alloc, old_slots, old_capacity);
+        }
+
+        //元素按新容量重新探查后移入, 墓碑随之消失
+        void Resize(size_type new_capacity) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            Ctrlptr old_ctrl = ctrl;
+            pointer old_slots = slots;
+            size_type old_capacity = capacity;
+            Allocate(new_capacity);
+            growth_left = Growth_of(new_capacity) - val_size;
+            for (size_type i = 0; i < old_capacity; i++) {
+                if (!Is_full(old_ctrl[i]))
+                    continue;
+                size_t hash = Hash_of(Key_of(old_slots[i]));
+                size_type index = Find_first_non_full(hash);
+                Set_ctrl(index, H2(hash));
+                Alty_traits::construct(alloc, slots + index, std::move(old_slots[i]));
+                Alty_traits::destroy(alloc, old_slots + i);
+            }
+            if (old_ctrl)
+                Deallocate(old_ctrl, old_slots, old_capacity);
+        }
+
+        //哈希函数相同, 直接按原布局复制控制字节与元素
+        void Copy_from(const swiss_table& another) {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            const swiss_table_val<swiss_table>& source = another.val_pack.second.second.second;
+            if (!source.val_size)
+                return;
+            Allocate(source.capacity);
+            std::memcpy(ctrl, source.ctrl, capacity + swiss_group_width);
+            size_type i = 0;
+            try {
+                for (; i < capacity; i++)
+                    if (Is_full(ctrl[i]))
+                        Alty_traits::construct(alloc, slots + i, source.slots[i]);
+            }
+            catch (...) {
+                while (i--)
+                    if (Is_full(ctrl[i]))
+                        Alty_traits::destroy(alloc, slots + i);
+                Deallocate(ctrl, slots, capacity);
+                ctrl = nullptr;
+                slots = nullptr;
+                capacity = 0;
+                throw;
+            }
+            val_size = source.val_size;
+            growth_left = source.growth_left;
+        }
+
+        void Destroy_slots() {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                for (size_type i = 0; i < capacity; i++)
+                    if (Is_full(ctrl[i]))
+                        Alty_traits::destroy(alloc, slots + i);
+            }
+        }
+
+        void Tidy() {
+            OCT_SWISS_TABLE_VAL_PACK_UNWRAP
+            if (!ctrl)
+                return;
+            Destroy_slots();
+            Deallocate(ctrl, slots, capacity);
+            ctrl = nullptr;
+            slots = nullptr;
+            capacity = val_size = growth_left = 0;
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid swiss_table iterator");
+        }
+    };
+}
+
+#endif // !OCT_SWISS_TABLE
\ No newline at end of file
@@ -1,873 +1,2438 @@
-#pragma once
-
-#ifndef OCT_TREE
-#define OCT_TREE
-
-#include "utility.hpp"
-
-namespace oct {
-    struct tree_feature {
-        enum class Dir : bool {
-            is_left, is_right
-        };
-    };
-
-    struct red_black_tree_feature : public tree_feature {
-        enum class Color : bool {
-            black, red
-        };
-    };
-
-    struct avl_tree_feature : public tree_feature {
-        int balance = 0;
-    };
-
-    struct splay_tree_feature : public tree_feature {};
-
-    struct treap_featue : public tree_feature {};
-
-    template <typename Ty, typename Feature>
-    struct tree_node {};
-
-    template <typename Ty>
-    struct tree_node<Ty, red_black_tree_feature> : public red_black_tree_feature {
-        using key_type        = key_of_v<Ty>;
-        using value_type      = Ty;
-        using const_reference = const Ty&;
-
-        using Nodeptr = tree_node*;
-
-        value_type val;
-        Nodeptr parent;
-        Nodeptr left;
-        Nodeptr right;
-        Color color;
-
-        tree_node() : tree_node(value_type()) {}
-
-        template <typename Ref>
-        tree_node(Ref&& elem, 
-                  Nodeptr p = nullptr, 
-                  Nodeptr l = nullptr, 
-                  Nodeptr r = nullptr, 
-                  Color c = Color::red) 
-            : val(std::forward<Ref>(elem))
-            , parent(p)
-            , left(l)
-            , right(r)
-            , color(c) {}
-
-        tree_node(const tree_node&)            = delete;
-        tree_node& operator=(const tree_node&) = delete;
-        tree_node(tree_node&&)                 = delete;
-        tree_node& operator=(tree_node&&)      = delete;
-
-        Nodeptr Min_node() noexcept {
-            Nodeptr node = this;
-            while (node->left)
-                node = node->left;
-            return node;
-        }
-
-        Nodeptr Next_node() noexcept {
-            if (right) {
-                return right->Min_node();
-            }
-            else {
-                Nodeptr node = this;
-                while (node->parent && node == node->parent->right)
-                    node = node->parent;
-                return node->parent ? node->parent : node;
-            }
-        }
-
-        Nodeptr Max_node() noexcept {
-            Nodeptr node = this;
-            while (node->right)
-                node = node->right;
-            return node;
-        }
-
-        Nodeptr Prev_node() noexcept {
-            if (left) {
-                return left->Max_node();
-            }
-            else {
-                Nodeptr node = this;
-                while (node->parent && node == node->parent->left)
-                    node = node->parent;
-                return node->parent ? node->parent : node;
-            }
-        }
-
-        key_type& Key() noexcept {
-            if constexpr (std::is_same_v<key_type, value_type>)
-                return val;
-            else
-                return val.first;
-        }
-
-        value_type& Val() noexcept {
-            return val;
-        }
-    };
-
-    template <
-        typename Kty,
-        typename Vty,
-        typename Kcompare,
-        typename Vcompare,
-        typename Allocator,
-        typename Feature
-    >
-    struct tree_traits_base {
-    protected:
-        using Alty          = rebind_alloc_t<Allocator, Vty>;
-        using Alty_traits   = std::allocator_traits<Alty>;
-        using Node          = tree_node<Vty, Feature>;
-        using Alnode        = rebind_alloc_t<Allocator, Node>;
-        using Alnode_traits = std::allocator_traits<Alnode>;
-        using Nodeptr       = typename Alnode_traits::pointer;
-
-    public:
-        using key_type           = Kty;
-        using value_type         = Vty;
-        using size_type          = typename Alty_traits::size_type;
-        using difference_type    = typename Alty_traits::difference_type;
-        using key_compare        = Kcompare;
-        using value_compare      = Vcompare;
-        using allocator_type     = Allocator;
-        using reference          = Vty&;
-        using const_reference    = const Vty&;
-        using pointer            = typename Alty_traits::pointer;
-        using const_pointer      = typename Alty_traits::const_pointer;
-    };
-
-    template <typename Tree>
-    struct tree_val {
-        using value_type = typename Tree::value_type;
-        using size_type  = typename Tree::size_type;
-
-        using Node    = typename Tree::Node;
-        using Nodeptr = typename Tree::Nodeptr;
-
-        Node dummy;
-        Nodeptr root;
-        Nodeptr begin_node;
-        size_type val_size;
-
-        tree_val() 
-            : dummy()
-            , root(nullptr)
-            , begin_node(&dummy)
-            , val_size(0) {}
-
-        tree_val(tree_val&& another) noexcept {
-            operator=(std::move(another));
-        }
-
-        tree_val& operator=(tree_val&& another) noexcept {
-            if (this == &another)
-                return *this;
-            dummy.left = another.dummy.left;
-            dummy.right = another.dummy.right;
-            root = another.root;
-            if (root)
-                root->parent = &dummy;
-            begin_node = another.begin_node;
-            val_size = another.val_size;
-
-            another.dummy.left = dummy.right = nullptr;
-            another.root = nullptr;
-            another.begin_node = &another.dummy;
-            another.val_size = 0;
-            return *this;
-        }
-    };
-
-#define OCT_TREE_VAL_PACK_UNWRAP Node&        dummy      = val_pack.second.second.dummy;      \
-                                 Nodeptr&     root       = val_pack.second.second.root;       \
-                                 Nodeptr&     begin_node = val_pack.second.second.begin_node; \
-                                 key_compare& kcomp      = val_pack.get_first();              \
-                                 size_type&   val_size   = val_pack.second.second.val_size;   \
-                                 Alnode&      alloc      = val_pack.second.get_first();
-                                 
-    template <
-        typename Kty,
-        typename Vty,
-        typename Kcompare,
-        typename Vcompare,
-        typename Allocator
-    >
-    class red_black_tree : public tree_traits_base<Kty, Vty, Kcompare, Vcompare, Allocator, red_black_tree_feature>,
-                           public red_black_tree_feature
-    {
-    protected:
-        using Base          = tree_traits_base;
-        using Alty          = typename Base::Alty;
-        using Alty_traits   = typename Base::Alty_traits;
-        using Node          = typename Base::Node;
-        using Alnode        = typename Base::Alnode;
-        using Alnode_traits = typename Base::Alnode_traits;
-        using Nodeptr       = typename Base::Nodeptr;
-
-    public:
-        using key_type           = typename Base::key_type;
-        using value_type         = typename Base::value_type;
-        using size_type          = typename Base::size_type;
-        using difference_type    = typename Base::difference_type;
-        using key_compare        = typename Base::key_compare;
-        using value_compare      = typename Base::value_type;
-        using allocator_type     = typename Base::allocator_type;
-        using reference          = typename Base::reference;
-        using const_reference    = typename Base::const_reference;
-        using pointer            = typename Base::pointer;
-        using const_pointer      = typename Base::const_pointer;
-
-        using iterator           = tree_iterator<red_black_tree>;
-        using node_type          = Node;
-        using insert_return_type = pair<iterator, bool>;
-
-    private:
-        friend class iterator;
-        friend class tree_val<red_black_tree>;
-
-        mutable compressed_pair<key_compare, 
-                                compressed_pair<Alnode, tree_val<red_black_tree>>
-                               > val_pack;
-
-    protected:
-        red_black_tree() : val_pack(key_compare(), Alnode()) {}
-
-        explicit red_black_tree(const key_compare& comp, const allocator_type& alloc = allocator_type())
-            : val_pack(comp, alloc) {}
-
-        explicit red_black_tree(const allocator_type& alloc)
-            : val_pack(key_compare(), alloc) {}
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        red_black_tree(ForwardIt begin, ForwardIt end,
-            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
-            : red_black_tree(comp, alloc) {
-            Insert(begin, end);
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        red_black_tree(ForwardIt begin, ForwardIt end,
-            const allocator_type&)
-            : red_black_tree(alloc) {
-            Insert(begin, end);
-        }
-
-        red_black_tree(const red_black_tree& another, const allocator_type& alloc = allocator_type())
-            : red_black_tree(another.Begin(), another.End()) {}
-
-        red_black_tree(red_black_tree&& another, const allocator_type& alloc = allocator_type()) noexcept 
-            : val_pack(std::move(another.val_pack)) {}
-
-        red_black_tree(std::initializer_list<value_type> ini_list,
-            const key_compare& comp = key_compare(),
-            const allocator_type& alloc = allocator_type())
-            : red_black_tree(ini_list.begin(), ini_list.end(), comp, alloc) {}
-
-        red_black_tree(std::initializer_list<value_type> ini_list,
-            const allocator_type& alloc)
-            : red_black_tree(ini_list.begin(), ini_list.end(), alloc) {}
-
-        ~red_black_tree() {
-            OCT_TREE_VAL_PACK_UNWRAP
-            Tidy(root);
-
-            dummy.left = dummy.right = nullptr;
-            root = nullptr;
-            begin_node = &dummy;
-            val_size = 0;
-        }
-
-        red_black_tree& operator=(const red_black_tree& another) {
-            if (this == &another)
-                return *this;
-            *this = red_black_tree(another);
-            return *this;
-        }
-
-        red_black_tree& operator=(red_black_tree&& another) noexcept {
-            if (this == &another)
-                return *this;
-            this->~red_black_tree();
-            val_pack.second.second = std::move(another.val_pack.second.second);
-            return *this;
-        }
-
-        allocator_type Get_allocator() const noexcept {
-            return val_pack.second.Get_first();
-        }
-
-        reference operator[](const key_type& key) {
-            OCT_TREE_VAL_PACK_UNWRAP
-
-            Nodeptr  parent = &val_pack.second.second.dummy;
-            Nodeptr* address = &root;
-            while (*address) {
-                parent = *address;
-                if (kcomp(key, parent->Key())) {
-                    address = &parent->left;
-                    continue;
-                }
-                if (kcomp(parent->Key(), key)) {
-                    address = &parent->right;
-                    continue;
-                }
-                return (*address)->Val();
-            }
-
-            *address = Alnode_traits::allocate(alloc, 1);
-            Alnode_traits::construct(alloc, *address, value_type{ key, value_of_v<value_type>() }, parent);
-            Nodeptr res = *address;
-            Fix_violation_after_insert(*address);
-
-            if (begin_node == &dummy || kcomp(key, begin_node->Key()))
-                begin_node = res;
-            dummy.left = dummy.right = root;
-            val_size++;
-            return res->Val();
-        }
-
-        iterator Begin() const noexcept {
-            return iterator(val_pack.second.second.begin_node);
-        }
-
-        iterator End() const noexcept {
-            return iterator(&val_pack.second.second.dummy);
-        }
-
-        bool Empty() const noexcept {
-            return !val_pack.second.second.val_size;
-        }
-
-        size_type Size() const noexcept {
-            return val_pack.second.second.val_size;
-        }
-
-        void Clear() {
-            OCT_TREE_VAL_PACK_UNWRAP
-            Tidy(root);
-
-            dummy.left = dummy.right = nullptr;
-            root = nullptr;
-            begin_node = &dummy;
-            val_size = 0;
-        }
-
-        insert_return_type Insert(const_reference target) {
-            OCT_TREE_VAL_PACK_UNWRAP
-
-            Nodeptr  parent = &val_pack.second.second.dummy;
-            Nodeptr* address = &root;
-            const key_type& target_key = Key_of(target);
-            while (*address) {
-                parent = *address;
-                if (kcomp(target_key, parent->Key())) {
-                    address = &parent->left;
-                    continue;
-                }
-                if (kcomp(parent->Key(), target_key)) {
-                    address = &parent->right;
-                    continue;
-                }
-                return insert_return_type(*address, false);
-            }
-
-            *address = Alnode_traits::allocate(alloc, 1);
-            Alnode_traits::construct(alloc, *address, target, parent);
-            Nodeptr res = *address;
-            Fix_violation_after_insert(*address);
-
-            if (begin_node == &dummy || kcomp(target_key, begin_node->Key()))
-                begin_node = res;
-            dummy.left = dummy.right = root;
-            val_size++;
-            return insert_return_type(res, true);
-        }
-
-        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
-        void Insert(ForwardIt begin, ForwardIt end) {
-            while (begin != end)
-                Insert(*begin++);
-        }
-
-        void Insert(std::initializer_list<value_type> ini_list) {
-            Insert(ini_list.begin(), ini_list.end());
-        }
-
-        iterator Erase(iterator pos) {
-            OCT_TREE_VAL_PACK_UNWRAP
-            if (!pos.ptr)
-                Iterator_error();
-            Nodeptr node = pos.ptr;
-            if (begin_node == node)                 //begin++
-                begin_node = begin_node->Next_node();
-            iterator res(Fix_violation_before_erase(node));
-            if (node == node->parent->left)
-                node->parent->left = nullptr;
-            else if (node == node->parent->right)
-                node->parent->right = nullptr;
-            Destroy(node);
-            if (!(--val_size)) {
-                dummy.left = dummy.right = nullptr;
-                root = nullptr;
-                begin_node = &dummy;
-            }
-            return res;
-        }
-
-        iterator Erase(iterator begin, iterator end) {
-            if (!begin.ptr || !end.ptr)
-                Iterator_error();
-            iterator cur = begin, next = begin;
-            for (; cur != end; cur = next) {
-                next++;
-                Erase(cur);
-            }
-            return cur;
-        }
-
-        template <typename Ref>
-        size_type Erase(Ref&& key) {
-            iterator pos = Find(std::forward<Ref>(key));
-            if (pos != End()) {
-                Erase(pos);
-                return 1;
-            }
-            else {
-                return 0;
-            }
-        }
-
-        void Swap(red_black_tree& another) noexcept {
-            OCT_TREE_VAL_PACK_UNWRAP
-                Nodeptr temp_root = root;
-            Nodeptr temp_begin_node = begin_node;
-            size_type temp_size = val_size;
-
-            root = another.val_pack.second.second.root;
-            dummy.left = dummy.right = root;
-            root->parent = &dummy;
-            begin_node = another.val_pack.second.second.begin_node;
-            val_size = another.val_pack.second.second.val_size;
-
-            another.val_pack.second.second.dummy.left = another.val_pack.second.second.dummy.right = temp_root;
-            temp_root->parent = &another.val_pack.second.second.dummy;
-            another.val_pack.second.second.root = temp_root;
-            another.val_pack.second.second.begin_node = temp_begin_node;
-            another.val_pack.second.second.val_size = temp_size;
-        }
-
-        template <typename Ref>
-        size_type Count(Ref&& key) {
-            return Find(std::forward<Ref>(key)) != End();
-        }
-
-        template <typename Ref>
-        iterator Find(Ref&& key) {
-            OCT_TREE_VAL_PACK_UNWRAP
-            Nodeptr cur = root;
-            while (cur) {
-                if (kcomp(key, cur->Key())) {
-                    cur = cur->left;
-                    continue;
-                }
-                if (kcomp(cur->Key(), key)) {
-                    cur = cur->right;
-                    continue;
-                }
-                break;
-            }
-            return cur ? iterator(cur) : End();
-        }
-
-        template <typename Ref>
-        pair<iterator, iterator> Equal_range(Ref&& key) {
-            return pair<iterator, iterator>(Lower_bound(key), Upper_bound(key));
-        }
-
-        template <typename Ref>
-        iterator Lower_bound(Ref&& key) {
-            OCT_TREE_VAL_PACK_UNWRAP
-            Nodeptr cur = root, pre = nullptr;
-            while (cur) {
-                if (!kcomp(cur->Key(), key) && !kcomp(key, cur->Key()))
-                    return iterator(cur);
-
-                if (kcomp(key, cur->Key())) {
-                    pre = cur; 
-                    cur = cur->left;
-                }
-                else {
-                    cur = cur->right;
-                }
-            }
-            return pre ? iterator(pre) : End();
-        }
-
-        template <typename Ref>
-        iterator Upper_bound(Ref&& key) {
-            OCT_TREE_VAL_PACK_UNWRAP
-            Nodeptr cur = root, pre = nullptr;
-            while (cur) {
-                if (kcomp(key, cur->Key())) {
-                    pre = cur;
-                    cur = cur->left;
-                }
-                else {
-                    cur = cur->right;
-                }
-            }
-            return pre ? iterator(pre) : End();
-        }
-
-        key_compare Key_comp() const noexcept {
-            return key_compare();
-        }
-
-        value_compare value_comp() const noexcept {
-            return value_compare();
-        }
-
-    private:
-        void Tidy(Nodeptr node) {
-            if (!node)
-                return;
-            Tidy(node->left);
-            Tidy(node->right);
-
-            Destroy(node);
-        }
-
-        void Fix_violation_after_insert(Nodeptr node) {
-            while (true) {
-                Nodeptr parent = node->parent;
-                
-                if (parent == &val_pack.second.second.dummy) {
-                    node->color = Color::black;
-                    return;
-                }
-                else if (!(node->color == Color::red && parent->color == Color::red))
-                    return;
-
-                Nodeptr grandparent = parent->parent;
-                Dir parent_dir = parent == grandparent->left ? Dir::is_left : Dir::is_right;
-                Dir node_dir = node == parent->left ? Dir::is_left : Dir::is_right;
-                Nodeptr uncle = (parent_dir == Dir::is_left ? grandparent->right : grandparent->left);
-
-                if (uncle && uncle->color == Color::red) {
-                    parent->color = uncle->color = Color::black;
-                    grandparent->color = Color::red;
-                    node = grandparent;
-                }
-                else {
-                     if (node_dir == Dir::is_left && parent_dir == Dir::is_left) {
-                            //LL
-                        Rotate_right(grandparent);
-                        swap(parent->color, grandparent->color);
-                     }
-                     else if (node_dir == Dir::is_right && parent_dir == Dir::is_right) {
-                            //RR
-                        Rotate_left(grandparent);
-                        swap(parent->color, grandparent->color);
-                     }
-                     else if (node_dir == Dir::is_right && parent_dir == Dir::is_left) {
-                            //LR
-                        Rotate_left(parent);
-                        Rotate_right(grandparent);
-                        swap(node->color, grandparent->color);
-                     }
-                     else if (node_dir == Dir::is_left && parent_dir == Dir::is_right) {
-                            //RL
-                        Rotate_right(parent);
-                        Rotate_left(grandparent);
-                        swap(node->color, grandparent->color);
-                     }
-                }
-            }
-        }
-
-        Nodeptr Fix_violation_before_erase(Nodeptr node) {
-            OCT_TREE_VAL_PACK_UNWRAP
-            Nodeptr lchild = node->left, rchild = node->right;
-            Nodeptr parent = node->parent;
-            Nodeptr res = node->Next_node();
-
-            if (!lchild && !rchild) {                   //无孩子
-                if (root == node) {                     //根节点直接删
-                    New_root(nullptr);
-                }
-                else if (node->color == Color::black) { //这是非根黑节点
-                    Childless_black_erase(node);
-                }
-                //红节点直接删
-            }
-            else if (!(lchild && rchild)) {             //一个孩子
-                Nodeptr child = lchild ? lchild : rchild;
-                child->color = Color::black;            //染色
-                New_child(node, child);                 //顶替
-            }
-            else {                                      //两个孩子
-                Nodeptr next = node->Next_node();
-                bool node_is_root = node == root;
-                bool next_is_root = next == root;
-                if (next->parent != node && next != parent) {
-                    //交换父节点
-                    if (next_is_root)
-                        New_root(node);
-                    else {
-                        if (next == next->parent->left)
-                            next->parent->left = node;
-                        else
-                            next->parent->right = node;
-                        node->parent = next->parent;
-                    }
-                    if (node_is_root)
-                        New_root(next);
-                    else {
-                        if (parent->left == node)
-                            parent->left = next;
-                        else
-                            parent->right = next;
-                        next->parent = parent;
-                    }
-                    //
-                    if (next->left)
-                        swap(next->left->parent, lchild->parent);
-                    else
-                        lchild->parent = next;
-
-                    if (next->right)
-                        swap(next->right->parent, rchild->parent);
-                    else
-                        rchild->parent = next;
-
-                    swap(next->left, node->left);
-                    swap(next->right, node->right);
-                }
-                else if (node == next->parent){
-                    //只能是   [node]
-                    //       []     [next]
-                    //           [null]  []
-
-                    /*
-                    if (node_is_root)
-                        New_root(next);
-                    else {
-                        if (node == node->parent->left)
-                            node->parent->left = next;
-                        else
-                            node->parent->right = next;
-                        next->parent = node->parent;
-                    }*/
-                    New_child(node, next);
-                    node->parent = next;
-                    
-                    if (node->left)
-                        node->left->parent = next;
-                    swap(node->left, next->left);
-                    if (next->right)
-                        next->right->parent = node;
-                    node->right = next->right;
-                    next->right = node;
-                }
-                else {
-                    //只能是       [next]
-                    //        [node]    []
-                    //       []  [null]
-
-                    /*
-                    if (next == root)
-                        New_root(next);
-                    else
-                        node->parent = next->parent;
-                    next->parent = node;
-                    */
-                    New_child(next, node);
-                    if (next->right)
-                        next->left->parent = node;
-                    swap(node->right, next->right);
-                    if (node->left)
-                        node->left->parent = next;
-                    next->left = node->left;
-                    node->left = next;
-                }
-
-                swap(next->color, node->color);
-                
-                Fix_violation_before_erase(node);
-            }
-            return res;
-        }
-
-        void Childless_black_erase(Nodeptr node) {
-            OCT_TREE_VAL_PACK_UNWRAP
-            Nodeptr parent = node->parent;
-            Dir node_dir = node == parent->left ? Dir::is_left : Dir::is_right;
-            Nodeptr brother = nullptr;
-            Dir brother_dir;
-            if (node_dir == Dir::is_left) {
-                brother = parent->right;
-                parent->left = nullptr;
-                brother_dir = Dir::is_right;
-            }
-            else {
-                brother = parent->left;
-                parent->right = nullptr; 
-                brother_dir = Dir::is_left;
-            }
-
-            Nodeptr brother_left = brother ? brother->left : nullptr;
-            Nodeptr brother_right = brother ? brother->right : nullptr;
-
-            if (!brother || brother->color == Color::black) {   //兄弟是黑节点
-                if (brother_left && brother_left->color == Color::red ||
-                    brother_right && brother_right->color == Color::red) {//有红侄子
-                    if (brother_dir == Dir::is_left) {              //L
-                        if (brother_left && brother_left->color == Color::red) {    //LL
-                            brother_left->color = brother->color;
-                            brother->color = parent->color;
-                            parent->color = Color::black;
-                            Rotate_right(parent);
-                        }
-                        else if (brother_right && brother_right->color == Color::red) {//LR
-                            brother_right->color = parent->color;
-                            parent->color = Color::black;
-                            Rotate_left(brother);
-                            Rotate_right(parent);
-                        }
-                    }
-                    else {                                          //R
-                        if (brother_right && brother_right->color == Color::red) {    //RR
-                            brother_right->color = brother->color;
-                            brother->color = parent->color;
-                            parent->color = Color::black;
-                            Rotate_left(parent);
-                        }
-                        else if (brother_left && brother_left->color == Color::red) {//RL
-                            brother_left->color = parent->color;
-                            brother->color = Color::black;
-                            Rotate_right(brother);
-                            Rotate_left(parent);
-                        }
-                    }
-                }
-                else {                                              //兄弟全家黑
-                    if (parent->color == Color::red) {
-                        if (brother)
-                            brother->color = Color::red;
-                        parent->color = Color::black;
-                    }
-                    else {
-                        Childless_black_erase(parent);
-                    }
-                }
-            }
-            else {                                                  //兄弟红
-                brother->color = Color::black;
-                parent->color = Color::red;
-                if (node_dir == Dir::is_left) {
-                    Rotate_left(parent);
-                }
-                else {
-                    Rotate_right(parent);
-                }
-                Childless_black_erase(node);
-            }
-        }
-
-        void Destroy(Nodeptr node) {
-            Alnode_traits::destroy(val_pack.second.get_first(), node);
-            Alnode_traits::deallocate(val_pack.second.get_first(), node, 1);
-        }
-
-        void Rotate_left(Nodeptr node) {
-            /*             [root]                               [root]
-            *          [[5]]    ...                          [10]     ...    
-            *       [2]   [10]                   ->      [[5]]  [11]
-            *           [8]  [11]                      [2]   [8]
-            */
-            Nodeptr right = node->right;
-            Nodeptr right_left = right->left;
-            if (node->parent != &val_pack.second.second.dummy) {
-                if (node == node->parent->left)
-                    node->parent->left = node->right;
-                if (node == node->parent->right)
-                    node->parent->right = node->right;
-            }
-            else {
-                val_pack.second.second.root = right;
-                val_pack.second.second.dummy.left = val_pack.second.second.dummy.right = right;
-            }
-            node->right->parent = node->parent;
-            node->parent = right;
-            right->left = node;
-            node->right = right_left;
-            if (right_left)
-                right_left->parent = node;
-        }
-
-        void Rotate_right(Nodeptr node) {
-            Nodeptr left = node->left;
-            Nodeptr left_right = left->right;
-            if (node->parent != &val_pack.second.second.dummy) {
-                if (node == node->parent->left) {
-                    node->parent->left = node->left;
-                }
-                if (node == node->parent->right)
-                    node->parent->right = node->left;
-            }
-            else {
-                val_pack.second.second.root = left;
-                val_pack.second.second.dummy.left = val_pack.second.second.dummy.right = left;
-            }
-            node->left->parent = node->parent;
-            node->parent = left;
-            left->right = node;
-            node->left = left_right;
-            if (left_right)
-                left_right->parent = node;
-        }
-
-        inline const key_type& Key_of(const_reference val) {
-            if constexpr (std::is_same_v<key_type, value_type>)
-                return val;
-            else
-                return val.first;
-        }
-
-        void New_root(Nodeptr node) {
-            OCT_TREE_VAL_PACK_UNWRAP
-            dummy.left = dummy.right = root = node;
-            if (node)
-                node->parent = &dummy;
-        }
-
-        void New_child(Nodeptr node, Nodeptr new_node) {
-            if (node == val_pack.second.second.root) {
-                New_root(new_node);
-            }
-            else {
-                Nodeptr parent = node->parent;
-                if (node == parent->left)
-                    parent->left = new_node;
-                else
-                    parent->right = new_node;
-                if (new_node)
-                    new_node->parent = parent;
-            }
-        }
-
-        [[noreturn]] static void Iterator_error() {
-            throw std::out_of_range("invalid map iterator");
-        }
-    };
-
-}
-
+#pragma once
+
+#ifndef OCT_TREE
+#define OCT_TREE
+
+#include <functional>
+#include <limits>
+#include "utility.hpp"
+#include "vector.hpp"
+#include "oct_node_handle.hpp"
+
+namespace oct {
+    struct tree_feature {
+        enum class Dir : bool {
+            is_left, is_right
+        };
+    };
+
+    struct red_black_tree_feature : public tree_feature {
+        enum class Color : bool {
+            black, red
+        };
+    };
+
+    struct avl_tree_feature : public tree_feature {
+        int balance = 0;
+    };
+
+    struct splay_tree_feature : public tree_feature {};
+
+    struct treap_feature : public tree_feature {
+        unsigned long long priority = 0;    //堆序优先级, 父节点不小于孩子
+        std::size_t size = 1;               //子树大小, split后O(1)得到两侧元素个数
+    };
+
+    //节点增强策略: 以基类形式为节点附加字段, Pull由左右孩子重新计算本节点的字段
+    //默认不附加任何字段; 结构改变(链接、旋转、删除)后树负责沿受影响的路径调用Pull
+    struct tree_augment {
+        static constexpr bool augmented = false;
+
+        template <typename Nodeptr>
+        static void Pull(Nodeptr) noexcept {}
+    };
+
+    struct subtree_size_augment : public tree_augment {
+        static constexpr bool augmented = true;
+
+        std::size_t size = 1;               //子树大小, 支持按名次查找与O(log n)求迭代器距离
+
+        template <typename Nodeptr>
+        static void Pull(Nodeptr node) noexcept {
+            node->size = 1 + (node->left ? node->left->size : 0) + (node->right ? node->right->size : 0);
+        }
+    };
+
+    //以幺半群增强: aggregate为子树内元素按中序经Monoid结合的结果, Proj由元素取出参与结合的值
+    //Monoid需可默认构造, 提供满足结合律的operator()(left, right)与单位元identity()
+    template <typename Ty, typename Monoid, typename Proj>
+    struct monoid_augment : public tree_augment {
+        static constexpr bool augmented = true;
+
+        Ty aggregate = Ty();
+
+        template <typename Nodeptr>
+        static void Pull(Nodeptr node) {
+            Monoid op;
+            Ty res = Proj()(node->val);
+            if (node->left)
+                res = op(node->left->aggregate, res);
+            if (node->right)
+                res = op(res, node->right->aggregate);
+            node->aggregate = std::move(res);
+        }
+    };
+
+    template <typename Ty>
+    struct sum_monoid {
+        Ty identity() const {
+            return Ty();
+        }
+
+        Ty operator()(const Ty& left, const Ty& right) const {
+            return left + right;
+        }
+    };
+
+    template <typename Ty, typename Compare = less<Ty>>
+    struct min_monoid {
+        Ty identity() const {
+            return std::numeric_limits<Ty>::max();
+        }
+
+        Ty operator()(const Ty& left, const Ty& right) const {
+            return Compare()(right, left) ? right : left;
+        }
+    };
+
+    template <typename Ty, typename Compare = less<Ty>>
+    struct max_monoid {
+        Ty identity() const {
+            return std::numeric_limits<Ty>::lowest();
+        }
+
+        Ty operator()(const Ty& left, const Ty& right) const {
+            return Compare()(left, right) ? right : left;
+        }
+    };
+
+    template <typename Feature, typename Augment>
+    struct augmented_feature : public Feature, public Augment {};
+
+    //不增强时直接以Feature为基类, 避免多个空基类在部分编译器上占用额外空间
+    template <typename Feature, typename Augment>
+    using tree_node_base_t = std::conditional_t<Augment::augmented, augmented_feature<Feature, Augment>, Feature>;
+
+    template <typename Ty, typename Feature, typename Augment = tree_augment>
+    struct tree_node : public tree_node_base_t<Feature, Augment> {
+        using key_type        = key_of_v<Ty>;
+        using value_type      = Ty;
+        using const_reference = const Ty&;
+
+        using Nodeptr = tree_node*;
+
+        value_type val;
+        Nodeptr parent;
+        Nodeptr left;
+        Nodeptr right;
+
+        tree_node() : tree_node(value_type()) {}
+
+        template <typename Ref>
+        tree_node(Ref&& elem,
+                  Nodeptr p = nullptr,
+                  Nodeptr l = nullptr,
+                  Nodeptr r = nullptr)
+            : val(std::forward<Ref>(elem))
+            , parent(p)
+            , left(l)
+            , right(r) {}
+
+        //由参数直接在节点内构造元素
+        template <typename... Args>
+        explicit tree_node(std::in_place_t, Args&&... args)
+            : val(std::forward<Args>(args)...)
+            , parent(nullptr)
+            , left(nullptr)
+            , right(nullptr) {}
+
+        tree_node(const tree_node&)            = delete;
+        tree_node& operator=(const tree_node&) = delete;
+        tree_node(tree_node&&)                 = delete;
+        tree_node& operator=(tree_node&&)      = delete;
+
+        Nodeptr Min_node() noexcept {
+            Nodeptr node = this;
+            while (node->left)
+                node = node->left;
+            return node;
+        }
+
+        Nodeptr Next_node() noexcept {
+            if (right) {
+                return right->Min_node();
+            }
+            else {
+                Nodeptr node = this;
+                while (node->parent && node == node->parent->right)
+                    node = node->parent;
+                return node->parent ? node->parent : node;
+            }
+        }
+
+        Nodeptr Max_node() noexcept {
+            Nodeptr node = this;
+            while (node->right)
+                node = node->right;
+            return node;
+        }
+
+        Nodeptr Prev_node() noexcept {
+            if (left) {
+                return left->Max_node();
+            }
+            else {
+                Nodeptr node = this;
+                while (node->parent && node == node->parent->left)
+                    node = node->parent;
+                return node->parent ? node->parent : node;
+            }
+        }
+
+        key_type& Key() noexcept {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val;
+            else
+                return val.first;
+        }
+
+        value_type& Val() noexcept {
+            return val;
+        }
+    };
+
+    template <typename Ty, typename Augment>
+    struct tree_node<Ty, red_black_tree_feature, Augment> : public tree_node_base_t<red_black_tree_feature, Augment> {
+        using key_type        = key_of_v<Ty>;
+        using value_type      = Ty;
+        using const_reference = const Ty&;
+        using Color           = red_black_tree_feature::Color;
+
+        using Nodeptr = tree_node*;
+
+        value_type val;
+        Nodeptr parent;
+        Nodeptr left;
+        Nodeptr right;
+        Color color;
+
+        tree_node() : tree_node(value_type()) {}
+
+        template <typename Ref>
+        tree_node(Ref&& elem, 
+                  Nodeptr p = nullptr, 
+                  Nodeptr l = nullptr, 
+                  Nodeptr r = nullptr, 
+                  Color c = Color::red) 
+            : val(std::forward<Ref>(elem))
+            , parent(p)
+            , left(l)
+            , right(r)
+            , color(c) {}
+
+        //由参数直接在节点内构造元素
+        template <typename... Args>
+        explicit tree_node(std::in_place_t, Args&&... args)
+            : val(std::forward<Args>(args)...)
+            , parent(nullptr)
+            , left(nullptr)
+            , right(nullptr)
+            , color(Color::red) {}
+
+        tree_node(const tree_node&)            = delete;
+        tree_node& operator=(const tree_node&) = delete;
+        tree_node(tree_node&&)                 = delete;
+        tree_node& operator=(tree_node&&)      = delete;
+
+        Nodeptr Min_node() noexcept {
+            Nodeptr node = this;
+            while (node->left)
+                node = node->left;
+            return node;
+        }
+
+        Nodeptr Next_node() noexcept {
+            if (right) {
+                return right->Min_node();
+            }
+            else {
+                Nodeptr node = this;
+                while (node->parent && node == node->parent->right)
+                    node = node->parent;
+                return node->parent ? node->parent : node;
+            }
+        }
+
+        Nodeptr Max_node() noexcept {
+            Nodeptr node = this;
+            while (node->right)
+                node = node->right;
+            return node;
+        }
+
+        Nodeptr Prev_node() noexcept {
+            if (left) {
+                return left->Max_node();
+            }
+            else {
+                Nodeptr node = this;
+                while (node->parent && node == node->parent->left)
+                    node = node->parent;
+                return node->parent ? node->parent : node;
+            }
+        }
+
+        key_type& Key() noexcept {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val;
+            else
+                return val.first;
+        }
+
+        value_type& Val() noexcept {
+            return val;
+        }
+    };
+
+    //只依赖parent/left/right的结构操作, 供tree_base与侵入式树共用
+    //header为哨兵: header的left与right都指向根, 根的parent为header; root为保存根的位置
+    template <typename Nodeptr, typename Augment = tree_augment>
+    struct tree_algorithm {
+        static Nodeptr Min_node(Nodeptr node) noexcept {
+            while (node->left)
+                node = node->left;
+            return node;
+        }
+
+        static Nodeptr Max_node(Nodeptr node) noexcept {
+            while (node->right)
+                node = node->right;
+            return node;
+        }
+
+        //最大节点的后继为header
+        static Nodeptr Next_node(Nodeptr node) noexcept {
+            if (node->right)
+                return Min_node(node->right);
+            while (node->parent && node == node->parent->right)
+                node = node->parent;
+            return node->parent ? node->parent : node;
+        }
+
+        static Nodeptr Prev_node(Nodeptr node) noexcept {
+            if (node->left)
+                return Max_node(node->left);
+            while (node->parent && node == node->parent->left)
+                node = node->parent;
+            return node->parent ? node->parent : node;
+        }
+
+        static void New_root(Nodeptr header, Nodeptr& root, Nodeptr node) noexcept {
+            header->left = header->right = root = node;
+            if (node)
+                node->parent = header;
+        }
+
+        static void New_child(Nodeptr header, Nodeptr& root, Nodeptr node, Nodeptr new_node) noexcept {
+            if (node == root) {
+                New_root(header, root, new_node);
+            }
+            else {
+                Nodeptr parent = node->parent;
+                if (node == parent->left)
+                    parent->left = new_node;
+                else
+                    parent->right = new_node;
+                if (new_node)
+                    new_node->parent = parent;
+            }
+        }
+
+        static void Rotate_left(Nodeptr header, Nodeptr& root, Nodeptr node) {
+            /*             [root]                               [root]
+            *          [[5]]    ...                          [10]     ...
+            *       [2]   [10]                   ->      [[5]]  [11]
+            *           [8]  [11]                      [2]   [8]
+            */
+            Nodeptr right = node->right;
+            Nodeptr right_left = right->left;
+            if (node->parent != header) {
+                if (node == node->parent->left)
+                    node->parent->left = node->right;
+                if (node == node->parent->right)
+                    node->parent->right = node->right;
+            }
+            else {
+                root = right;
+                header->left = header->right = right;
+            }
+            node->right->parent = node->parent;
+            node->parent = right;
+            right->left = node;
+            node->right = right_left;
+            if (right_left)
+                right_left->parent = node;
+            Augment::Pull(node);
+            Augment::Pull(right);
+        }
+
+        static void Rotate_right(Nodeptr header, Nodeptr& root, Nodeptr node) {
+            Nodeptr left = node->left;
+            Nodeptr left_right = left->right;
+            if (node->parent != header) {
+                if (node == node->parent->left)
+                    node->parent->left = node->left;
+                if (node == node->parent->right)
+                    node->parent->right = node->left;
+            }
+            else {
+                root = left;
+                header->left = header->right = left;
+            }
+            node->left->parent = node->parent;
+            node->parent = left;
+            left->right = node;
+            node->left = left_right;
+            if (left_right)
+                left_right->parent = node;
+            Augment::Pull(node);
+            Augment::Pull(left);
+        }
+
+        static void Swap_with_next(Nodeptr header, Nodeptr& root, Nodeptr node, Nodeptr next) noexcept {
+            //node有两个孩子, next为其中序后继(next->left必为空)
+            //交换二者在树中的位置而不移动元素, 外部持有的迭代器保持有效
+            Nodeptr lchild = node->left;
+            Nodeptr next_parent = next->parent;
+            Nodeptr next_right = next->right;
+
+            New_child(header, root, node, next);
+            next->left = lchild;
+            lchild->parent = next;
+            if (next_parent == node) {
+                next->right = node;
+                node->parent = next;
+            }
+            else {
+                next_parent->left = node;
+                node->parent = next_parent;
+                next->right = node->right;
+                next->right->parent = next;
+            }
+            node->left = nullptr;
+            node->right = next_right;
+            if (next_right)
+                next_right->parent = node;
+        }
+    };
+
+    //红黑树插入后与删除前的调整, 节点需有color字段
+    template <typename Nodeptr, typename Augment = tree_augment>
+    struct red_black_tree_algorithm : public tree_algorithm<Nodeptr, Augment> {
+        using Base  = tree_algorithm<Nodeptr, Augment>;
+        using Color = red_black_tree_feature::Color;
+        using Dir   = tree_feature::Dir;
+
+        //node已作为红色叶子链接到树中
+        static void Fix_after_insert(Nodeptr header, Nodeptr& root, Nodeptr node) {
+            while (true) {
+                Nodeptr parent = node->parent;
+                
+                if (parent == header) {
+                    node->color = Color::black;
+                    return;
+                }
+                else if (!(node->color == Color::red && parent->color == Color::red))
+                    return;
+
+                Nodeptr grandparent = parent->parent;
+                Dir parent_dir = parent == grandparent->left ? Dir::is_left : Dir::is_right;
+                Dir node_dir = node == parent->left ? Dir::is_left : Dir::is_right;
+                Nodeptr uncle = (parent_dir == Dir::is_left ? grandparent->right : grandparent->left);
+
+                if (uncle && uncle->color == Color::red) {
+                    parent->color = uncle->color = Color::black;
+                    grandparent->color = Color::red;
+                    node = grandparent;
+                }
+                else {
+                     if (node_dir == Dir::is_left && parent_dir == Dir::is_left) {
+                            //LL
+                        Base::Rotate_right(header, root, grandparent);
+                        swap(parent->color, grandparent->color);
+                     }
+                     else if (node_dir == Dir::is_right && parent_dir == Dir::is_right) {
+                            //RR
+                        Base::Rotate_left(header, root, grandparent);
+                        swap(parent->color, grandparent->color);
+                     }
+                     else if (node_dir == Dir::is_right && parent_dir == Dir::is_left) {
+                            //LR
+                        Base::Rotate_left(header, root, parent);
+                        Base::Rotate_right(header, root, grandparent);
+                        swap(node->color, grandparent->color);
+                     }
+                     else if (node_dir == Dir::is_left && parent_dir == Dir::is_right) {
+                            //RL
+                        Base::Rotate_right(header, root, parent);
+                        Base::Rotate_left(header, root, grandparent);
+                        swap(node->color, grandparent->color);
+                     }
+                }
+            }
+        }
+
+        //调整后node没有孩子且仍挂在原父节点下, 由调用者断开; 返回node的后继
+        static Nodeptr Fix_before_erase(Nodeptr header, Nodeptr& root, Nodeptr node) {
+            Nodeptr res = Base::Next_node(node);
+
+            if (node->left && node->right) {            //两个孩子: 与后继交换位置与颜色
+                Base::Swap_with_next(header, root, node, res);
+                swap(node->color, res->color);
+            }
+
+            Nodeptr child = node->left ? node->left : node->right;
+            if (child) {                                //一个孩子: 必为红, 染黑顶替
+                child->color = Color::black;
+                Base::New_child(header, root, node, child);
+            }
+            else if (root == node) {                    //根节点直接删
+                Base::New_root(header, root, nullptr);
+            }
+            else if (node->color == Color::black) {     //这是非根黑节点
+                Childless_black_erase(header, root, node);
+            }
+            //红节点直接删
+            return res;
+        }
+
+        static void Childless_black_erase(Nodeptr header, Nodeptr& root, Nodeptr node) {
+            Nodeptr parent = node->parent;
+            Dir node_dir = node == parent->left ? Dir::is_left : Dir::is_right;
+            if (node_dir == Dir::is_left)
+                parent->left = nullptr;
+            else
+                parent->right = nullptr;
+
+            while (true) {                              //node_dir一侧子树缺一个黑节点
+                Nodeptr brother = node_dir == Dir::is_left ? parent->right : parent->left;
+                if (brother->color == Color::red) {     //兄弟红: 转为兄弟黑
+                    brother->color = Color::black;
+                    parent->color = Color::red;
+                    if (node_dir == Dir::is_left)
+                        Base::Rotate_left(header, root, parent);
+                    else
+                        Base::Rotate_right(header, root, parent);
+                    continue;
+                }
+
+                Nodeptr near_nephew = node_dir == Dir::is_left ? brother->left : brother->right;
+                Nodeptr far_nephew = node_dir == Dir::is_left ? brother->right : brother->left;
+                if (far_nephew && far_nephew->color == Color::red) {        //RR/LL
+                    brother->color = parent->color;
+                    parent->color = Color::black;
+                    far_nephew->color = Color::black;
+                    if (node_dir == Dir::is_left)
+                        Base::Rotate_left(header, root, parent);
+                    else
+                        Base::Rotate_right(header, root, parent);
+                    return;
+                }
+                if (near_nephew && near_nephew->color == Color::red) {      //RL/LR
+                    near_nephew->color = parent->color;
+                    parent->color = Color::black;
+                    if (node_dir == Dir::is_left) {
+                        Base::Rotate_right(header, root, brother);
+                        Base::Rotate_left(header, root, parent);
+                    }
+                    else {
+                        Base::Rotate_left(header, root, brother);
+                        Base::Rotate_right(header, root, parent);
+                    }
+                    return;
+                }
+
+                brother->color = Color::red;            //兄弟全家黑
+                if (parent->color == Color::red) {
+                    parent->color = Color::black;
+                    return;
+                }
+                Nodeptr grandparent = parent->parent;
+                if (grandparent == header)
+                    return;
+                node_dir = parent == grandparent->left ? Dir::is_left : Dir::is_right;
+                parent = grandparent;
+            }
+        }
+    };
+
+    template <
+        typename Kty,
+        typename Vty,
+        typename Kcompare,
+        typename Vcompare,
+        typename Allocator,
+        typename Feature,
+        typename Augment = tree_augment
+    >
+    struct tree_traits_base {
+    protected:
+        using Alty          = rebind_alloc_t<Allocator, Vty>;
+        using Alty_traits   = std::allocator_traits<Alty>;
+        using Node          = tree_node<Vty, Feature, Augment>;
+        using Alnode        = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+
+    public:
+        using key_type           = Kty;
+        using value_type         = Vty;
+        using size_type          = typename Alty_traits::size_type;
+        using difference_type    = typename Alty_traits::difference_type;
+        using key_compare        = Kcompare;
+        using value_compare      = Vcompare;
+        using allocator_type     = Allocator;
+        using reference          = Vty&;
+        using const_reference    = const Vty&;
+        using pointer            = typename Alty_traits::pointer;
+        using const_pointer      = typename Alty_traits::const_pointer;
+    };
+
+    template <typename Tree>
+    struct tree_val {
+        using value_type = typename Tree::value_type;
+        using size_type  = typename Tree::size_type;
+
+        using Node    = typename Tree::Node;
+        using Nodeptr = typename Tree::Nodeptr;
+
+        Node dummy;
+        Nodeptr root;
+        Nodeptr begin_node;
+        Nodeptr last_node;                          //最大元素, 供end()提示插入O(1)追加
+        size_type val_size;
+        Nodeptr batch;                              //有序批量构造时连续分配的节点块, 随Clear释放
+        size_type batch_size;
+
+        tree_val() 
+            : dummy()
+            , root(nullptr)
+            , begin_node(&dummy)
+            , last_node(&dummy)
+            , val_size(0)
+            , batch(nullptr)
+            , batch_size(0) {}
+
+        tree_val(tree_val&& another) noexcept {
+            operator=(std::move(another));
+        }
+
+        tree_val& operator=(tree_val&& another) noexcept {
+            if (this == &another)
+                return *this;
+            dummy.left = another.dummy.left;
+            dummy.right = another.dummy.right;
+            root = another.root;
+            if (root)
+                root->parent = &dummy;
+            begin_node = another.begin_node == &another.dummy ? &dummy : another.begin_node;
+            last_node = another.last_node == &another.dummy ? &dummy : another.last_node;
+            val_size = another.val_size;
+            batch = another.batch;
+            batch_size = another.batch_size;
+
+            another.dummy.left = another.dummy.right = nullptr;
+            another.root = nullptr;
+            another.begin_node = another.last_node = &another.dummy;
+            another.val_size = 0;
+            another.batch = nullptr;
+            another.batch_size = 0;
+            return *this;
+        }
+    };
+
+#define OCT_TREE_VAL_PACK_UNWRAP Node&        dummy      = val_pack.second.second.dummy;      \
+                                 Nodeptr&     root       = val_pack.second.second.root;       \
+                                 Nodeptr&     begin_node = val_pack.second.second.begin_node; \
+                                 Nodeptr&     last_node  = val_pack.second.second.last_node;  \
+                                 key_compare& kcomp      = val_pack.get_first();              \
+                                 size_type&   val_size   = val_pack.second.second.val_size;   \
+                                 Alnode&      alloc      = val_pack.second.get_first();
+                                 
+    //各后端共用的查找、插入与删除; 后端Derived以Fix_insert/Fix_erase维护平衡,
+    //位置不由查找路径决定的后端(树堆)改写Link_at, 伸展树以Access把访问到的节点伸展至根
+    template <
+        typename Kty,
+        typename Vty,
+        typename Kcompare,
+        typename Vcompare,
+        typename Allocator,
+        typename Feature,
+        typename Augment,
+        typename Derived
+    >
+    class tree_base : public tree_traits_base<Kty, Vty, Kcompare, Vcompare, Allocator, Feature, Augment> {
+    protected:
+        using Base          = tree_traits_base<Kty, Vty, Kcompare, Vcompare, Allocator, Feature, Augment>;
+        using Alty          = typename Base::Alty;
+        using Alty_traits   = typename Base::Alty_traits;
+        using Node          = typename Base::Node;
+        using Alnode        = typename Base::Alnode;
+        using Alnode_traits = typename Base::Alnode_traits;
+        using Nodeptr       = typename Base::Nodeptr;
+        using Algorithm     = tree_algorithm<Nodeptr, Augment>;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using key_compare        = typename Base::key_compare;
+        using value_compare      = typename Base::value_type;
+        using allocator_type     = typename Base::allocator_type;
+        using reference          = typename Base::reference;
+        using const_reference    = typename Base::const_reference;
+        using pointer            = typename Base::pointer;
+        using const_pointer      = typename Base::const_pointer;
+
+        using iterator           = tree_iterator<tree_base>;
+        using node_type          = node_handle<Node, Alnode>;
+        using insert_return_type = node_insert_return<iterator, node_type>;
+
+    private:
+        friend iterator;
+        friend struct tree_val<tree_base>;
+
+    protected:
+        mutable compressed_pair<key_compare,
+                                compressed_pair<Alnode, tree_val<tree_base>>
+                               > val_pack;
+
+        //树堆自带子树大小, 其余后端需以subtree_size_augment增强
+        static constexpr bool Order_statistic = std::is_same_v<Feature, treap_feature>
+                                             || std::is_base_of_v<subtree_size_augment, Augment>;
+
+        tree_base() : val_pack(key_compare(), Alnode()) {}
+
+        explicit tree_base(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : val_pack(comp, alloc) {}
+
+        explicit tree_base(const allocator_type& alloc)
+            : val_pack(key_compare(), alloc) {}
+
+        tree_base(tree_base&& another) noexcept
+            : val_pack(std::move(another.val_pack)) {}
+
+        ~tree_base() {
+            Clear();
+        }
+
+        tree_base& operator=(tree_base&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Clear();
+            val_pack.second.second = std::move(another.val_pack.second.second);
+            return *this;
+        }
+
+        allocator_type Get_allocator() const noexcept {
+            return val_pack.second.get_first();
+        }
+
+        iterator Begin() const noexcept {
+            return iterator(val_pack.second.second.begin_node);
+        }
+
+        iterator End() const noexcept {
+            return iterator(&val_pack.second.second.dummy);
+        }
+
+        bool Empty() const noexcept {
+            return !val_pack.second.second.val_size;
+        }
+
+        size_type Size() const noexcept {
+            return val_pack.second.second.val_size;
+        }
+
+        void Clear() {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Tidy(root);
+            Free_batch();
+
+            dummy.left = dummy.right = nullptr;
+            root = nullptr;
+            begin_node = last_node = &dummy;
+            val_size = 0;
+        }
+
+        void Swap(tree_base& another) noexcept {
+            tree_val<tree_base> temp(std::move(val_pack.second.second));
+            val_pack.second.second = std::move(another.val_pack.second.second);
+            another.val_pack.second.second = std::move(temp);
+        }
+
+        reference operator[](const key_type& key) {
+            return Node_of(Insert_at(Insert_position(key), std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>()).first)->Val();
+        }
+
+        pair<iterator, bool> Insert(const_reference target) {
+            return Insert_at(Insert_position(Key_of(target)), target);
+        }
+
+        iterator Insert(iterator hint, const_reference target) {
+            return Insert_at(Hint_position(hint, Key_of(target)), target).first;
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void Insert(ForwardIt begin, ForwardIt end) {
+            if (Build_sorted<true>(begin, end))
+                return;
+            for (; begin != end; ++begin)
+                Insert(End(), *begin);
+        }
+
+        void Insert(std::initializer_list<value_type> ini_list) {
+            Insert(ini_list.begin(), ini_list.end());
+        }
+
+        iterator Erase(iterator pos) {
+            Nodeptr node = Node_of(pos);
+            if (!node || node == &val_pack.second.second.dummy)
+                Iterator_error();
+            iterator res(Unlink(node));
+            Destroy(node);
+            return res;
+        }
+
+        iterator Erase(iterator begin, iterator end) {
+            if (!Node_of(begin) || !Node_of(end))
+                Iterator_error();
+            iterator cur = begin, next = begin;
+            for (; cur != end; cur = next) {
+                next++;
+                Erase(cur);
+            }
+            return cur;
+        }
+
+        template <typename Ref>
+        size_type Erase(Ref&& key) {
+            iterator pos = Self().Find(std::forward<Ref>(key));
+            if (pos != End()) {
+                Erase(pos);
+                return 1;
+            }
+            else {
+                return 0;
+            }
+        }
+
+        //先构造节点才能得到关键字, 关键字已存在时销毁新节点
+        template <typename... Args>
+        pair<iterator, bool> Emplace(Args&&... args) {
+            Nodeptr node = Construct_node(std::forward<Args>(args)...);
+            return Link_or_destroy(Insert_position(node->Key()), node);
+        }
+
+        //关键字已存在时不构造节点, args也不会被移走
+        template <typename Kref, typename... Args>
+        pair<iterator, bool> Try_emplace(Kref&& key, Args&&... args) {
+            return Insert_at(Insert_position(key), std::piecewise_construct, std::forward_as_tuple(std::forward<Kref>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        template <typename... Args>
+        iterator Emplace_hint(iterator hint, Args&&... args) {
+            Nodeptr node = Construct_node(std::forward<Args>(args)...);
+            return Link_or_destroy(Hint_position(hint, node->Key()), node).first;
+        }
+
+        //有序输入每个元素从上一次插入的节点出发查找位置, 整批只遍历树一次; 无序的元素退化为从根查找
+        //伸展树中上一个节点已被伸展到根, 向上查找为O(1)
+        template <typename ForwardIt>
+        void Insert_sorted(ForwardIt begin, ForwardIt end) {
+            if (Build_sorted<true>(begin, end))
+                return;
+            Nodeptr last = nullptr;
+            for (; begin != end; ++begin)
+                last = Node_of(Insert_at(Finger_position(last, Key_of(*begin)), *begin).first);
+        }
+
+        node_type Extract(iterator pos) {
+            Nodeptr node = Node_of(pos);
+            if (!node || node == &val_pack.second.second.dummy)
+                Iterator_error();
+            Unlink(node);
+            return Make_handle(node);
+        }
+
+        template <typename Ref>
+        node_type Extract(const Ref& key) {
+            iterator pos = Self().Find(key);
+            if (pos == End())
+                return node_type();
+            return Extract(pos);
+        }
+
+        insert_return_type Insert(node_type&& handle) {
+            if (handle.empty())
+                return insert_return_type{ End(), false, node_type() };
+            pair<Nodeptr, Nodeptr*> pos = Insert_position(handle.key());
+            Nodeptr node = *pos.second;
+            bool inserted = !node;
+            if (inserted)
+                node = Self().Link_at(pos, Take_node(handle));
+            Self().Access(node);
+            return insert_return_type{ iterator(node), inserted, std::move(handle) };
+        }
+
+        iterator Insert(iterator hint, node_type&& handle) {
+            if (handle.empty())
+                return End();
+            pair<Nodeptr, Nodeptr*> pos = Hint_position(hint, handle.key());
+            Nodeptr node = *pos.second;
+            if (!node)
+                node = Self().Link_at(pos, Take_node(handle));
+            Self().Access(node);
+            return iterator(node);
+        }
+
+        //another中关键字在本树里不存在的节点直接转入本树, 其余留在another中; 要求两棵树的分配器相等
+        void Merge(Derived& another) {
+            tree_base& source = another;
+            if (this == &source)
+                return;
+            Nodeptr end = &source.val_pack.second.second.dummy;
+            for (Nodeptr node = source.val_pack.second.second.begin_node; node != end; ) {
+                pair<Nodeptr, Nodeptr*> pos = Insert_position(node->Key());
+                if (*pos.second) {
+                    node = node->Next_node();
+                    continue;
+                }
+                Nodeptr next = source.Unlink(node);
+                Self().Access(Self().Link_at(pos, source.Relocate(node)));
+                node = next;
+            }
+        }
+
+        template <typename Ref>
+        size_type Count(Ref&& key) const {
+            return Find(std::forward<Ref>(key)) != End();
+        }
+
+        template <typename Ref>
+        iterator Find(Ref&& key) const {
+            Nodeptr cur = Find_node(key);
+            return cur ? iterator(cur) : End();
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> Equal_range(Ref&& key) const {
+            return pair<iterator, iterator>(Lower_bound(key), Upper_bound(key));
+        }
+
+        template <typename Ref>
+        iterator Lower_bound(Ref&& key) const {
+            Nodeptr pre = Lower_bound_node(key);
+            return pre ? iterator(pre) : End();
+        }
+
+        template <typename Ref>
+        iterator Upper_bound(Ref&& key) const {
+            Nodeptr pre = Upper_bound_node(key);
+            return pre ? iterator(pre) : End();
+        }
+
+        //第k小(从0起)的元素, k不小于元素个数时返回End()
+        iterator Find_by_order(size_type k) const {
+            static_assert(Order_statistic, "find_by_order requires subtree size augmentation");
+            Nodeptr cur = val_pack.second.second.root;
+            while (cur) {
+                size_type lsize = Size_of(cur->left);
+                if (k < lsize) {
+                    cur = cur->left;
+                }
+                else if (k > lsize) {
+                    k -= lsize + 1;
+                    cur = cur->right;
+                }
+                else {
+                    return iterator(cur);
+                }
+            }
+            return End();
+        }
+
+        //严格小于key的元素个数
+        template <typename Ref>
+        size_type Order_of_key(const Ref& key) const {
+            static_assert(Order_statistic, "order_of_key requires subtree size augmentation");
+            OCT_TREE_VAL_PACK_UNWRAP
+            size_type res = 0;
+            Nodeptr cur = root;
+            while (cur) {
+                if (kcomp(cur->Key(), key)) {
+                    res += Size_of(cur->left) + 1;
+                    cur = cur->right;
+                }
+                else {
+                    cur = cur->left;
+                }
+            }
+            return res;
+        }
+
+        key_compare Key_comp() const noexcept {
+            return val_pack.get_first();
+        }
+
+        value_compare value_comp() const noexcept {
+            return value_compare();
+        }
+
+        template <typename Ref>
+        Nodeptr Find_node(const Ref& key) const {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr cur = root;
+            while (cur) {
+                if (kcomp(key, cur->Key())) {
+                    cur = cur->left;
+                    continue;
+                }
+                if (kcomp(cur->Key(), key)) {
+                    cur = cur->right;
+                    continue;
+                }
+                break;
+            }
+            return cur;
+        }
+
+        template <typename Ref>
+        Nodeptr Lower_bound_node(const Ref& key) const {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr cur = root, pre = nullptr;
+            while (cur) {
+                if (!kcomp(cur->Key(), key)) {
+                    pre = cur;
+                    cur = cur->left;
+                }
+                else {
+                    cur = cur->right;
+                }
+            }
+            return pre;
+        }
+
+        template <typename Ref>
+        Nodeptr Upper_bound_node(const Ref& key) const {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr cur = root, pre = nullptr;
+            while (cur) {
+                if (kcomp(key, cur->Key())) {
+                    pre = cur;
+                    cur = cur->left;
+                }
+                else {
+                    cur = cur->right;
+                }
+            }
+            return pre;
+        }
+
+        template <typename Ref>
+        pair<Nodeptr, Nodeptr*> Insert_position(const Ref& key) const {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr  parent = &dummy;
+            Nodeptr* address = &root;
+            while (*address) {
+                parent = *address;
+                if (kcomp(key, parent->Key())) {
+                    address = &parent->left;
+                    continue;
+                }
+                if (kcomp(parent->Key(), key)) {
+                    address = &parent->right;
+                    continue;
+                }
+                break;
+            }
+            return pair<Nodeptr, Nodeptr*>(parent, address);
+        }
+
+        static Nodeptr Node_of(iterator it) noexcept {
+            return it.ptr;
+        }
+
+        static size_type Size_of(Nodeptr node) noexcept {
+            return node ? node->size : 0;
+        }
+
+        //node的名次, 哨兵(end)的名次为元素个数; 哨兵的parent为空, 根的parent为哨兵
+        static size_type Rank(Nodeptr node) noexcept {
+            size_type res = Size_of(node->left);
+            if (!node->parent)
+                return res;
+            for (; node->parent->parent; node = node->parent)
+                if (node == node->parent->right)
+                    res += Size_of(node->parent->left) + 1;
+            return res;
+        }
+
+        //有子树大小时由名次相减得到, O(log n); 否则逐个遍历
+        static difference_type Distance(Nodeptr first, Nodeptr last) noexcept {
+            if constexpr (Order_statistic) {
+                return static_cast<difference_type>(Rank(last)) - static_cast<difference_type>(Rank(first));
+            }
+            else {
+                difference_type res = 0;
+                for (; first != last; first = first->Next_node())
+                    res++;
+                return res;
+            }
+        }
+
+        Nodeptr Root() const noexcept {
+            return val_pack.second.second.root;
+        }
+
+        //结构或元素改变后自node起向上重新计算增强字段直到根, 未增强时为空操作
+        void Pull_path(Nodeptr node) {
+            if constexpr (Augment::augmented) {
+                for (Nodeptr dummy = &val_pack.second.second.dummy; node != dummy; node = node->parent)
+                    Augment::Pull(node);
+            }
+        }
+
+        void Tidy(Nodeptr node) {
+            while (node) {                              //沿左链展开, 避免退化树上递归过深
+                if (node->left) {
+                    Nodeptr left = node->left;
+                    node->left = left->right;
+                    left->right = node;
+                    node = left;
+                }
+                else {
+                    Nodeptr right = node->right;
+                    Destroy(node);
+                    node = right;
+                }
+            }
+        }
+
+        void Destroy(Nodeptr node) {
+            Alnode_traits::destroy(val_pack.second.get_first(), node);
+            if (!In_batch(node))                        //批量块中的节点随块整体释放
+                Alnode_traits::deallocate(val_pack.second.get_first(), node, 1);
+        }
+
+        //块外的节点与块地址无关, 以std::less比较才有确定的全序
+        bool In_batch(Nodeptr node) const noexcept {
+            const tree_val<tree_base>& val = val_pack.second.second;
+            std::less<Nodeptr> less;
+            return val.batch && !less(node, val.batch) && less(node, val.batch + val.batch_size);
+        }
+
+        void Free_batch() {
+            tree_val<tree_base>& val = val_pack.second.second;
+            if (val.batch) {
+                Alnode_traits::deallocate(val_pack.second.get_first(), val.batch, val.batch_size);
+                val.batch = nullptr;
+                val.batch_size = 0;
+            }
+        }
+
+        //已摘下的节点若位于批量块中则不能单独释放, 把元素移入新分配的节点后交出
+        Nodeptr Relocate(Nodeptr node) {
+            if (!In_batch(node))
+                return node;
+            Alnode& alloc = val_pack.second.get_first();
+            Nodeptr res = Alnode_traits::allocate(alloc, 1);
+            Alnode_traits::construct(alloc, res, std::move(node->val));
+            Alnode_traits::destroy(alloc, node);
+            return res;
+        }
+
+        node_type Make_handle(Nodeptr node) {
+            return node_type(Relocate(node), val_pack.second.get_first());
+        }
+
+        static Nodeptr Take_node(node_type& handle) noexcept {
+            return handle.Release();
+        }
+
+        //新节点链接到pos后维护begin_node与last_node, 需在旋转之前调用
+        void Update_bound(pair<Nodeptr, Nodeptr*> pos, Nodeptr node) noexcept {
+            OCT_TREE_VAL_PACK_UNWRAP
+            if (begin_node == &dummy || pos.second == &begin_node->left)
+                begin_node = node;
+            if (last_node == &dummy || pos.second == &last_node->right)
+                last_node = node;
+        }
+
+        Derived& Self() noexcept {
+            return static_cast<Derived&>(*this);
+        }
+
+        //把已构造好的节点作为叶子链接到pos, 节点原有的链接被重置, 平衡信息由后端的Fix_insert重置并调整
+        Nodeptr Link_at(pair<Nodeptr, Nodeptr*> pos, Nodeptr node) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            node->parent = pos.first;
+            node->left = node->right = nullptr;
+            *pos.second = node;
+            Update_bound(pos, node);
+            Self().Fix_insert(node);
+            dummy.left = dummy.right = root;
+            val_size++;
+            return node;
+        }
+
+        //把node从树中摘下但不销毁, 返回其后继; 结构上的摘除与调整由后端的Fix_erase完成
+        Nodeptr Unlink(Nodeptr node) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr next = node->Next_node();
+            if (begin_node == node)                 //begin++
+                begin_node = next;
+            if (last_node == node)
+                last_node = node->Prev_node();
+            Self().Fix_erase(node, next);
+            if (!(--val_size)) {
+                dummy.left = dummy.right = nullptr;
+                root = nullptr;
+                begin_node = last_node = &dummy;
+            }
+            return next;
+        }
+
+        //查找或插入后访问到的节点, 只有伸展树需要
+        void Access(Nodeptr) noexcept {}
+
+        //pos处已有节点时返回该节点, 否则由args构造新节点链接到pos
+        template <typename... Args>
+        pair<iterator, bool> Insert_at(pair<Nodeptr, Nodeptr*> pos, Args&&... args) {
+            Nodeptr node = *pos.second;
+            bool inserted = !node;
+            if (inserted)
+                node = Self().Link_at(pos, Construct_node(std::forward<Args>(args)...));
+            Self().Access(node);
+            return pair<iterator, bool>(node, inserted);
+        }
+
+        pair<iterator, bool> Link_or_destroy(pair<Nodeptr, Nodeptr*> pos, Nodeptr node) {
+            bool inserted = !*pos.second;
+            if (inserted) {
+                node = Self().Link_at(pos, node);
+            }
+            else {
+                Destroy(node);
+                node = *pos.second;
+            }
+            Self().Access(node);
+            return pair<iterator, bool>(node, inserted);
+        }
+
+        //提示位置hint之前即为key的插入位置时O(1)返回链接点(对end()均摊O(1)), 否则退化为从根查找
+        template <typename Ref>
+        pair<Nodeptr, Nodeptr*> Hint_position(iterator hint, const Ref& key) const {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr next = Node_of(hint);
+            if (root && next) {
+                if (next == &dummy) {
+                    if (kcomp(last_node->Key(), key))
+                        return pair<Nodeptr, Nodeptr*>(last_node, &last_node->right);
+                }
+                else if (kcomp(key, next->Key())) {
+                    if (next == begin_node)
+                        return pair<Nodeptr, Nodeptr*>(next, &next->left);
+                    Nodeptr prev = next->Prev_node();
+                    if (kcomp(prev->Key(), key)) {
+                        if (!prev->right)
+                            return pair<Nodeptr, Nodeptr*>(prev, &prev->right);
+                        return pair<Nodeptr, Nodeptr*>(next, &next->left);
+                    }
+                }
+            }
+            return Insert_position(key);
+        }
+
+        //自上一次插入的节点from出发查找key的插入位置(finger search), 要求key不小于from的关键字
+        //向上走到子树范围覆盖key的最低祖先后再向下查找, 与from相距d个元素时为O(log d)
+        template <typename Ref>
+        pair<Nodeptr, Nodeptr*> Finger_position(Nodeptr from, const Ref& key) const {
+            OCT_TREE_VAL_PACK_UNWRAP
+            if (!from || kcomp(key, from->Key()))
+                return Insert_position(key);
+            Nodeptr top = from;
+            while (top->parent != &dummy) {
+                Nodeptr parent = top->parent;
+                if (top == parent->left && kcomp(key, parent->Key()))   //parent是top子树的上界
+                    break;
+                top = parent;
+            }
+            Nodeptr  parent = top->parent;
+            Nodeptr* address = top == root ? &root : top == parent->left ? &parent->left : &parent->right;
+            while (*address) {
+                parent = *address;
+                if (kcomp(key, parent->Key())) {
+                    address = &parent->left;
+                    continue;
+                }
+                if (kcomp(parent->Key(), key)) {
+                    address = &parent->right;
+                    continue;
+                }
+                break;
+            }
+            return pair<Nodeptr, Nodeptr*>(parent, address);
+        }
+
+        template <typename... Args>
+        Nodeptr Construct_node(Args&&... args) {
+            Alnode& alloc = val_pack.second.get_first();
+            Nodeptr node = Alnode_traits::allocate(alloc, 1);
+            try {
+                Alnode_traits::construct(alloc, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Alnode_traits::deallocate(alloc, node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        //空树上由有序输入在线性时间内直接建成完全平衡的树, 节点一次性连续分配
+        //Check为true时检查输入是否有序(相邻重复元素只保留第一个), 无序或树非空时返回false
+        template <bool Check, typename ForwardIt>
+        bool Build_sorted(ForwardIt begin, ForwardIt end) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            if (root)
+                return false;
+            size_type count = 0;
+            if constexpr (Check) {
+                if (begin == end)
+                    return true;
+                count = 1;
+                for (ForwardIt prev = begin, cur = std::next(begin); cur != end; prev = cur++) {
+                    if (kcomp(Key_of(*cur), Key_of(*prev)))
+                        return false;
+                    count += kcomp(Key_of(*prev), Key_of(*cur));
+                }
+            }
+            else {
+                count = static_cast<size_type>(std::distance(begin, end));
+                if (!count)
+                    return true;
+            }
+
+            //树堆的节点会在split/join中转移到其他树, 不能来自批量块
+            constexpr bool use_batch = !std::is_same_v<Feature, treap_feature>;
+            Free_batch();
+            vector<Nodeptr> nodes;
+            if constexpr (use_batch) {
+                val_pack.second.second.batch = Alnode_traits::allocate(alloc, count);
+                val_pack.second.second.batch_size = count;
+            }
+            else {
+                nodes.reserve(count);
+            }
+            Nodeptr batch = val_pack.second.second.batch;
+            size_type index = 0;
+            try {
+                for (ForwardIt prev = begin, cur = begin; cur != end; prev = cur++) {
+                    if (Check && cur != begin && !kcomp(Key_of(*prev), Key_of(*cur)))
+                        continue;
+                    if constexpr (use_batch)
+                        Alnode_traits::construct(alloc, batch + index, *cur);
+                    else
+                        nodes.push_back(Construct_node(*cur));
+                    index++;
+                }
+            }
+            catch (...) {                           //销毁已构造的元素, 树保持为空
+                for (size_type i = 0; i < index; i++) {
+                    if constexpr (use_batch)
+                        Alnode_traits::destroy(alloc, batch + i);
+                    else
+                        Destroy(nodes[i]);
+                }
+                Free_batch();
+                throw;
+            }
+
+            size_type height = 0;                   //最深一层的深度
+            while ((size_type(2) << height) <= count)
+                height++;
+            //最深一层不满时染红, 其余染黑, 保证每条路径黑节点数相同
+            size_type red_depth = count + 1 == (size_type(2) << height) ? size_type(-1) : height;
+            if constexpr (use_batch)
+                New_root(Build_subtree([batch](size_type i) { return batch + i; }, 0, count, 0, red_depth).first);
+            else
+                New_root(Build_subtree([&nodes](size_type i) { return nodes[i]; }, 0, count, 0, red_depth).first);
+            begin_node = root->Min_node();
+            last_node = root->Max_node();
+            val_size = count;
+            return true;
+        }
+
+        //以[first, last)的中点为根递归建树, 返回子树根与子树高度
+        template <typename Getter>
+        pair<Nodeptr, int> Build_subtree(Getter get, size_type first, size_type last, size_type depth, size_type red_depth) {
+            if (first == last)
+                return pair<Nodeptr, int>(nullptr, 0);
+            size_type mid = first + (last - first) / 2;
+            Nodeptr node = get(mid);
+            pair<Nodeptr, int> lchild = Build_subtree(get, first, mid, depth + 1, red_depth);
+            pair<Nodeptr, int> rchild = Build_subtree(get, mid + 1, last, depth + 1, red_depth);
+            node->left = lchild.first;
+            node->right = rchild.first;
+            if (lchild.first)
+                lchild.first->parent = node;
+            if (rchild.first)
+                rchild.first->parent = node;
+            Augment::Pull(node);
+            if constexpr (std::is_same_v<Feature, red_black_tree_feature>)
+                node->color = depth == red_depth ? red_black_tree_feature::Color::red : red_black_tree_feature::Color::black;
+            else if constexpr (std::is_same_v<Feature, avl_tree_feature>)
+                node->balance = rchild.second - lchild.second;
+            else if constexpr (std::is_same_v<Feature, treap_feature>) {
+                node->priority = ~0ull >> depth;    //越浅优先级越高, 满足堆序
+                node->size = last - first;
+            }
+            return pair<Nodeptr, int>(node, (lchild.second > rchild.second ? lchild.second : rchild.second) + 1);
+        }
+
+        void Rotate_left(Nodeptr node) {
+            Algorithm::Rotate_left(&val_pack.second.second.dummy, val_pack.second.second.root, node);
+        }
+
+        void Rotate_right(Nodeptr node) {
+            Algorithm::Rotate_right(&val_pack.second.second.dummy, val_pack.second.second.root, node);
+        }
+
+        static const key_type& Key_of(const_reference val) {
+            if constexpr (std::is_same_v<key_type, value_type>)
+                return val;
+            else
+                return val.first;
+        }
+
+        void New_root(Nodeptr node) {
+            Algorithm::New_root(&val_pack.second.second.dummy, val_pack.second.second.root, node);
+        }
+
+        void New_child(Nodeptr node, Nodeptr new_node) {
+            Algorithm::New_child(&val_pack.second.second.dummy, val_pack.second.second.root, node, new_node);
+        }
+
+        void Swap_with_next(Nodeptr node, Nodeptr next) {
+            Algorithm::Swap_with_next(&val_pack.second.second.dummy, val_pack.second.second.root, node, next);
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid map iterator");
+        }
+    };
+
+    template <
+        typename Kty,
+        typename Vty,
+        typename Kcompare,
+        typename Vcompare,
+        typename Allocator,
+        typename Augment = tree_augment
+    >
+    class red_black_tree : public tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, red_black_tree_feature, Augment, red_black_tree<Kty, Vty, Kcompare, Vcompare, Allocator, Augment>>,
+                           public red_black_tree_feature
+    {
+    protected:
+        using Base          = tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, red_black_tree_feature, Augment, red_black_tree>;
+        using Alty          = typename Base::Alty;
+        using Alty_traits   = typename Base::Alty_traits;
+        using Node          = typename Base::Node;
+        using Alnode        = typename Base::Alnode;
+        using Alnode_traits = typename Base::Alnode_traits;
+        using Nodeptr       = typename Base::Nodeptr;
+        using Rb_algorithm  = red_black_tree_algorithm<Nodeptr, Augment>;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using key_compare        = typename Base::key_compare;
+        using value_compare      = typename Base::value_type;
+        using allocator_type     = typename Base::allocator_type;
+        using reference          = typename Base::reference;
+        using const_reference    = typename Base::const_reference;
+        using pointer            = typename Base::pointer;
+        using const_pointer      = typename Base::const_pointer;
+
+        using iterator           = typename Base::iterator;
+        using node_type          = typename Base::node_type;
+        using insert_return_type = typename Base::insert_return_type;
+
+    protected:
+        using Base::val_pack;
+        using Base::End;
+        using Base::Find;
+        using Base::Key_of;
+        using Base::Node_of;
+        using Base::Insert;
+        using Base::Pull_path;
+
+        red_black_tree() : Base() {}
+
+        explicit red_black_tree(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : Base(comp, alloc) {}
+
+        explicit red_black_tree(const allocator_type& alloc)
+            : Base(alloc) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        red_black_tree(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : red_black_tree(comp, alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        red_black_tree(ForwardIt begin, ForwardIt end,
+            const allocator_type& alloc)
+            : red_black_tree(alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        red_black_tree(sorted_unique_t, ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : red_black_tree(comp, alloc) {
+            Base::template Build_sorted<false>(begin, end);
+        }
+
+        red_black_tree(const red_black_tree& another, const allocator_type& alloc = allocator_type())
+            : red_black_tree(another.Begin(), another.End()) {}
+
+        red_black_tree(red_black_tree&& another, const allocator_type& alloc = allocator_type()) noexcept
+            : Base(std::move(another)) {}
+
+        red_black_tree(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : red_black_tree(ini_list.begin(), ini_list.end(), comp, alloc) {}
+
+        red_black_tree(std::initializer_list<value_type> ini_list,
+            const allocator_type& alloc)
+            : red_black_tree(ini_list.begin(), ini_list.end(), alloc) {}
+
+        ~red_black_tree() {}
+
+        red_black_tree& operator=(const red_black_tree& another) {
+            if (this == &another)
+                return *this;
+            *this = red_black_tree(another);
+            return *this;
+        }
+
+        red_black_tree& operator=(red_black_tree&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Base::operator=(std::move(another));
+            return *this;
+        }
+
+    private:
+        friend Base;
+
+        //新节点已链接为红色叶子
+        void Fix_insert(Nodeptr node) {
+            node->color = Color::red;
+            Pull_path(node);                        //先更新增强字段, 之后的旋转只需局部维护
+            Rb_algorithm::Fix_after_insert(&val_pack.second.second.dummy, val_pack.second.second.root, node);
+        }
+
+        void Fix_erase(Nodeptr node, Nodeptr) {
+            Rb_algorithm::Fix_before_erase(&val_pack.second.second.dummy, val_pack.second.second.root, node);
+            if (node == node->parent->left)
+                node->parent->left = nullptr;
+            else if (node == node->parent->right)
+                node->parent->right = nullptr;
+            Pull_path(node->parent);                //摘除点以上的路径覆盖了交换与旋转影响到的所有节点
+        }
+    };
+
+    template <
+        typename Kty,
+        typename Vty,
+        typename Kcompare,
+        typename Vcompare,
+        typename Allocator,
+        typename Augment = tree_augment
+    >
+    class avl_tree : public tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, avl_tree_feature, Augment, avl_tree<Kty, Vty, Kcompare, Vcompare, Allocator, Augment>>,
+                     public tree_feature
+    {
+    protected:
+        using Base          = tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, avl_tree_feature, Augment, avl_tree>;
+        using Alty          = typename Base::Alty;
+        using Alty_traits   = typename Base::Alty_traits;
+        using Node          = typename Base::Node;
+        using Alnode        = typename Base::Alnode;
+        using Alnode_traits = typename Base::Alnode_traits;
+        using Nodeptr       = typename Base::Nodeptr;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using key_compare        = typename Base::key_compare;
+        using value_compare      = typename Base::value_type;
+        using allocator_type     = typename Base::allocator_type;
+        using reference          = typename Base::reference;
+        using const_reference    = typename Base::const_reference;
+        using pointer            = typename Base::pointer;
+        using const_pointer      = typename Base::const_pointer;
+
+        using iterator           = typename Base::iterator;
+        using node_type          = typename Base::node_type;
+        using insert_return_type = typename Base::insert_return_type;
+
+    protected:
+        using Base::val_pack;
+        using Base::End;
+        using Base::Find;
+        using Base::Key_of;
+        using Base::Node_of;
+        using Base::Destroy;
+        using Base::Rotate_left;
+        using Base::Rotate_right;
+        using Base::New_root;
+        using Base::New_child;
+        using Base::Swap_with_next;
+        using Base::Insert;
+        using Base::Pull_path;
+
+        avl_tree() : Base() {}
+
+        explicit avl_tree(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : Base(comp, alloc) {}
+
+        explicit avl_tree(const allocator_type& alloc)
+            : Base(alloc) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        avl_tree(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : avl_tree(comp, alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        avl_tree(ForwardIt begin, ForwardIt end,
+            const allocator_type& alloc)
+            : avl_tree(alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        avl_tree(sorted_unique_t, ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : avl_tree(comp, alloc) {
+            Base::template Build_sorted<false>(begin, end);
+        }
+
+        avl_tree(const avl_tree& another, const allocator_type& alloc = allocator_type())
+            : avl_tree(another.Begin(), another.End()) {}
+
+        avl_tree(avl_tree&& another, const allocator_type& alloc = allocator_type()) noexcept
+            : Base(std::move(another)) {}
+
+        avl_tree(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : avl_tree(ini_list.begin(), ini_list.end(), comp, alloc) {}
+
+        avl_tree(std::initializer_list<value_type> ini_list,
+            const allocator_type& alloc)
+            : avl_tree(ini_list.begin(), ini_list.end(), alloc) {}
+
+        ~avl_tree() {}
+
+        avl_tree& operator=(const avl_tree& another) {
+            if (this == &another)
+                return *this;
+            *this = avl_tree(another);
+            return *this;
+        }
+
+        avl_tree& operator=(avl_tree&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Base::operator=(std::move(another));
+            return *this;
+        }
+
+    private:
+        friend Base;
+
+        void Fix_insert(Nodeptr node) {
+            node->balance = 0;
+            Pull_path(node);
+            Fix_balance_after_insert(node);
+        }
+
+        void Fix_erase(Nodeptr node, Nodeptr next) {
+            Nodeptr dummy = &val_pack.second.second.dummy;
+            if (node->left && node->right) {        //与后继交换位置, 转化为至多一个孩子的情形
+                Swap_with_next(node, next);
+                swap(node->balance, next->balance);
+            }
+
+            Nodeptr parent = node->parent;
+            Dir node_dir = parent != dummy && node == parent->right ? Dir::is_right : Dir::is_left;
+            New_child(node, node->left ? node->left : node->right);
+            if (parent != dummy)
+                Fix_balance_after_erase(parent, node_dir);
+            Pull_path(parent);
+        }
+
+        void Fix_balance_after_insert(Nodeptr node) {
+            Nodeptr parent = node->parent;
+            while (parent != &val_pack.second.second.dummy) {
+                parent->balance += node == parent->left ? -1 : 1;
+                if (parent->balance == 0)               //子树高度未变
+                    return;
+                if (parent->balance == 2 || parent->balance == -2) {
+                    Rebalance(parent);                  //旋转后子树恢复插入前的高度
+                    return;
+                }
+                node = parent;
+                parent = parent->parent;
+            }
+        }
+
+        void Fix_balance_after_erase(Nodeptr parent, Dir node_dir) {
+            Nodeptr dummy = &val_pack.second.second.dummy;
+            while (true) {
+                parent->balance += node_dir == Dir::is_left ? 1 : -1;
+                if (parent->balance == 1 || parent->balance == -1)
+                    return;                             //子树高度未变
+                if (parent->balance != 0) {
+                    parent = Rebalance(parent);
+                    if (parent->balance != 0)           //单旋且兄弟平衡, 高度未变
+                        return;
+                }
+                Nodeptr grandparent = parent->parent;
+                if (grandparent == dummy)
+                    return;
+                node_dir = parent == grandparent->left ? Dir::is_left : Dir::is_right;
+                parent = grandparent;
+            }
+        }
+
+        Nodeptr Rebalance(Nodeptr node) {
+            if (node->balance < 0) {
+                Nodeptr left = node->left;
+                if (left->balance <= 0) {               //LL
+                    Rotate_right(node);
+                    node->balance = left->balance ? 0 : -1;
+                    left->balance = left->balance ? 0 : 1;
+                    return left;
+                }
+                Nodeptr left_right = left->right;       //LR
+                Rotate_left(left);
+                Rotate_right(node);
+                node->balance = left_right->balance < 0 ? 1 : 0;
+                left->balance = left_right->balance > 0 ? -1 : 0;
+                left_right->balance = 0;
+                return left_right;
+            }
+            else {
+                Nodeptr right = node->right;
+                if (right->balance >= 0) {              //RR
+                    Rotate_left(node);
+                    node->balance = right->balance ? 0 : 1;
+                    right->balance = right->balance ? 0 : -1;
+                    return right;
+                }
+                Nodeptr right_left = right->left;       //RL
+                Rotate_right(right);
+                Rotate_left(node);
+                node->balance = right_left->balance > 0 ? -1 : 0;
+                right->balance = right_left->balance < 0 ? 1 : 0;
+                right_left->balance = 0;
+                return right_left;
+            }
+        }
+    };
+
+    template <
+        typename Kty,
+        typename Vty,
+        typename Kcompare,
+        typename Vcompare,
+        typename Allocator,
+        typename Augment = tree_augment
+    >
+    class splay_tree : public tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, splay_tree_feature, Augment, splay_tree<Kty, Vty, Kcompare, Vcompare, Allocator, Augment>>,
+                       public tree_feature
+    {
+    protected:
+        using Base          = tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, splay_tree_feature, Augment, splay_tree>;
+        using Alty          = typename Base::Alty;
+        using Alty_traits   = typename Base::Alty_traits;
+        using Node          = typename Base::Node;
+        using Alnode        = typename Base::Alnode;
+        using Alnode_traits = typename Base::Alnode_traits;
+        using Nodeptr       = typename Base::Nodeptr;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using key_compare        = typename Base::key_compare;
+        using value_compare      = typename Base::value_type;
+        using allocator_type     = typename Base::allocator_type;
+        using reference          = typename Base::reference;
+        using const_reference    = typename Base::const_reference;
+        using pointer            = typename Base::pointer;
+        using const_pointer      = typename Base::const_pointer;
+
+        using iterator           = typename Base::iterator;
+        using node_type          = typename Base::node_type;
+        using insert_return_type = typename Base::insert_return_type;
+
+    protected:
+        using Base::val_pack;
+        using Base::End;
+        using Base::Key_of;
+        using Base::Node_of;
+        using Base::Destroy;
+        using Base::Rotate_left;
+        using Base::Rotate_right;
+        using Base::New_root;
+        using Base::New_child;
+        using Base::Swap_with_next;
+        using Base::Insert;
+
+        splay_tree() : Base() {}
+
+        explicit splay_tree(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : Base(comp, alloc) {}
+
+        explicit splay_tree(const allocator_type& alloc)
+            : Base(alloc) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        splay_tree(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : splay_tree(comp, alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        splay_tree(ForwardIt begin, ForwardIt end,
+            const allocator_type& alloc)
+            : splay_tree(alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        splay_tree(sorted_unique_t, ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : splay_tree(comp, alloc) {
+            Base::template Build_sorted<false>(begin, end);
+        }
+
+        splay_tree(const splay_tree& another, const allocator_type& alloc = allocator_type())
+            : splay_tree(another.Begin(), another.End()) {}
+
+        splay_tree(splay_tree&& another, const allocator_type& alloc = allocator_type()) noexcept
+            : Base(std::move(another)) {}
+
+        splay_tree(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : splay_tree(ini_list.begin(), ini_list.end(), comp, alloc) {}
+
+        splay_tree(std::initializer_list<value_type> ini_list,
+            const allocator_type& alloc)
+            : splay_tree(ini_list.begin(), ini_list.end(), alloc) {}
+
+        ~splay_tree() {}
+
+        splay_tree& operator=(const splay_tree& another) {
+            if (this == &another)
+                return *this;
+            *this = splay_tree(another);
+            return *this;
+        }
+
+        splay_tree& operator=(splay_tree&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Base::operator=(std::move(another));
+            return *this;
+        }
+
+        //非const查找会把访问到的节点伸展至根; const查找不修改树结构, 可供多个读者并发使用
+        template <typename Ref>
+        size_type Count(Ref&& key) {
+            return Find(std::forward<Ref>(key)) != End();
+        }
+
+        template <typename Ref>
+        size_type Count(Ref&& key) const {
+            return Base::Count(std::forward<Ref>(key));
+        }
+
+        template <typename Ref>
+        iterator Find(Ref&& key) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr cur = root, last = nullptr;
+            while (cur) {
+                last = cur;
+                if (kcomp(key, cur->Key())) {
+                    cur = cur->left;
+                    continue;
+                }
+                if (kcomp(cur->Key(), key)) {
+                    cur = cur->right;
+                    continue;
+                }
+                break;
+            }
+            if (last)
+                Splay(last);
+            return cur ? iterator(cur) : End();
+        }
+
+        template <typename Ref>
+        iterator Find(Ref&& key) const {
+            return Base::Find(std::forward<Ref>(key));
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> Equal_range(Ref&& key) {
+            iterator lower = Lower_bound(key);
+            return pair<iterator, iterator>(lower, Upper_bound(key));
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> Equal_range(Ref&& key) const {
+            return Base::Equal_range(std::forward<Ref>(key));
+        }
+
+        template <typename Ref>
+        iterator Lower_bound(Ref&& key) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr cur = root, last = nullptr, pre = nullptr;
+            while (cur) {
+                last = cur;
+                if (!kcomp(cur->Key(), key)) {
+                    pre = cur;
+                    cur = cur->left;
+                }
+                else {
+                    cur = cur->right;
+                }
+            }
+            if (last)
+                Splay(pre ? pre : last);
+            return pre ? iterator(pre) : End();
+        }
+
+        template <typename Ref>
+        iterator Lower_bound(Ref&& key) const {
+            return Base::Lower_bound(std::forward<Ref>(key));
+        }
+
+        template <typename Ref>
+        iterator Upper_bound(Ref&& key) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr cur = root, last = nullptr, pre = nullptr;
+            while (cur) {
+                last = cur;
+                if (kcomp(key, cur->Key())) {
+                    pre = cur;
+                    cur = cur->left;
+                }
+                else {
+                    cur = cur->right;
+                }
+            }
+            if (last)
+                Splay(pre ? pre : last);
+            return pre ? iterator(pre) : End();
+        }
+
+        template <typename Ref>
+        iterator Upper_bound(Ref&& key) const {
+            return Base::Upper_bound(std::forward<Ref>(key));
+        }
+
+    private:
+        friend Base;
+
+        //祖先的增强字段由随后的伸展旋转重新计算
+        void Fix_insert(Nodeptr node) {
+            Augment::Pull(node);
+        }
+
+        void Fix_erase(Nodeptr node, Nodeptr next) {
+            Nodeptr dummy = &val_pack.second.second.dummy;
+            if (node->left && node->right)          //与后继交换位置, 转化为至多一个孩子的情形
+                Swap_with_next(node, next);
+
+            Nodeptr parent = node->parent;
+            New_child(node, node->left ? node->left : node->right);
+            if (parent != dummy) {                  //伸展被删节点的父节点, 沿途旋转会重新计算增强字段
+                Augment::Pull(parent);
+                Splay(parent);
+            }
+        }
+
+        void Access(Nodeptr node) {
+            Splay(node);
+        }
+
+        void Splay(Nodeptr node) {
+            Nodeptr dummy = &val_pack.second.second.dummy;
+            while (node->parent != dummy) {
+                Nodeptr parent = node->parent;
+                Nodeptr grandparent = parent->parent;
+                bool node_is_left = node == parent->left;
+                if (grandparent == dummy) {                             //zig
+                    if (node_is_left)
+                        Rotate_right(parent);
+                    else
+                        Rotate_left(parent);
+                }
+                else if (node_is_left == (parent == grandparent->left)) { //zig-zig
+                    if (node_is_left) {
+                        Rotate_right(grandparent);
+                        Rotate_right(parent);
+                    }
+                    else {
+                        Rotate_left(grandparent);
+                        Rotate_left(parent);
+                    }
+                }
+                else {                                                  //zig-zag
+                    if (node_is_left) {
+                        Rotate_right(parent);
+                        Rotate_left(grandparent);
+                    }
+                    else {
+                        Rotate_left(parent);
+                        Rotate_right(grandparent);
+                    }
+                }
+            }
+        }
+    };
+
+    template <
+        typename Kty,
+        typename Vty,
+        typename Kcompare,
+        typename Vcompare,
+        typename Allocator
+    >
+    class treap : public tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, treap_feature, tree_augment, treap<Kty, Vty, Kcompare, Vcompare, Allocator>>,
+                  public tree_feature
+    {
+    protected:
+        using Base          = tree_base<Kty, Vty, Kcompare, Vcompare, Allocator, treap_feature, tree_augment, treap>;
+        using Alty          = typename Base::Alty;
+        using Alty_traits   = typename Base::Alty_traits;
+        using Node          = typename Base::Node;
+        using Alnode        = typename Base::Alnode;
+        using Alnode_traits = typename Base::Alnode_traits;
+        using Nodeptr       = typename Base::Nodeptr;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using key_compare        = typename Base::key_compare;
+        using value_compare      = typename Base::value_type;
+        using allocator_type     = typename Base::allocator_type;
+        using reference          = typename Base::reference;
+        using const_reference    = typename Base::const_reference;
+        using pointer            = typename Base::pointer;
+        using const_pointer      = typename Base::const_pointer;
+
+        using iterator           = typename Base::iterator;
+        using node_type          = typename Base::node_type;
+        using insert_return_type = typename Base::insert_return_type;
+
+    private:
+        unsigned long long seed;
+
+    protected:
+        using Base::val_pack;
+        using Base::End;
+        using Base::Find;
+        using Base::Key_of;
+        using Base::Node_of;
+        using Base::Tidy;
+        using Base::Destroy;
+        using Base::New_root;
+        using Base::New_child;
+        using Base::Insert;
+        using Base::Size_of;
+
+        treap() : Base(), seed(Initial_seed()) {}
+
+        explicit treap(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : Base(comp, alloc), seed(Initial_seed()) {}
+
+        explicit treap(const allocator_type& alloc)
+            : Base(alloc), seed(Initial_seed()) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        treap(ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : treap(comp, alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        treap(ForwardIt begin, ForwardIt end,
+            const allocator_type& alloc)
+            : treap(alloc) {
+            Insert(begin, end);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        treap(sorted_unique_t, ForwardIt begin, ForwardIt end,
+            const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+            : treap(comp, alloc) {
+            Base::template Build_sorted<false>(begin, end);
+        }
+
+        treap(const treap& another, const allocator_type& alloc = allocator_type())
+            : treap(another.Begin(), another.End()) {}
+
+        treap(treap&& another, const allocator_type& alloc = allocator_type()) noexcept
+            : Base(std::move(another)), seed(another.seed) {}
+
+        treap(std::initializer_list<value_type> ini_list,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type())
+            : treap(ini_list.begin(), ini_list.end(), comp, alloc) {}
+
+        treap(std::initializer_list<value_type> ini_list,
+            const allocator_type& alloc)
+            : treap(ini_list.begin(), ini_list.end(), alloc) {}
+
+        ~treap() {}
+
+        treap& operator=(const treap& another) {
+            if (this == &another)
+                return *this;
+            *this = treap(another);
+            return *this;
+        }
+
+        treap& operator=(treap&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Base::operator=(std::move(another));
+            return *this;
+        }
+
+        //以下操作要求两棵树的分配器可互换; another中的节点被直接接入本树或销毁, 操作后another为空
+
+        //关键字不小于key的元素移入right(原内容被清空), 期望O(log n)
+        void Split(const key_type& key, treap& right) {
+            if (this == &right)
+                Logic_error();
+            right.Clear();
+            Nodeptr lchild = nullptr, rchild = nullptr, equal = nullptr;
+            Split_node(val_pack.second.second.root, key, lchild, rchild, equal);
+            if (equal) {
+                equal->left = equal->right = nullptr;
+                equal->size = 1;
+                rchild = Join_node(equal, rchild);
+            }
+            Reset(lchild, Size_of(lchild));
+            right.Reset(rchild, Size_of(rchild));
+        }
+
+        //要求本树所有关键字均小于right中的关键字, 期望O(log n)
+        void Join(treap& right) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            if (this == &right)
+                Logic_error();
+            if (right.Empty())
+                return;
+            if (root && !kcomp(last_node->Key(), right.val_pack.second.second.begin_node->Key()))
+                Logic_error();
+            size_type total = val_size + right.Size();
+            Nodeptr res = Join_node(root, right.Release());
+            Reset(res, total);
+        }
+
+        //以下三个集合运算均为期望O(m log(n / m + 1)), m为较小一方的大小; 关键字重复时保留本树的元素
+        void Union(treap& another) {
+            if (this == &another)
+                return;
+            size_type duplicate = 0;
+            size_type total = Base::Size() + another.Size();
+            Nodeptr res = Union_node(Release(), another.Release(), true, duplicate);
+            Reset(res, total - duplicate);
+        }
+
+        void Intersection(treap& another) {
+            if (this == &another)
+                return;
+            size_type kept = 0;
+            Nodeptr res = Intersection_node(Release(), another.Release(), true, kept);
+            Reset(res, kept);
+        }
+
+        void Difference(treap& another) {
+            if (this == &another) {
+                Base::Clear();
+                return;
+            }
+            size_type removed = 0;
+            size_type total = Base::Size();
+            Nodeptr res = Difference_node(Release(), another.Release(), removed);
+            Reset(res, total - removed);
+        }
+
+    private:
+        static unsigned long long Initial_seed() noexcept {
+            static unsigned long long counter = 0;
+            return ++counter * 0x9E3779B97F4A7C15ull;
+        }
+
+        unsigned long long Next_priority() noexcept {
+            //splitmix64
+            unsigned long long z = (seed += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        static void Link(Nodeptr node, Nodeptr lchild, Nodeptr rchild) noexcept {
+            node->left = lchild;
+            node->right = rchild;
+            if (lchild)
+                lchild->parent = node;
+            if (rchild)
+                rchild->parent = node;
+            node->size = 1 + Size_of(lchild) + Size_of(rchild);
+        }
+
+        //摘下整棵树而不销毁节点
+        Nodeptr Release() noexcept {
+            OCT_TREE_VAL_PACK_UNWRAP
+            Nodeptr res = root;
+            dummy.left = dummy.right = nullptr;
+            root = nullptr;
+            begin_node = last_node = &dummy;
+            val_size = 0;
+            return res;
+        }
+
+        void Reset(Nodeptr node, size_type count) noexcept {
+            New_root(node);
+            val_pack.second.second.begin_node = node ? node->Min_node() : &val_pack.second.second.dummy;
+            val_pack.second.second.last_node = node ? node->Max_node() : &val_pack.second.second.dummy;
+            val_pack.second.second.val_size = count;
+        }
+
+        friend Base;
+
+        void Fix_erase(Nodeptr node, Nodeptr) {
+            for (Nodeptr cur = node->parent; cur != &val_pack.second.second.dummy; cur = cur->parent)
+                cur->size--;
+            New_child(node, Join_node(node->left, node->right));
+        }
+
+        //已构造好的节点重新取得优先级后链接, 关键字须不在树中; 位置由优先级决定, 查找得到的pos无法利用
+        Nodeptr Link_at(pair<Nodeptr, Nodeptr*>, Nodeptr node) {
+            OCT_TREE_VAL_PACK_UNWRAP
+            node->priority = Next_priority();
+            const key_type& key = node->Key();
+
+            //沿查找路径下降到第一个优先级更低的位置, 把该子树按key拆开挂在新节点两侧
+            Nodeptr  parent = &dummy;
+            Nodeptr* address = &root;
+            while (*address && (*address)->priority >= node->priority) {
+                parent = *address;
+                parent->size++;
+                address = kcomp(key, parent->Key()) ? &parent->left : &parent->right;
+            }
+            Nodeptr lchild = nullptr, rchild = nullptr, equal = nullptr;
+            Split_node(*address, key, lchild, rchild, equal);
+            Link(node, lchild, rchild);
+            *address = node;
+            node->parent = parent;
+
+            if (begin_node == &dummy || kcomp(key, begin_node->Key()))
+                begin_node = node;
+            if (last_node == &dummy || kcomp(last_node->Key(), key))
+                last_node = node;
+            dummy.left = dummy.right = root;
+            val_size++;
+            return node;
+        }
+
+        //按key把以node为根的子树拆为小于key、大于key两部分, 等于key的节点(若存在)单独取出
+        void Split_node(Nodeptr node, const key_type& key, Nodeptr& lchild, Nodeptr& rchild, Nodeptr& equal) {
+            key_compare& kcomp = val_pack.get_first();
+            if (!node) {
+                lchild = rchild = nullptr;
+                return;
+            }
+            if (kcomp(node->Key(), key)) {
+                Nodeptr next_left = nullptr;
+                Split_node(node->right, key, next_left, rchild, equal);
+                Link(node, node->left, next_left);
+                lchild = node;
+            }
+            else if (kcomp(key, node->Key())) {
+                Nodeptr next_right = nullptr;
+                Split_node(node->left, key, lchild, next_right, equal);
+                Link(node, next_right, node->right);
+                rchild = node;
+            }
+            else {
+                equal = node;
+                lchild = node->left;
+                rchild = node->right;
+            }
+        }
+
+        //要求lchild中的关键字均小于rchild
+        static Nodeptr Join_node(Nodeptr lchild, Nodeptr rchild) noexcept {
+            if (!lchild)
+                return rchild;
+            if (!rchild)
+                return lchild;
+            if (lchild->priority >= rchild->priority) {
+                Link(lchild, lchild->left, Join_node(lchild->right, rchild));
+                return lchild;
+            }
+            else {
+                Link(rchild, Join_node(lchild, rchild->left), rchild->right);
+                return rchild;
+            }
+        }
+
+        //is_self表示first来自本树, 重复关键字时保留本树的节点
+        Nodeptr Union_node(Nodeptr first, Nodeptr second, bool is_self, size_type& duplicate) {
+            if (!first)
+                return second;
+            if (!second)
+                return first;
+            if (first->priority < second->priority) {
+                std::swap(first, second);
+                is_self = !is_self;
+            }
+            Nodeptr lchild = nullptr, rchild = nullptr, equal = nullptr;
+            Split_node(second, first->Key(), lchild, rchild, equal);
+            Nodeptr first_left = first->left, first_right = first->right;
+            Nodeptr top = first;
+            if (equal) {
+                duplicate++;
+                if (is_self) {
+                    Destroy(equal);
+                }
+                else {
+                    equal->priority = first->priority;
+                    Destroy(first);
+                    top = equal;
+                }
+            }
+            Nodeptr left = Union_node(first_left, lchild, is_self, duplicate);
+            Nodeptr right = Union_node(first_right, rchild, is_self, duplicate);
+            Link(top, left, right);
+            return top;
+        }
+
+        Nodeptr Intersection_node(Nodeptr first, Nodeptr second, bool is_self, size_type& kept) {
+            if (!first || !second) {
+                Tidy(first);
+                Tidy(second);
+                return nullptr;
+            }
+            if (first->priority < second->priority) {
+                std::swap(first, second);
+                is_self = !is_self;
+            }
+            Nodeptr lchild = nullptr, rchild = nullptr, equal = nullptr;
+            Split_node(second, first->Key(), lchild, rchild, equal);
+            Nodeptr left = Intersection_node(first->left, lchild, is_self, kept);
+            Nodeptr right = Intersection_node(first->right, rchild, is_self, kept);
+            if (!equal) {
+                Destroy(first);
+                return Join_node(left, right);
+            }
+            Nodeptr top = first;
+            if (is_self) {
+                Destroy(equal);
+            }
+            else {
+                equal->priority = first->priority;
+                Destroy(first);
+                top = equal;
+            }
+            Link(top, left, right);
+            kept++;
+            return top;
+        }
+
+        //first - second, 不能交换两侧
+        Nodeptr Difference_node(Nodeptr first, Nodeptr second, size_type& removed) {
+            if (!first) {
+                Tidy(second);
+                return nullptr;
+            }
+            if (!second)
+                return first;
+            Nodeptr lchild = nullptr, rchild = nullptr, equal = nullptr;
+            Split_node(second, first->Key(), lchild, rchild, equal);
+            Nodeptr left = Difference_node(first->left, lchild, removed);
+            Nodeptr right = Difference_node(first->right, rchild, removed);
+            if (equal) {
+                Destroy(equal);
+                Destroy(first);
+                removed++;
+                return Join_node(left, right);
+            }
+            Link(first, left, right);
+            return first;
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid treap split or join");
+        }
+    };
+
+    //把增强策略绑定到后端(red_black_tree、avl_tree、splay_tree)上, type可作为map/set的Tree参数
+    template <template <typename...> typename Tree, typename Augment>
+    struct augmented_tree {
+        template <typename Kty, typename Vty, typename Kcompare, typename Vcompare, typename Allocator>
+        using type = Tree<Kty, Vty, Kcompare, Vcompare, Allocator, Augment>;
+    };
+
+    //以子树大小增强的各后端, 作为map/set的Tree参数使用后即可按名次查找; 树堆自带子树大小, 无需增强
+    template <typename Kty, typename Vty, typename Kcompare, typename Vcompare, typename Allocator>
+    using order_statistic_tree = red_black_tree<Kty, Vty, Kcompare, Vcompare, Allocator, subtree_size_augment>;
+
+    template <typename Kty, typename Vty, typename Kcompare, typename Vcompare, typename Allocator>
+    using order_statistic_avl_tree = avl_tree<Kty, Vty, Kcompare, Vcompare, Allocator, subtree_size_augment>;
+
+    template <typename Kty, typename Vty, typename Kcompare, typename Vcompare, typename Allocator>
+    using order_statistic_splay_tree = splay_tree<Kty, Vty, Kcompare, Vcompare, Allocator, subtree_size_augment>;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,329 @@
+#pragma once
+
+#ifndef OCT_PAIRING_HEAP
+#define OCT_PAIRING_HEAP
+
+#include "utility.hpp"
+#include "type_traits.hpp"
+
+namespace oct {
+    template <typename Ty>
+    struct pairing_heap_node {
+        using Nodeptr = pairing_heap_node*;
+
+        Nodeptr child = nullptr;        //最左的孩子
+        Nodeptr next  = nullptr;        //右兄弟
+        Nodeptr prev  = nullptr;        //左兄弟; 最左的孩子指向父节点, 根为空
+        Ty val;
+
+        template <typename... Args>
+        pairing_heap_node(std::in_place_t, Args&&... args) : val(std::forward<Args>(args)...) {}
+    };
+
+    /*
+    * characteristics:
+    * [pairing heap] 多叉堆序树, 孩子以兄弟链表相连; push/top/merge/decrease_key为O(1), pop与erase均摊O(log n)
+    * [addressable] push返回指向节点的句柄, 句柄在元素被pop或erase前始终有效
+    * decrease_key/increase_key沿用最小堆的叫法: decrease_key使元素更靠近堆顶, increase_key使元素远离堆顶
+    */
+    template <typename Ty, class Compare = less<Ty>, typename Allocator = allocator<Ty>>
+    class pairing_heap {
+    private:    //内部类与内部配置器
+        using Node          = pairing_heap_node<Ty>;
+        using Alnode        = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = typename Alnode_traits::pointer;
+
+    public:     //统一接口
+        static_assert(std::is_object_v<Ty>, "pairing_heap requires object types");
+
+        using value_type      = Ty;
+        using size_type       = std::size_t;
+        using reference       = Ty&;
+        using const_reference = const Ty&;
+        using value_compare   = Compare;
+        using allocator_type  = Allocator;
+
+        class handle_type {
+        private:
+            friend pairing_heap;
+
+            Nodeptr node = nullptr;
+
+            explicit handle_type(Nodeptr node) noexcept : node(node) {}
+
+        public:
+            handle_type() = default;
+
+            const_reference operator*() const noexcept {
+                return node->val;
+            }
+
+            bool operator==(const handle_type& another) const noexcept {
+                return node == another.node;
+            }
+
+            bool operator!=(const handle_type& another) const noexcept {
+                return node != another.node;
+            }
+        };
+
+    private:    //成员变量
+        compressed_pair<value_compare, compressed_pair<Alnode, Nodeptr>> val_pack;     //比较器, 节点配置器与根
+        size_type val_size = 0;
+
+    public:     //成员函数
+        pairing_heap() : pairing_heap(value_compare()) {}
+
+        explicit pairing_heap(const value_compare& comp, const allocator_type& alloc = allocator_type())
+            : val_pack(comp, alloc, nullptr) {}
+
+        pairing_heap(const pairing_heap&)            = delete;
+        pairing_heap& operator=(const pairing_heap&) = delete;
+
+        pairing_heap(pairing_heap&& another) noexcept
+            : val_pack(another.Get_comp(), another.Get_alloc(), another.Root()), val_size(another.val_size) {
+            another.Root() = nullptr;
+            another.val_size = 0;
+        }
+
+        pairing_heap& operator=(pairing_heap&& another) noexcept {
+            if (this == &another)
+                return *this;
+            clear();
+            swap(another);
+            return *this;
+        }
+
+        ~pairing_heap() {
+            clear();
+        }
+
+        bool empty() const noexcept {
+            return !val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_size;
+        }
+
+        const_reference top() const {
+            if (!val_size)
+                Logic_error();
+            return val_pack.second.second->val;
+        }
+
+        template <typename Ref>
+        handle_type push(Ref&& value) {
+            return emplace(std::forward<Ref>(value));
+        }
+
+        template <typename... Args>
+        handle_type emplace(Args&&... args) {
+            Nodeptr node = Construct_node(std::forward<Args>(args)...);
+            Root() = Meld(Root(), node);
+            val_size++;
+            return handle_type(node);
+        }
+
+        void pop() {
+            if (!val_size)
+                Logic_error();
+            Nodeptr root = Root();
+            Root() = Merge_pairs(root->child);
+            Destroy_node(root);
+            val_size--;
+        }
+
+        //句柄指向的元素从堆中删除, 句柄随之失效
+        void erase(handle_type handle) {
+            Nodeptr node = handle.node;
+            if (node == Root()) {
+                pop();
+                return;
+            }
+            Cut(node);
+            Root() = Meld(Root(), Merge_pairs(node->child));
+            Destroy_node(node);
+            val_size--;
+        }
+
+        //value不能使元素远离堆顶; 把元素所在子树剪下后与根合并, O(1)
+        template <typename Ref>
+        void decrease_key(handle_type handle, Ref&& value) {
+            Nodeptr node = handle.node;
+            if (Get_comp()(value, node->val))
+                Key_error();
+            node->val = std::forward<Ref>(value);
+            if (node == Root())
+                return;
+            Cut(node);
+            Root() = Meld(Root(), node);
+        }
+
+        //value不能使元素靠近堆顶; 元素的孩子先合并成一棵树, 元素单独重新插入, 均摊O(log n)
+        template <typename Ref>
+        void increase_key(handle_type handle, Ref&& value) {
+            Nodeptr node = handle.node;
+            if (Get_comp()(node->val, value))
+                Key_error();
+            node->val = std::forward<Ref>(value);
+            Reinsert(node);
+        }
+
+        //按新值的方向调整
+        template <typename Ref>
+        void update(handle_type handle, Ref&& value) {
+            Nodeptr node = handle.node;
+            if (Get_comp()(node->val, value))
+                decrease_key(handle, std::forward<Ref>(value));
+            else {
+                node->val = std::forward<Ref>(value);
+                Reinsert(node);
+            }
+        }
+
+        //another的节点全部并入, O(1); 两者的配置器须相等, another的句柄转而指向本堆中的元素
+        void merge(pairing_heap& another) noexcept {
+            if (this == &another)
+                return;
+            Root() = Meld(Root(), another.Root());
+            val_size += another.val_size;
+            another.Root() = nullptr;
+            another.val_size = 0;
+        }
+
+        //把孩子逐个旋转到待释放链表的前面, 不需要递归或额外空间
+        void clear() noexcept {
+            Nodeptr cur = Root();
+            while (cur) {
+                if (cur->child) {
+                    Nodeptr child = cur->child;
+                    cur->child = child->next;
+                    child->next = cur;
+                    cur = child;
+                }
+                else {
+                    Nodeptr next = cur->next;
+                    Destroy_node(cur);
+                    cur = next;
+                }
+            }
+            Root() = nullptr;
+            val_size = 0;
+        }
+
+        void swap(pairing_heap& another) noexcept {
+            using std::swap;
+            swap(Get_comp(), another.Get_comp());
+            swap(Root(), another.Root());
+            swap(val_size, another.val_size);
+        }
+
+    private:
+        value_compare& Get_comp() noexcept {
+            return val_pack.get_first();
+        }
+
+        Alnode& Get_alloc() noexcept {
+            return val_pack.second.get_first();
+        }
+
+        Nodeptr& Root() noexcept {
+            return val_pack.second.second;
+        }
+
+        template <typename... Args>
+        Nodeptr Construct_node(Args&&... args) {
+            Alnode& alloc = Get_alloc();
+            Nodeptr node = Alnode_traits::allocate(alloc, 1);
+            try {
+                Alnode_traits::construct(alloc, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Alnode_traits::deallocate(alloc, node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        void Destroy_node(Nodeptr node) noexcept {
+            Alnode& alloc = Get_alloc();
+            Alnode_traits::destroy(alloc, node);
+            Alnode_traits::deallocate(alloc, node, 1);
+        }
+
+        //合并两棵独立的树, 优先级低的根成为另一个根的最左孩子
+        Nodeptr Meld(Nodeptr left, Nodeptr right) {
+            if (!left)
+                return right;
+            if (!right)
+                return left;
+            if (Get_comp()(left->val, right->val))
+                std::swap(left, right);
+            right->prev = left;
+            right->next = left->child;
+            if (left->child)
+                left->child->prev = right;
+            left->child = right;
+            return left;
+        }
+
+        //把非根节点连同其子树从兄弟链表中摘下
+        static void Cut(Nodeptr node) noexcept {
+            if (node->prev->child == node)
+                node->prev->child = node->next;
+            else node->prev->next = node->next;
+            if (node->next)
+                node->next->prev = node->prev;
+            node->next = node->prev = nullptr;
+        }
+
+        //两趟合并: 自左向右两两合并兄弟, 结果借prev反向串起, 再自右向左依次合并
+        Nodeptr Merge_pairs(Nodeptr first) {
+            Nodeptr tail = nullptr;
+            while (first) {
+                Nodeptr tree = first;
+                Nodeptr second = first->next;
+                first = second ? second->next : nullptr;
+                tree->next = tree->prev = nullptr;
+                if (second) {
+                    second->next = second->prev = nullptr;
+                    tree = Meld(tree, second);
+                }
+                tree->prev = tail;
+                tail = tree;
+            }
+            Nodeptr res = nullptr;
+            while (tail) {
+                Nodeptr prev = tail->prev;
+                tail->prev = nullptr;
+                res = Meld(tail, res);
+                tail = prev;
+            }
+            return res;
+        }
+
+        void Reinsert(Nodeptr node) {
+            Nodeptr children = node->child;
+            node->child = nullptr;
+            if (node == Root())
+                Root() = Merge_pairs(children);
+            else {
+                Cut(node);
+                Root() = Meld(Root(), Merge_pairs(children));
+            }
+            Root() = Meld(Root(), node);
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid pairing_heap size");
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::invalid_argument("pairing_heap key moved in the wrong direction");
+        }
+    };
+}
+
+#endif // !OCT_PAIRING_HEAP
\ No newline at end of file
@@ -1,196 +1,533 @@
-#pragma once
-
-#ifndef OCT_QUEUE
-#define OCT_QUEUE
-
-#include "deque.hpp"
-#include "vector.hpp"
-
-namespace oct {
-    template <typename Ty, typename Container = deque<Ty>>
-    class queue {
-    public:
-        using container_type  = Container;
-        using value_type      = typename Container::value_type;
-        using size_type       = typename Container::size_type;
-        using reference       = typename Container::reference;
-        using const_reference = typename Container::const_reference;
-
-    private:
-        container_type cont{};
-
-    public:
-        queue() = default;
-
-        explicit queue(const container_type& container) : cont(container) {}
-
-        explicit queue(container_type&& container) noexcept : cont(std::move(container)) {}
-
-        queue(const queue& another) : cont(another.cont) {}
-
-        queue(queue&& another) noexcept : cont(std::move(another.cont)) {}
-
-        queue& operator=(const queue& another) {
-            if (this == &another)return *this;
-            cont = another.cont;
-            return *this;
-        }
-
-        queue& operator=(queue&& another) noexcept {
-            if (this == &another)return *this;
-            cont = std::move(another.cont);
-            return *this;
-        }
-
-        bool empty() const noexcept {
-            return cont.empty();
-        }
-
-        size_type size() const noexcept {
-            return cont.size();
-        }
-
-        template <typename Ref>
-        void push(Ref&& elem) {
-            cont.push_back(std::forward<Ref>(elem));
-        }
-
-        template <typename Ref>
-        queue& operator<<(Ref&& elem) {
-            cont.push_back(std::forward<Ref>(elem));
-            return *this;
-        }
-
-        template <typename Ty, typename Container>
-        friend void operator<<(Ty& elem, queue<Ty, Container>& que);
-
-        void pop() {
-            cont.pop_front();
-        }
-
-        const_reference front() const {
-            return cont.front();
-        }
-
-        const_reference back() const {
-            return cont.back();
-        }
-    };
-
-    template <typename Ty, typename Container>
-    queue<Ty, Container>& operator<<(Ty& elem, queue<Ty, Container>& que) {
-        elem = que.cont.front();
-        que.pop();
-        return que;
-    }
-
-    template <typename Ty, typename Container = vector<Ty>, class Compare = less<typename Container::value_type>>
-    class priority_queue {
-    public:
-        using container_type  = Container;
-        using value_type      = typename Container::value_type;
-        using size_type       = typename Container::size_type;
-        using reference       = typename Container::reference;
-        using const_reference = typename Container::const_reference;
-        using value_compare   = Compare;
-
-    private:
-        compressed_pair<value_compare, container_type> val_pack;
-
-    public:
-        priority_queue() {};
-
-        priority_queue(const priority_queue& another) : val_pack.second(another.val_pack.second) {}
-
-        priority_queue(priority_queue&& another) noexcept : val_pack.second(std::move(another.val_pack.second)) {}
-
-        ~priority_queue() {}
-
-        priority_queue& operator=(const priority_queue& another) {
-            if (this == &another)return *this;
-            ~priority_queue();
-            val_pack.second = another.val_pack.second;
-            copmare = another.Get_comp();
-            return *this;
-        }
-
-        priority_queue& operator=(priority_queue&& another) {
-            if (this == &another)return *this;
-            ~priority_queue();
-            val_pack.second = std::move(another.val_pack.second);
-            Get_comp() = std::move(another.Get_comp());
-            return *this;
-        }
-
-        bool empty()const {
-            return val_pack.second.empty();
-        }
-
-        size_type size()const {
-            return val_pack.second.size();
-        }
-
-        template<typename V>
-        void push(V&& elem) {
-            val_pack.second.push_back(elem);
-            Up(val_pack.second.size() - 1);
-        }
-
-        template<typename V>
-        priority_queue& operator<<(V&& elem) {
-            val_pack.second.push_back(elem);
-            Up(val_pack.second.size() - 1);
-            return *this;
-        }
-
-        void pop() {
-            val_pack.second[0] = val_pack.second.back();
-            val_pack.second.pop_back();
-            Down(0);
-        }
-
-        const_reference top() const {
-            return val_pack.second[0];
-        }
-
-    private:
-
-
-        inline size_type Father(size_type pos) const noexcept {
-            return (pos - 1) / 2;
-        }
-
-        inline size_type Lchild(size_type pos) const noexcept {
-            return 2 * pos + 1;
-        }
-
-        inline size_type Rchild(size_type pos) const noexcept {
-            return 2 * pos + 2;
-        }
-
-        inline value_compare& Get_comp() {
-            return val_pack.get_first();
-        }
-
-        void Up(size_type idx) {
-            if (idx && Get_comp()(val_pack.second[Father(idx)], val_pack.second[idx])) {
-                std::swap(val_pack.second[Father(idx)], val_pack.second[idx]);
-                Up(Father(idx));
-            }
-        }
-
-        void Down(size_type idx) {
-            size_type pos = idx;
-            if (Rchild(idx) < val_pack.second.size() && Get_comp()(val_pack.second[pos], val_pack.second[Lchild(idx)]))
-                pos = Lchild(idx);
-            if (Rchild(idx) < val_pack.second.size() && Get_comp()(val_pack.second[pos], val_pack.second[Rchild(idx)]))
-                pos = Rchild(idx);
-            if (pos != idx) {
-                swap(val_pack.second[idx], val_pack.second[pos]);
-                Down(pos);
-            }
-        }
-    };
-}
-
+#pragma once
+
+#ifndef OCT_QUEUE
+#define OCT_QUEUE
+
+#include "deque.hpp"
+#include "vector.hpp"
+
+namespace oct {
+    template <typename Ty, typename Container = deque<Ty>>
+    class queue {
+    public:
+        using container_type  = Container;
+        using value_type      = typename Container::value_type;
+        using size_type       = typename Container::size_type;
+        using reference       = typename Container::reference;
+        using const_reference = typename Container::const_reference;
+
+    private:
+        container_type cont{};
+
+    public:
+        queue() = default;
+
+        explicit queue(const container_type& container) : cont(container) {}
+
+        explicit queue(container_type&& container) noexcept : cont(std::move(container)) {}
+
+        queue(const queue& another) : cont(another.cont) {}
+
+        queue(queue&& another) noexcept : cont(std::move(another.cont)) {}
+
+        queue& operator=(const queue& another) {
+            if (this == &another)return *this;
+            cont = another.cont;
+            return *this;
+        }
+
+        queue& operator=(queue&& another) noexcept {
+            if (this == &another)return *this;
+            cont = std::move(another.cont);
+            return *this;
+        }
+
+        bool empty() const noexcept {
+            return cont.empty();
+        }
+
+        size_type size() const noexcept {
+            return cont.size();
+        }
+
+        template <typename Ref>
+        void push(Ref&& elem) {
+            cont.push_back(std::forward<Ref>(elem));
+        }
+
+        template <typename Ref>
+        queue& operator<<(Ref&& elem) {
+            cont.push_back(std::forward<Ref>(elem));
+            return *this;
+        }
+
+        template <typename Elem, typename Cont>
+        friend queue<Elem, Cont>& operator<<(Elem& elem, queue<Elem, Cont>& que);
+
+        void pop() {
+            cont.pop_front();
+        }
+
+        const_reference front() const {
+            return cont.front();
+        }
+
+        const_reference back() const {
+            return cont.back();
+        }
+    };
+
+    template <typename Ty, typename Container>
+    queue<Ty, Container>& operator<<(Ty& elem, queue<Ty, Container>& que) {
+        elem = que.cont.front();
+        que.pop();
+        return que;
+    }
+
+    /*
+    * characteristics:
+    * [d-ary heap] Arity叉堆, 4叉/8叉堆层数更少且兄弟节点位于同一缓存行, 下滤时比较次数略增但缺失大幅减少
+    * [hole sift] 上滤/下滤时先取出元素留下空穴, 沿路径只移动元素, 最后一次放入, 不逐层交换
+    * [bottom-up pop] pop/replace_top让空穴直接沉到叶子再上滤, 每层省去与被放回元素的比较
+    */
+    template <
+        typename Ty,
+        typename Container = vector<Ty>,
+        class Compare      = less<typename Container::value_type>,
+        std::size_t Arity  = 2
+    >
+    class priority_queue {
+    public:
+        static_assert(Arity >= 2, "priority_queue requires an arity of at least 2");
+
+        using container_type  = Container;
+        using value_type      = typename Container::value_type;
+        using size_type       = typename Container::size_type;
+        using reference       = typename Container::reference;
+        using const_reference = typename Container::const_reference;
+        using value_compare   = Compare;
+
+        static constexpr std::size_t arity = Arity;
+
+    private:
+        compressed_pair<value_compare, container_type> val_pack;
+
+    public:
+        priority_queue() = default;
+
+        explicit priority_queue(const value_compare& comp) : val_pack(comp) {}
+
+        //以已有容器建堆, O(n)
+        priority_queue(const value_compare& comp, const container_type& container) : val_pack(comp, container) {
+            Make_heap();
+        }
+
+        priority_queue(const value_compare& comp, container_type&& container) : val_pack(comp, std::move(container)) {
+            Make_heap();
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        priority_queue(ForwardIt begin, ForwardIt end, const value_compare& comp = value_compare()) : val_pack(comp) {
+            for (; begin != end; ++begin)
+                val_pack.second.push_back(*begin);
+            Make_heap();
+        }
+
+        priority_queue(const priority_queue&)            = default;
+        priority_queue(priority_queue&&)                 = default;
+        priority_queue& operator=(const priority_queue&) = default;
+        priority_queue& operator=(priority_queue&&)      = default;
+
+        bool empty() const noexcept {
+            return val_pack.second.empty();
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.size();
+        }
+
+        const_reference top() const {
+            return val_pack.second[0];
+        }
+
+        template <typename Ref>
+        void push(Ref&& elem) {
+            val_pack.second.push_back(std::forward<Ref>(elem));
+            Sift_up(val_pack.second.size() - 1);
+        }
+
+        template <typename... Args>
+        void emplace(Args&&... args) {
+            val_pack.second.emplace_back(std::forward<Args>(args)...);
+            Sift_up(val_pack.second.size() - 1);
+        }
+
+        template <typename Ref>
+        priority_queue& operator<<(Ref&& elem) {
+            push(std::forward<Ref>(elem));
+            return *this;
+        }
+
+        //追加的元素不少于原有元素时整体重新建堆, 否则逐个上滤
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void push_range(ForwardIt begin, ForwardIt end) {
+            container_type& cont = val_pack.second;
+            size_type old_size = cont.size();
+            for (; begin != end; ++begin)
+                cont.push_back(*begin);
+            if (cont.size() - old_size >= old_size)
+                Make_heap();
+            else for (size_type i = old_size; i < cont.size(); i++)
+                Sift_up(i);
+        }
+
+        void pop() {
+            container_type& cont = val_pack.second;
+            if (cont.size() > 1) {
+                value_type last = std::move(cont.back());
+                cont.pop_back();
+                Sift_down(0, std::move(last));
+            }
+            else cont.pop_back();
+        }
+
+        //相当于pop后再push, 只做一次下滤; 堆为空时抛出std::logic_error
+        template <typename Ref>
+        void replace_top(Ref&& elem) {
+            if (val_pack.second.empty())
+                Logic_error();
+            Sift_down(0, value_type(std::forward<Ref>(elem)));
+        }
+
+        //相当于push后再pop并返回弹出的元素; elem不低于堆顶时直接返回elem, 堆保持不变
+        template <typename Ref>
+        value_type pop_push(Ref&& elem) {
+            container_type& cont = val_pack.second;
+            if (cont.empty() || !Get_comp()(elem, cont[0]))
+                return value_type(std::forward<Ref>(elem));
+            value_type res = std::move(cont[0]);
+            Sift_down(0, value_type(std::forward<Ref>(elem)));
+            return res;
+        }
+
+        void clear() {
+            val_pack.second.clear();
+        }
+
+        void swap(priority_queue& another) noexcept {
+            using std::swap;
+            swap(Get_comp(), another.Get_comp());
+            val_pack.second.swap(another.val_pack.second);
+        }
+
+    private:
+        static size_type Parent(size_type pos) noexcept {
+            return (pos - 1) / Arity;
+        }
+
+        static size_type First_child(size_type pos) noexcept {
+            return pos * Arity + 1;
+        }
+
+        value_compare& Get_comp() noexcept {
+            return val_pack.get_first();
+        }
+
+        void Sift_up(size_type hole) {
+            value_type value = std::move(val_pack.second[hole]);
+            Sift_up(hole, 0, std::move(value));
+        }
+
+        //空穴自hole向上移动, 不越过top
+        void Sift_up(size_type hole, size_type top, value_type&& value) {
+            container_type& cont = val_pack.second;
+            value_compare& comp = Get_comp();
+            while (hole > top) {
+                size_type parent = Parent(hole);
+                if (!comp(cont[parent], value))
+                    break;
+                cont[hole] = std::move(cont[parent]);
+                hole = parent;
+            }
+            cont[hole] = std::move(value);
+        }
+
+        //hole处的元素已被取走: 空穴先沿较大的孩子一路下沉到叶子, 再为value向上找位置
+        //被放回的元素通常来自堆底, 最终位置接近叶子, 这样每层只需在孩子之间比较
+        void Sift_down(size_type hole, value_type&& value) {
+            container_type& cont = val_pack.second;
+            value_compare& comp = Get_comp();
+            size_type top = hole;
+            size_type count = cont.size();
+            size_type child = First_child(hole);
+            while (child + Arity <= count) {     //孩子齐全时比较次数固定, 循环可被完全展开
+                size_type best = child;
+                for (size_type i = 1; i < Arity; i++)
+                    best = comp(cont[best], cont[child + i]) ? child + i : best;
+                cont[hole] = std::move(cont[best]);
+                hole = best;
+                child = First_child(hole);
+            }
+            if (child < count) {
+                size_type best = child;
+                for (size_type i = child + 1; i < count; i++)
+                    best = comp(cont[best], cont[i]) ? i : best;
+                cont[hole] = std::move(cont[best]);
+                hole = best;
+            }
+            Sift_up(hole, top, std::move(value));
+        }
+
+        //自最后一个非叶节点起逐个下滤, O(n)
+        void Make_heap() {
+            container_type& cont = val_pack.second;
+            if (cont.size() < 2)
+                return;
+            for (size_type i = Parent(cont.size() - 1) + 1; i--; ) {
+                value_type value = std::move(cont[i]);
+                Sift_down(i, std::move(value));
+            }
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("replace_top on an empty priority_queue");
+        }
+    };
+
+    /*
+    * characteristics:
+    * [addressable] 元素以调用者给定的句柄标识(从0开始的整数, 如图的顶点编号), 另以位置索引记录每个句柄在堆中的位置,
+    *               堆中元素移动时同步更新; contains/at为O(1), decrease_key/increase_key/update/erase为O(log n)
+    * decrease_key/increase_key沿用最小堆的叫法: decrease_key使元素更靠近堆顶, increase_key使元素远离堆顶
+    */
+    template <
+        typename Ty,
+        typename Container = vector<Ty>,
+        class Compare      = less<typename Container::value_type>,
+        std::size_t Arity  = 2
+    >
+    class indexed_priority_queue {
+    public:
+        static_assert(Arity >= 2, "indexed_priority_queue requires an arity of at least 2");
+
+        using container_type  = Container;
+        using value_type      = typename Container::value_type;
+        using size_type       = typename Container::size_type;
+        using reference       = typename Container::reference;
+        using const_reference = typename Container::const_reference;
+        using value_compare   = Compare;
+        using handle_type     = size_type;
+
+        static constexpr std::size_t arity = Arity;
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+    private:
+        compressed_pair<value_compare, container_type> val_pack;
+        vector<handle_type> handles;        //堆中第i个元素的句柄
+        vector<size_type> positions;        //句柄在堆中的位置, 不在堆中时为npos
+
+    public:
+        indexed_priority_queue() = default;
+
+        explicit indexed_priority_queue(const value_compare& comp) : val_pack(comp) {}
+
+        //预先为[0, handle_count)的句柄分配位置索引, 之后push时不再扩充索引
+        explicit indexed_priority_queue(size_type handle_count, const value_compare& comp = value_compare())
+            : val_pack(comp), positions(handle_count, npos) {}
+
+        bool empty() const noexcept {
+            return val_pack.second.empty();
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.size();
+        }
+
+        const_reference top() const {
+            return val_pack.second[0];
+        }
+
+        handle_type top_handle() const {
+            return handles[0];
+        }
+
+        bool contains(handle_type handle) const noexcept {
+            return handle < positions.size() && positions[handle] != npos;
+        }
+
+        const_reference at(handle_type handle) const {
+            return val_pack.second[Position_of(handle)];
+        }
+
+        //句柄已在堆中时抛出异常
+        template <typename Ref>
+        void push(handle_type handle, Ref&& value) {
+            if (handle >= positions.size())
+                positions.resize(handle + 1, npos);
+            else if (positions[handle] != npos)
+                Handle_error();
+            container_type& cont = val_pack.second;
+            cont.push_back(std::forward<Ref>(value));
+            handles.push_back(handle);
+            Sift_up(cont.size() - 1);
+        }
+
+        void pop() {
+            Remove_at(0);
+        }
+
+        void erase(handle_type handle) {
+            Remove_at(Position_of(handle));
+        }
+
+        //value不能使元素远离堆顶
+        template <typename Ref>
+        void decrease_key(handle_type handle, Ref&& value) {
+            size_type pos = Position_of(handle);
+            container_type& cont = val_pack.second;
+            if (Get_comp()(value, cont[pos]))
+                Key_error();
+            cont[pos] = std::forward<Ref>(value);
+            Sift_up(pos);
+        }
+
+        //value不能使元素靠近堆顶
+        template <typename Ref>
+        void increase_key(handle_type handle, Ref&& value) {
+            size_type pos = Position_of(handle);
+            container_type& cont = val_pack.second;
+            if (Get_comp()(cont[pos], value))
+                Key_error();
+            cont[pos] = std::forward<Ref>(value);
+            Sift_down(pos);
+        }
+
+        //按新值的方向上滤或下滤
+        template <typename Ref>
+        void update(handle_type handle, Ref&& value) {
+            size_type pos = Position_of(handle);
+            container_type& cont = val_pack.second;
+            bool up = Get_comp()(cont[pos], value);
+            cont[pos] = std::forward<Ref>(value);
+            if (up)
+                Sift_up(pos);
+            else Sift_down(pos);
+        }
+
+        void clear() {
+            for (size_type i = 0; i < handles.size(); i++)
+                positions[handles[i]] = npos;
+            val_pack.second.clear();
+            handles.clear();
+        }
+
+        void swap(indexed_priority_queue& another) noexcept {
+            using std::swap;
+            swap(Get_comp(), another.Get_comp());
+            val_pack.second.swap(another.val_pack.second);
+            handles.swap(another.handles);
+            positions.swap(another.positions);
+        }
+
+    private:
+        static size_type Parent(size_type pos) noexcept {
+            return (pos - 1) / Arity;
+        }
+
+        static size_type First_child(size_type pos) noexcept {
+            return pos * Arity + 1;
+        }
+
+        value_compare& Get_comp() noexcept {
+            return val_pack.get_first();
+        }
+
+        size_type Position_of(handle_type handle) const {
+            if (!contains(handle))
+                Handle_error();
+            return positions[handle];
+        }
+
+        //把src处的元素连同句柄移到dst
+        void Move_slot(size_type dst, size_type src) {
+            container_type& cont = val_pack.second;
+            cont[dst] = std::move(cont[src]);
+            handles[dst] = handles[src];
+            positions[handles[dst]] = dst;
+        }
+
+        void Place(size_type hole, value_type&& value, handle_type handle) {
+            val_pack.second[hole] = std::move(value);
+            handles[hole] = handle;
+            positions[handle] = hole;
+        }
+
+        void Sift_up(size_type hole) {
+            container_type& cont = val_pack.second;
+            value_compare& comp = Get_comp();
+            value_type value = std::move(cont[hole]);
+            handle_type handle = handles[hole];
+            while (hole) {
+                size_type parent = Parent(hole);
+                if (!comp(cont[parent], value))
+                    break;
+                Move_slot(hole, parent);
+                hole = parent;
+            }
+            Place(hole, std::move(value), handle);
+        }
+
+        //改键后元素通常只移动几层, 因此自上而下并在找到位置时立即停止
+        void Sift_down(size_type hole) {
+            container_type& cont = val_pack.second;
+            value_compare& comp = Get_comp();
+            value_type value = std::move(cont[hole]);
+            handle_type handle = handles[hole];
+            size_type count = cont.size();
+            size_type child = First_child(hole);
+            while (child < count) {
+                size_type last = count - child < Arity ? count : child + Arity;
+                size_type best = child;
+                for (size_type i = child + 1; i < last; i++)
+                    best = comp(cont[best], cont[i]) ? i : best;
+                if (!comp(value, cont[best]))
+                    break;
+                Move_slot(hole, best);
+                hole = best;
+                child = First_child(hole);
+            }
+            Place(hole, std::move(value), handle);
+        }
+
+        //以末尾元素填补pos, 再视其大小上滤或下滤
+        void Remove_at(size_type pos) {
+            container_type& cont = val_pack.second;
+            if (pos >= cont.size())
+                Handle_error();
+            size_type last = cont.size() - 1;
+            positions[handles[pos]] = npos;
+            if (pos != last) {
+                Move_slot(pos, last);
+                cont.pop_back();
+                handles.pop_back();
+                if (pos && Get_comp()(cont[Parent(pos)], cont[pos]))
+                    Sift_up(pos);
+                else Sift_down(pos);
+            }
+            else {
+                cont.pop_back();
+                handles.pop_back();
+            }
+        }
+
+        [[noreturn]] static void Handle_error() {
+            throw std::out_of_range("invalid indexed_priority_queue handle");
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::invalid_argument("indexed_priority_queue key moved in the wrong direction");
+        }
+    };
+}
+
 #endif // !OCT_QUEUE
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+#ifndef OCT_RADIX_HEAP
+#define OCT_RADIX_HEAP
+
+#include <cstdint>
+#include <limits>
+#include "utility.hpp"
+#include "vector.hpp"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace oct {
+    //表示x所需的最少位数, x为0时为0
+    inline unsigned radix_bit_width(uint64_t x) noexcept {
+        if (!x)
+            return 0;
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse64(&index, x);
+        return static_cast<unsigned>(index) + 1;
+#else
+        return 64 - static_cast<unsigned>(__builtin_clzll(x));
+#endif
+    }
+
+    /*
+    * characteristics:
+    * [monotone] 只适用于单调的无符号整数优先级: 入队的关键字不能小于最近一次出队的关键字, 堆顶总是最小的关键字
+    * [radix buckets] 以关键字与上次出队关键字的最高不同位分桶, 每个元素至多下沉位数次, push与top为O(1), pop均摊O(log C)
+    */
+    template <typename Key, typename Value>
+    class radix_heap {
+    public:     //统一接口
+        static_assert(std::is_unsigned_v<Key>, "radix_heap requires unsigned integer keys");
+
+        using key_type        = Key;
+        using mapped_type     = Value;
+        using value_type      = pair<Key, Value>;
+        using size_type       = std::size_t;
+        using const_reference = const value_type&;
+
+    private:    //成员变量
+        static constexpr unsigned bucket_count = std::numeric_limits<Key>::digits + 1;
+
+        vector<value_type> buckets[bucket_count];   //第i个桶中的关键字与last的最高不同位为第i - 1位; 第0个桶中的关键字等于last
+        size_type min_pos[bucket_count] = {};       //各桶最小元素的下标, 桶内只会追加或整体清空, 因此入桶时维护即可
+        unsigned top_bucket = 0;                    //最低的非空桶, 堆顶元素就在其中
+        Key last = 0;                               //最近一次出队的关键字
+        size_type val_size = 0;
+
+    public:     //成员函数
+        radix_heap() = default;
+
+        bool empty() const noexcept {
+            return !val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_size;
+        }
+
+        //第0个桶中的关键字都等于last, 弹出的是末尾元素; 其余的桶取记下的最小元素, 桶的重新分配留给pop
+        const_reference top() const {
+            if (!val_size)
+                Logic_error();
+            const vector<value_type>& bucket = buckets[top_bucket];
+            return top_bucket ? bucket[min_pos[top_bucket]] : bucket.back();
+        }
+
+        Key top_key() const {
+            return top().first;
+        }
+
+        //与priority_queue相同的接口, value的first为关键字
+        void push(value_type value) {
+            push(value.first, std::move(value.second));
+        }
+
+        //堆不为空时key不能小于最近一次出队的关键字, 否则抛出异常; 堆为空时可以从更小的关键字重新开始
+        template <typename Ref>
+        void push(Key key, Ref&& value) {
+            if (key < last) {
+                if (val_size)
+                    Key_error();
+                last = key;
+            }
+            unsigned i = Place(key, std::forward<Ref>(value));
+            if (!val_size || i < top_bucket)
+                top_bucket = i;
+            val_size++;
+        }
+
+        void pop() {
+            if (!val_size)
+                Logic_error();
+            if (top_bucket)
+                Refill();
+            buckets[0].pop_back();
+            val_size--;
+            if (val_size && buckets[0].empty())
+                top_bucket = Lowest_bucket();
+        }
+
+        void clear() {
+            for (vector<value_type>& bucket : buckets)
+                bucket.clear();
+            top_bucket = 0;
+            last = 0;
+            val_size = 0;
+        }
+
+    private:
+        unsigned Bucket_of(Key key) const noexcept {
+            return radix_bit_width(static_cast<uint64_t>(key ^ last));
+        }
+
+        unsigned Lowest_bucket() const noexcept {
+            unsigned i = 1;
+            while (buckets[i].empty())
+                i++;
+            return i;
+        }
+
+        //放入关键字对应的桶并维护该桶最小元素的下标, 返回桶号
+        template <typename Ref>
+        unsigned Place(Key key, Ref&& value) {
+            unsigned i = Bucket_of(key);
+            vector<value_type>& bucket = buckets[i];
+            bucket.emplace_back(key, std::forward<Ref>(value));
+            if (bucket.size() == 1 || key < bucket[min_pos[i]].first)
+                min_pos[i] = bucket.size() - 1;
+            return i;
+        }
+
+        //以最低的非空桶中的最小关键字为新的last, 该桶的元素全部落入更低的桶(更低的桶此时都为空)
+        //top返回的元素最后放入, 保证随后弹出的正是它
+        void Refill() {
+            vector<value_type>& bucket = buckets[top_bucket];
+            size_type min = min_pos[top_bucket];
+            last = bucket[min].first;
+            for (size_type j = 0; j < bucket.size(); j++)
+                if (j != min)
+                    Place(bucket[j].first, std::move(bucket[j].second));
+            buckets[0].push_back(std::move(bucket[min]));
+            bucket.clear();
+            top_bucket = 0;
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid radix_heap size");
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::invalid_argument("radix_heap key is smaller than the last popped key");
+        }
+    };
+}
+
+#endif // !OCT_RADIX_HEAP
\ No newline at end of file
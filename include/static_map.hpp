@@ -0,0 +1,221 @@
+#pragma once
+
+#ifndef OCT_STATIC_MAP
+#define OCT_STATIC_MAP
+
+#include "map.hpp"
+#include "oct_static_tree.hpp"
+
+namespace oct {
+    //关键字构造后只读的有序映射, 由oct::map或有序区间冻结而来; 值按关键字顺序另存一个数组, 可以修改
+    template <
+        typename Key,
+        typename Ty,
+        class Compare = less<Key>,
+        typename MappedContainer = vector<Ty>
+    >
+    class static_map : public static_search_tree<Key, Compare> {
+    protected:
+        using Base = static_search_tree<Key, Compare>;
+
+    public:
+        static_assert(std::is_object_v<Ty>, "static_map requires object types");
+
+        using key_type              = typename Base::key_type;
+        using mapped_type           = Ty;
+        using value_type            = pair<Key, Ty>;
+        using key_compare           = typename Base::key_compare;
+        using size_type             = typename Base::size_type;
+        using difference_type       = typename Base::difference_type;
+        using reference             = pair<const Key&, Ty&>;
+        using const_reference       = pair<const Key&, const Ty&>;
+        using key_container_type    = typename Base::key_container_type;
+        using mapped_container_type = MappedContainer;
+        using iterator              = flat_map_iterator<static_map>;
+
+    private:
+        friend iterator;
+
+        mutable mapped_container_type values;
+
+    public:
+        static_map() : Base(key_compare()) {}
+
+        explicit static_map(const key_compare& comp)
+            : Base(comp) {}
+
+        //关键字重复时保留先出现的
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        static_map(ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : Base(comp) {
+            vector<value_type> temp;
+            temp.reserve(std::distance(begin, end));
+            for (; begin != end; ++begin)
+                temp.emplace_back((*begin).first, (*begin).second);
+            value_type* first = temp.data();
+            value_type* last = first + temp.size();
+            std::stable_sort(first, last,
+                [&comp](const value_type& left, const value_type& right) { return comp(left.first, right.first); });
+            last = std::unique(first, last,
+                [&comp](const value_type& left, const value_type& right) { return !comp(left.first, right.first); });
+            Split_build(first, last);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        static_map(sorted_unique_t, ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : Base(comp) {
+            size_type count = std::distance(begin, end);
+            key_container_type keys;
+            keys.reserve(count);
+            values.reserve(count);
+            for (; begin != end; ++begin) {
+                keys.emplace_back((*begin).first);
+                values.emplace_back((*begin).second);
+            }
+            Base::Build(std::move(keys));
+        }
+
+        static_map(sorted_unique_t, key_container_type&& key_cont, mapped_container_type&& mapped_cont,
+            const key_compare& comp = key_compare())
+            : Base(comp) {
+            if (key_cont.size() != mapped_cont.size())
+                Size_error();
+            values.swap(mapped_cont);
+            Base::Build(std::move(key_cont));
+        }
+
+        //冻结一棵平衡树: 中序遍历即为有序, 线性时间建成
+        template <typename Allocator, template <typename...> typename Tree>
+        explicit static_map(const map<Key, Ty, Compare, Allocator, Tree>& source)
+            : static_map(sorted_unique, source.begin(), source.end(), source.key_comp()) {}
+
+        static_map(std::initializer_list<value_type> ini_list, const key_compare& comp = key_compare())
+            : static_map(ini_list.begin(), ini_list.end(), comp) {}
+
+        static_map(const static_map& another)
+            : Base(another), values(another.values) {}
+
+        static_map(static_map&& another) noexcept
+            : Base(std::move(another)), values(std::move(another.values)) {}
+
+        static_map& operator=(const static_map&) = default;
+        static_map& operator=(static_map&&)      = default;
+
+        ~static_map() {}
+
+        Ty& at(const key_type& key) const {
+            iterator it = find(key);
+            if (it == end())
+                Key_error();
+            return (*it).second;
+        }
+
+        iterator begin() const noexcept {
+            return Make_iter(0);
+        }
+
+        iterator end() const noexcept {
+            return Make_iter(size());
+        }
+
+        bool empty() const noexcept {
+            return !size();
+        }
+
+        size_type size() const noexcept {
+            return Base::Size();
+        }
+
+        template <typename Ref>
+        size_type count(Ref&& key) const {
+            return find(std::forward<Ref>(key)) != end();
+        }
+
+        template <typename Ref>
+        bool contains(Ref&& key) const {
+            return find(std::forward<Ref>(key)) != end();
+        }
+
+        template <typename Ref>
+        iterator find(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            size_type index = Base::Lower_index(k);
+            if (index == size() || Base::val_pack.get_first()(k, Base::Keys()[index]))
+                return end();
+            return Make_iter(index);
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> equal_range(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            size_type index = Base::Lower_index(k);
+            size_type last = index + (index != size() && !Base::val_pack.get_first()(k, Base::Keys()[index]));
+            return pair<iterator, iterator>(Make_iter(index), Make_iter(last));
+        }
+
+        template <typename Ref>
+        iterator lower_bound(Ref&& key) const {
+            return Make_iter(Base::Lower_index(lookup_key<key_type, key_compare>(std::forward<Ref>(key))));
+        }
+
+        template <typename Ref>
+        iterator upper_bound(Ref&& key) const {
+            return Make_iter(Base::Upper_index(lookup_key<key_type, key_compare>(std::forward<Ref>(key))));
+        }
+
+        //批量lower_bound: 每个关键字的结果下标(不存在时为size())依次写入out, 一批内的缓存缺失互相重叠
+        template <typename ForwardIt, typename OutputIt>
+        OutputIt lower_bound_many(ForwardIt begin, ForwardIt end, OutputIt out) const {
+            return Base::Lower_index_many(begin, end, out);
+        }
+
+        key_compare key_comp() const noexcept {
+            return Base::Key_comp();
+        }
+
+    private:
+        iterator Make_iter(size_type index) const noexcept {
+            return iterator(Base::Keys().data() + index, values.data() + index);
+        }
+
+        void Split_build(value_type* first, value_type* last) {
+            key_container_type keys;
+            keys.reserve(last - first);
+            values.reserve(last - first);
+            for (; first != last; ++first) {
+                keys.emplace_back(std::move(first->first));
+                values.emplace_back(std::move(first->second));
+            }
+            Base::Build(std::move(keys));
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::out_of_range("invalid static_map key");
+        }
+
+        [[noreturn]] static void Size_error() {
+            throw std::invalid_argument("static_map key and mapped containers differ in size");
+        }
+    };
+
+    template <typename Key, typename Ty, class Compare, typename MappedContainer>
+    bool operator==(const static_map<Key, Ty, Compare, MappedContainer>& left,
+        const static_map<Key, Ty, Compare, MappedContainer>& right) noexcept {
+        if (left.size() != right.size())
+            return false;
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end(); l++, r++)
+            if (!((*l).first == (*r).first) || !((*l).second == (*r).second))
+                return false;
+        return true;
+    }
+
+    template <typename Key, typename Ty, class Compare, typename MappedContainer>
+    bool operator!=(const static_map<Key, Ty, Compare, MappedContainer>& left,
+        const static_map<Key, Ty, Compare, MappedContainer>& right) noexcept {
+        return !(left == right);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,169 @@
+#pragma once
+
+#ifndef OCT_STATIC_SET
+#define OCT_STATIC_SET
+
+#include "set.hpp"
+#include "oct_static_tree.hpp"
+
+namespace oct {
+    //构造后只读的有序集合, 由oct::set或有序区间冻结而来
+    template <
+        typename Key,
+        class Compare = less<Key>
+    >
+    class static_set : public static_search_tree<Key, Compare> {
+    protected:
+        using Base = static_search_tree<Key, Compare>;
+
+    public:
+        using key_type           = typename Base::key_type;
+        using value_type         = Key;
+        using key_compare        = typename Base::key_compare;
+        using value_compare      = Compare;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using reference          = Key&;
+        using const_reference    = const Key&;
+        using pointer            = Key*;
+        using const_pointer      = const Key*;
+        using key_container_type = typename Base::key_container_type;
+        using iterator           = continuous_memory_iterator<static_set>;
+
+    private:
+        friend iterator;
+
+    public:
+        static_set() : Base(key_compare()) {}
+
+        explicit static_set(const key_compare& comp)
+            : Base(comp) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        static_set(ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : Base(comp) {
+            key_container_type temp;
+            temp.reserve(std::distance(begin, end));
+            for (; begin != end; ++begin)
+                temp.emplace_back(*begin);
+            pointer first = temp.data();
+            pointer last = first + temp.size();
+            std::sort(first, last, [&comp](const Key& left, const Key& right) { return comp(left, right); });
+            last = std::unique(first, last, [&comp](const Key& left, const Key& right) { return !comp(left, right); });
+            temp.erase(temp.begin() + (last - first), temp.end());
+            Base::Build(std::move(temp));
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        static_set(sorted_unique_t, ForwardIt begin, ForwardIt end, const key_compare& comp = key_compare())
+            : Base(comp) {
+            key_container_type temp;
+            temp.reserve(std::distance(begin, end));
+            for (; begin != end; ++begin)
+                temp.emplace_back(*begin);
+            Base::Build(std::move(temp));
+        }
+
+        static_set(sorted_unique_t, key_container_type&& cont, const key_compare& comp = key_compare())
+            : Base(comp) {
+            Base::Build(std::move(cont));
+        }
+
+        //冻结一棵平衡树: 中序遍历即为有序, 线性时间建成
+        template <typename Allocator, template <typename...> typename Tree>
+        explicit static_set(const set<Key, Compare, Allocator, Tree>& source)
+            : static_set(sorted_unique, source.begin(), source.end(), source.key_comp()) {}
+
+        static_set(std::initializer_list<value_type> ini_list, const key_compare& comp = key_compare())
+            : static_set(ini_list.begin(), ini_list.end(), comp) {}
+
+        static_set(const static_set& another) : Base(another) {}
+
+        static_set(static_set&& another) noexcept : Base(std::move(another)) {}
+
+        static_set& operator=(const static_set&) = default;
+        static_set& operator=(static_set&&)      = default;
+
+        ~static_set() {}
+
+        iterator begin() const noexcept {
+            return iterator(Base::Keys().data());
+        }
+
+        iterator end() const noexcept {
+            return iterator(Base::Keys().data() + size());
+        }
+
+        bool empty() const noexcept {
+            return !size();
+        }
+
+        size_type size() const noexcept {
+            return Base::Size();
+        }
+
+        template <typename Ref>
+        size_type count(Ref&& key) const {
+            return find(std::forward<Ref>(key)) != end();
+        }
+
+        template <typename Ref>
+        bool contains(Ref&& key) const {
+            return find(std::forward<Ref>(key)) != end();
+        }
+
+        template <typename Ref>
+        iterator find(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            iterator it = begin() + Base::Lower_index(k);
+            if (it == end() || Base::val_pack.get_first()(k, *it))
+                return end();
+            return it;
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> equal_range(Ref&& key) const {
+            decltype(auto) k = lookup_key<key_type, key_compare>(std::forward<Ref>(key));
+            iterator it = begin() + Base::Lower_index(k);
+            return pair<iterator, iterator>(it, it + (it != end() && !Base::val_pack.get_first()(k, *it)));
+        }
+
+        template <typename Ref>
+        iterator lower_bound(Ref&& key) const {
+            return begin() + Base::Lower_index(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator upper_bound(Ref&& key) const {
+            return begin() + Base::Upper_index(lookup_key<key_type, key_compare>(std::forward<Ref>(key)));
+        }
+
+        //批量lower_bound: 每个关键字的结果下标(不存在时为size())依次写入out, 一批内的缓存缺失互相重叠
+        template <typename ForwardIt, typename OutputIt>
+        OutputIt lower_bound_many(ForwardIt begin, ForwardIt end, OutputIt out) const {
+            return Base::Lower_index_many(begin, end, out);
+        }
+
+        key_compare key_comp() const noexcept {
+            return Base::Key_comp();
+        }
+
+        value_compare value_comp() const noexcept {
+            return Base::Key_comp();
+        }
+    };
+
+    template <typename Key, class Compare>
+    bool operator==(const static_set<Key, Compare>& left, const static_set<Key, Compare>& right) noexcept {
+        if (left.size() != right.size())
+            return false;
+        return std::equal(left.begin(), left.end(), right.begin());
+    }
+
+    template <typename Key, class Compare>
+    bool operator!=(const static_set<Key, Compare>& left, const static_set<Key, Compare>& right) noexcept {
+        return !(left == right);
+    }
+}
+
+#endif
\ No newline at end of file
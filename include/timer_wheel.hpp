@@ -0,0 +1,181 @@
+#pragma once
+
+#ifndef OCT_TIMER_WHEEL
+#define OCT_TIMER_WHEEL
+
+#include <cstdint>
+#include "radix_heap.hpp"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace oct {
+    //64位掩码的末尾零个数, mask不为0
+    inline unsigned timer_wheel_trailing_zeros(uint64_t mask) noexcept {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+    }
+
+    /*
+    * characteristics:
+    * [hierarchical wheel] 11层, 每层64个槽覆盖全部64位时刻: 到期时刻与基准时刻的最高不同6位组决定层, 该组的值决定槽
+    *                      每层以64位掩码记录非空槽, 找最早的定时器只需对掩码求末尾零
+    * [cascade] 第0层以上的槽被取到时, 基准时刻推进到其中最早的到期时刻, 槽内定时器逐个落入更低的层, 每个定时器至多下落10次
+    * 提供与priority_queue相同的push/top/pop, top总是最早到期的定时器; 另提供advance按时钟触发全部到期的定时器
+    */
+    template <typename Value>
+    class timer_wheel {
+    public:     //统一接口
+        using key_type        = uint64_t;
+        using mapped_type     = Value;
+        using value_type      = pair<uint64_t, Value>;
+        using size_type       = std::size_t;
+        using const_reference = const value_type&;
+
+    private:    //成员变量
+        static constexpr unsigned slot_bits  = 6;
+        static constexpr unsigned slot_count = 1u << slot_bits;
+        static constexpr unsigned levels     = (64 + slot_bits - 1) / slot_bits;
+
+        vector<value_type> slots[levels][slot_count];
+        uint64_t occupied[levels] = {};         //第i位表示对应的槽非空
+        uint64_t base  = 0;                     //不晚于所有定时器的到期时刻, 各定时器的层与槽都相对于它计算
+        uint64_t clock = 0;                     //当前时刻, 不早于base
+        size_type val_size = 0;
+
+    public:     //成员函数
+        explicit timer_wheel(uint64_t now = 0) : base(now), clock(now) {}
+
+        bool empty() const noexcept {
+            return !val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_size;
+        }
+
+        uint64_t now() const noexcept {
+            return clock;
+        }
+
+        //与priority_queue相同的接口, value的first为关键字
+        void push(value_type value) {
+            push(value.first, std::move(value.second));
+        }
+
+        //已经过期的定时器按当前时刻入队
+        template <typename Ref>
+        void push(uint64_t expire, Ref&& value) {
+            if (expire < clock)
+                expire = clock;
+            Slot_of(expire).emplace_back(expire, std::forward<Ref>(value));
+            val_size++;
+        }
+
+        //第0层非空时就是其最低的非空槽, 否则需在更高层最低的非空槽中找最早者
+        //同时到期的取最后一个, 与下落后第0层槽的末尾一致
+        const_reference top() const {
+            if (!val_size)
+                Logic_error();
+            unsigned level = Lowest_level();
+            const vector<value_type>& slot = slots[level][timer_wheel_trailing_zeros(occupied[level])];
+            if (!level)
+                return slot.back();
+            size_type earliest = 0;
+            for (size_type i = 1; i < slot.size(); i++)
+                earliest = slot[i].first <= slot[earliest].first ? i : earliest;
+            return slot[earliest];
+        }
+
+        uint64_t top_key() const {
+            return top().first;
+        }
+
+        //时钟随之推进到被弹出的定时器的到期时刻
+        void pop() {
+            Take_top();
+        }
+
+        //依次弹出到期时刻不晚于time的定时器并以value_type&调用func, 最后时钟推进到time
+        //func中可以push新的定时器, 到期时刻不晚于time的同样会在本次被触发
+        template <typename Func>
+        size_type advance(uint64_t time, Func&& func) {
+            size_type fired = 0;
+            while (val_size && top_key() <= time) {
+                value_type timer = Take_top();
+                func(timer);
+                fired++;
+            }
+            clock = time > clock ? time : clock;
+            return fired;
+        }
+
+        void clear() {
+            for (unsigned level = 0; level < levels; level++) {
+                for (unsigned i = 0; i < slot_count; i++)
+                    slots[level][i].clear();
+                occupied[level] = 0;
+            }
+            base = clock;
+            val_size = 0;
+        }
+
+    private:
+        unsigned Lowest_level() const noexcept {
+            unsigned level = 0;
+            while (!occupied[level])
+                level++;
+            return level;
+        }
+
+        vector<value_type>& Slot_of(uint64_t expire) noexcept {
+            unsigned level = expire == base ? 0 : (radix_bit_width(expire ^ base) - 1) / slot_bits;
+            unsigned index = static_cast<unsigned>(expire >> (level * slot_bits)) & (slot_count - 1);
+            occupied[level] |= uint64_t(1) << index;
+            return slots[level][index];
+        }
+
+        //把最早的槽降到第0层后取出其中一个定时器
+        value_type Take_top() {
+            if (!val_size)
+                Logic_error();
+            if (!occupied[0])
+                Cascade(Lowest_level());
+            unsigned index = timer_wheel_trailing_zeros(occupied[0]);
+            vector<value_type>& slot = slots[0][index];
+            value_type res = std::move(slot.back());
+            slot.pop_back();
+            if (slot.empty())
+                occupied[0] &= ~(uint64_t(1) << index);
+            val_size--;
+            base = res.first;
+            clock = base > clock ? base : clock;
+            return res;
+        }
+
+        void Cascade(unsigned level) {
+            unsigned index = timer_wheel_trailing_zeros(occupied[level]);
+            vector<value_type>& slot = slots[level][index];
+            occupied[level] &= ~(uint64_t(1) << index);
+            uint64_t earliest = slot[0].first;
+            for (size_type i = 1; i < slot.size(); i++)
+                earliest = slot[i].first < earliest ? slot[i].first : earliest;
+            base = earliest;
+            for (size_type i = 0; i < slot.size(); i++)
+                Slot_of(slot[i].first).push_back(std::move(slot[i]));
+            slot.clear();
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid timer_wheel size");
+        }
+    };
+}
+
+#endif // !OCT_TIMER_WHEEL
\ No newline at end of file
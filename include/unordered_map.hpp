@@ -0,0 +1,326 @@
+#pragma once
+
+#ifndef OCT_UNORDERED_MAP
+#define OCT_UNORDERED_MAP
+
+#include "oct_swiss_table.hpp"
+#include "oct_chained_table.hpp"
+#include "oct_robin_hood_table.hpp"
+
+namespace oct {
+    template <
+        typename Key,
+        typename Ty,
+        class Hash         = std::hash<Key>,
+        class KeyEqual     = equal_to<Key>,
+        typename Allocator = allocator<Ty>,
+        template <typename...>
+        typename Table     = swiss_table
+    >
+    class unordered_map : public Table<Key, pair<Key, Ty>, Hash, KeyEqual, Allocator> {
+    protected:
+        using Base = Table<Key, pair<Key, Ty>, Hash, KeyEqual, Allocator>;
+
+    public:
+        static_assert(std::is_object_v<Ty>, "unordered_map requires object types");
+
+        using key_type           = typename Base::key_type;
+        using mapped_type        = Ty;
+        using value_type         = typename Base::value_type;
+        using size_type          = typename Base::size_type;
+        using difference_type    = typename Base::difference_type;
+        using hasher             = typename Base::hasher;
+        using key_equal          = typename Base::key_equal;
+        using allocator_type     = typename Base::allocator_type;
+        using reference          = typename Base::reference;
+        using const_reference    = typename Base::const_reference;
+        using pointer            = typename Base::pointer;
+        using const_pointer      = typename Base::const_pointer;
+        using iterator           = typename Base::iterator;
+        using local_iterator     = typename Base::local_iterator;
+        using insert_return_type = typename Base::insert_return_type;
+
+    public:
+        unordered_map() : Base() {}
+
+        explicit unordered_map(size_type bucket_count, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : Base(bucket_count, hash, equal, alloc) {}
+
+        explicit unordered_map(const allocator_type& alloc)
+            : Base(0, hasher(), key_equal(), alloc) {}
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        unordered_map(ForwardIt begin, ForwardIt end, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : Base(begin, end, bucket_count, hash, equal, alloc) {}
+
+        unordered_map(const unordered_map& another)
+            : Base(another) {}
+
+        unordered_map(unordered_map&& another) noexcept
+            : Base(std::move(another)) {}
+
+        unordered_map(std::initializer_list<value_type> ini_list, size_type bucket_count = 0, const hasher& hash = hasher(),
+            const key_equal& equal = key_equal(), const allocator_type& alloc = allocator_type())
+            : Base(ini_list, bucket_count, hash, equal, alloc) {}
+
+        ~unordered_map() {}
+
+        unordered_map& operator=(const unordered_map& another) {
+            if (this == &another)
+                return *this;
+            Base::operator=(another);
+            return *this;
+        }
+
+        unordered_map& operator=(unordered_map&& another) noexcept {
+            if (this == &another)
+                return *this;
+            Base::operator=(std::move(another));
+            return *this;
+        }
+
+        allocator_type get_allocator() const noexcept {
+            return Base::Get_allocator();
+        }
+
+        Ty& at(const key_type& key) {
+            iterator it = find(key);
+            if (it == end())
+                Key_error();
+            return (*it).second;
+        }
+
+        const Ty& at(const key_type& key) const {
+            iterator it = find(key);
+            if (it == end())
+                Key_error();
+            return (*it).second;
+        }
+
+        Ty& operator[](const key_type& key) {
+            return Base::operator[](key).second;
+        }
+
+        iterator begin() const noexcept {
+            return Base::Begin();
+        }
+
+        iterator end() const noexcept {
+            return Base::End();
+        }
+
+        bool empty() const noexcept {
+            return Base::Empty();
+        }
+
+        size_type size() const noexcept {
+            return Base::Size();
+        }
+
+        void clear() {
+            Base::Clear();
+        }
+
+        pair<iterator, bool> insert(const_reference target) {
+            return Base::Insert(target);
+        }
+
+        pair<iterator, bool> insert(value_type&& target) {
+            return Base::Emplace(std::move(target));
+        }
+
+        iterator insert(iterator hint, const_reference target) {
+            return Base::Insert(hint, target);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void insert(ForwardIt begin, ForwardIt end) {
+            Base::Insert(begin, end);
+        }
+
+        void insert(std::initializer_list<value_type> ini_list) {
+            Base::Insert(ini_list);
+        }
+
+        template <typename... Args>
+        pair<iterator, bool> emplace(Args&&... args) {
+            return Base::Emplace(std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        iterator emplace_hint(iterator hint, Args&&... args) {
+            return Base::Emplace_hint(hint, std::forward<Args>(args)...);
+        }
+
+        //关键字已存在时什么也不做, args不会被移走; 否则以key和args原位构造元素
+        template <typename... Args>
+        pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+            return Base::Try_emplace(key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+            return Base::Try_emplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename Mref>
+        pair<iterator, bool> insert_or_assign(const key_type& key, Mref&& value) {
+            pair<iterator, bool> res = Base::Try_emplace(key, std::forward<Mref>(value));
+            if (!res.second)
+                (*res.first).second = std::forward<Mref>(value);
+            return res;
+        }
+
+        template <typename Mref>
+        pair<iterator, bool> insert_or_assign(key_type&& key, Mref&& value) {
+            pair<iterator, bool> res = Base::Try_emplace(std::move(key), std::forward<Mref>(value));
+            if (!res.second)
+                (*res.first).second = std::forward<Mref>(value);
+            return res;
+        }
+
+        iterator erase(iterator pos) {
+            return Base::Erase(pos);
+        }
+
+        iterator erase(iterator begin, iterator end) {
+            return Base::Erase(begin, end);
+        }
+
+        template <typename Ref>
+        size_type erase(Ref&& key) {
+            return Base::Erase(lookup_key<key_type, hasher, key_equal>(std::forward<Ref>(key)));
+        }
+
+        void swap(unordered_map& another) noexcept {
+            Base::Swap(another);
+        }
+
+        template <typename Ref>
+        size_type count(Ref&& key) const {
+            return Base::Count(lookup_key<key_type, hasher, key_equal>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        iterator find(Ref&& key) const {
+            return Base::Find(lookup_key<key_type, hasher, key_equal>(std::forward<Ref>(key)));
+        }
+
+        template <typename Ref>
+        pair<iterator, iterator> equal_range(Ref&& key) const {
+            return Base::Equal_range(lookup_key<key_type, hasher, key_equal>(std::forward<Ref>(key)));
+        }
+
+        //批量查找, 需要robin_hood_table: 每个关键字的结果(找不到为end())依次写入out
+        template <typename ForwardIt, typename OutputIt>
+        OutputIt find_many(ForwardIt begin, ForwardIt end, OutputIt out) const {
+            return Base::Find_many(begin, end, out);
+        }
+
+        template <typename Keys, typename OutputIt>
+        OutputIt find_many(const Keys& keys, OutputIt out) const {
+            return Base::Find_many(std::begin(keys), std::end(keys), out);
+        }
+
+        size_type bucket_count() const noexcept {
+            return Base::Bucket_count();
+        }
+
+        //按桶访问的接口需要节点式的Table(如chained_table)
+        size_type max_bucket_count() const noexcept {
+            return Base::Max_bucket_count();
+        }
+
+        size_type bucket_size(size_type n) const {
+            return Base::Bucket_size(n);
+        }
+
+        template <typename Ref>
+        size_type bucket(const Ref& key) const {
+            return Base::Bucket(lookup_key<key_type, hasher, key_equal>(key));
+        }
+
+        local_iterator begin(size_type n) const noexcept {
+            return Base::Begin(n);
+        }
+
+        local_iterator end(size_type n) const noexcept {
+            return Base::End(n);
+        }
+
+        float load_factor() const noexcept {
+            return Base::Load_factor();
+        }
+
+        float max_load_factor() const noexcept {
+            return Base::Max_load_factor();
+        }
+
+        void max_load_factor(float ml) {
+            Base::Max_load_factor(ml);
+        }
+
+        void rehash(size_type count) {
+            Base::Rehash(count);
+        }
+
+        void reserve(size_type count) {
+            Base::Reserve(count);
+        }
+
+        hasher hash_function() const {
+            return Base::Hash_function();
+        }
+
+        key_equal key_eq() const {
+            return Base::Key_eq();
+        }
+
+        [[noreturn]] static void Key_error() {
+            throw std::out_of_range("invalid unordered_map key");
+        }
+    };
+
+    //元素个数相同且每个元素都能在另一侧找到相等的元素
+    template <
+        typename Key,
+        typename Ty,
+        class Hash,
+        class KeyEqual,
+        typename Allocator,
+        template <typename...>
+        typename Table
+    >
+    bool operator==(const unordered_map<Key, Ty, Hash, KeyEqual, Allocator, Table>& left,
+                    const unordered_map<Key, Ty, Hash, KeyEqual, Allocator, Table>& right) {
+        if (left.size() != right.size())
+            return false;
+        for (const auto& elem : left) {
+            auto pos = right.find(elem.first);
+            if (pos == right.end() || !((*pos).second == elem.second))
+                return false;
+        }
+        return true;
+    }
+
+    template <
+        typename Key,
+        typename Ty,
+        class Hash,
+        class KeyEqual,
+        typename Allocator,
+        template <typename...>
+        typename Table
+    >
+    bool operator!=(const unordered_map<Key, Ty, Hash, KeyEqual, Allocator, Table>& left,
+                    const unordered_map<Key, Ty, Hash, KeyEqual, Allocator, Table>& right) {
+        return !(left == right);
+    }
+
+    template<typename Key, typename Ty, typename Hash = std::hash<Key>, typename KeyEqual = equal_to<Key>, typename Alloc = oct::allocator<Ty>>
+    unordered_map(std::initializer_list<std::pair<Key, Ty>>) -> unordered_map<Key, Ty, Hash, KeyEqual, Alloc>;
+}
+
+#endif // !OCT_UNORDERED_MAP
\ No newline at end of file
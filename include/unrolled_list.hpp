@@ -0,0 +1,717 @@
+#pragma once
+
+#ifndef OCT_UNROLLED_LIST
+#define OCT_UNROLLED_LIST
+
+#include <algorithm>
+#include <cstring>
+#include "utility.hpp"
+#include "type_traits.hpp"
+#include "vector.hpp"
+
+namespace oct {
+    /*
+    * characteristics:
+    * [unrolled_node]
+    * [EBO]
+    */
+    inline constexpr std::size_t unrolled_list_node_bytes = 256;    //节点目标大小, 4条缓存行
+
+    struct unrolled_list_node_base {
+        unrolled_list_node_base* next;
+        unrolled_list_node_base* prev;
+        std::size_t count;                  //节点内元素个数, 哨兵恒为0
+
+        unrolled_list_node_base() : next(this), prev(this), count(0) {}
+
+        unrolled_list_node_base(const unrolled_list_node_base&)            = delete;
+        unrolled_list_node_base& operator=(const unrolled_list_node_base&) = delete;
+    };
+
+    //一个节点连续存放至多Capacity个元素, 元素总在[0, count)中
+    template <typename Ty, std::size_t Capacity>
+    struct unrolled_list_node : public unrolled_list_node_base {
+        alignas(Ty) unsigned char buf[sizeof(Ty) * Capacity];
+
+        unrolled_list_node() = default;
+
+        Ty* Vals() noexcept {
+            return reinterpret_cast<Ty*>(buf);
+        }
+    };
+
+    template <typename Ty>
+    inline constexpr std::size_t unrolled_list_capacity_v =
+        (unrolled_list_node_bytes - sizeof(unrolled_list_node_base)) / sizeof(Ty) > 4 ?
+        (unrolled_list_node_bytes - sizeof(unrolled_list_node_base)) / sizeof(Ty) : 4;
+
+    template <typename List>
+    struct unrolled_list_val {
+        using size_type = typename List::size_type;
+
+        unrolled_list_node_base dummy;
+        size_type val_size   = 0;
+        size_type node_count = 0;
+    };
+
+#define OCT_UNROLLED_LIST_VAL_PACK_UNWRAP unrolled_list_node_base& dummy      = val_pack.second.dummy;      \
+                                          size_type&               val_size   = val_pack.second.val_size;   \
+                                          size_type&               node_count = val_pack.second.node_count; \
+                                          Alnode&                  alloc      = val_pack.get_first();
+
+    //插入时节点已满则对半拆分, 删除后与后继节点合计不超过半满则合并;
+    //插入/删除使所在节点(及被拆分/合并的相邻节点)上的迭代器失效
+    template <
+        typename Ty,
+        std::size_t NodeCapacity = unrolled_list_capacity_v<Ty>,
+        typename Allocator = allocator<Ty>
+    >
+    class unrolled_list {
+    private:    //内部类与内部配置器
+        using Alty          = rebind_alloc_t<Allocator, Ty>;
+        using Alty_traits   = std::allocator_traits<Alty>;
+        using Node          = unrolled_list_node<Ty, NodeCapacity>;
+        using Alnode        = rebind_alloc_t<Allocator, Node>;
+        using Alnode_traits = std::allocator_traits<Alnode>;
+        using Nodeptr       = Node*;
+        using Baseptr       = unrolled_list_node_base*;
+
+    public:     //统一接口
+        static_assert(std::is_object_v<Ty>, "unrolled_list requires object types");
+        static_assert(NodeCapacity >= 2, "unrolled_list requires at least two elements per node");
+
+        using value_type      = Ty;
+        using allocator_type  = Allocator;
+        using size_type       = typename Alty_traits::size_type;
+        using difference_type = typename Alty_traits::difference_type;
+        using reference       = Ty&;
+        using const_reference = const Ty&;
+        using pointer         = typename Alty_traits::pointer;
+        using const_pointer   = typename Alty_traits::const_pointer;
+        using iterator        = unrolled_list_iterator<unrolled_list>;
+
+        static constexpr size_type node_capacity = NodeCapacity;
+
+    private:    //成员变量
+        friend iterator;
+
+        mutable compressed_pair<Alnode, unrolled_list_val<unrolled_list>> val_pack;
+
+    public:     //成员函数
+        unrolled_list() : val_pack(Alnode()) {}
+
+        explicit unrolled_list(const allocator_type& al)
+            : val_pack(al) {}
+
+        explicit unrolled_list(size_type count, const allocator_type& al = allocator_type())
+            : unrolled_list(count, value_type(), al) {}
+
+        explicit unrolled_list(size_type count, const_reference target, const allocator_type& al = allocator_type())
+            : val_pack(al) {
+            for (size_type i = 0; i < count; i++)
+                emplace_back(target);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        unrolled_list(ForwardIt begin, ForwardIt end, const allocator_type& al = allocator_type())
+            : val_pack(al) {
+            for (; begin != end; ++begin)
+                emplace_back(*begin);
+        }
+
+        unrolled_list(const unrolled_list& another)
+            : unrolled_list(another.begin(), another.end(), another.val_pack.get_first()) {}
+
+        unrolled_list(unrolled_list&& another) noexcept
+            : val_pack(another.val_pack.get_first()) {
+            Take(another);
+        }
+
+        unrolled_list(std::initializer_list<value_type> ini_list, const allocator_type& al = allocator_type())
+            : unrolled_list(ini_list.begin(), ini_list.end(), al) {}
+
+        ~unrolled_list() {
+            clear();
+        }
+
+        unrolled_list& operator=(const unrolled_list& another) {
+            if (this == &another)
+                return *this;
+            unrolled_list temp(another);
+            swap(temp);
+            return *this;
+        }
+
+        unrolled_list& operator=(unrolled_list&& another) noexcept {
+            if (this == &another)
+                return *this;
+            clear();
+            Take(another);
+            return *this;
+        }
+
+        void assign(size_type count, const_reference target = value_type()) {
+            unrolled_list temp(count, target);
+            swap(temp);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        void assign(ForwardIt begin, ForwardIt end) {
+            unrolled_list temp(begin, end);
+            swap(temp);
+        }
+
+        void assign(std::initializer_list<value_type> ini_list) {
+            unrolled_list temp(ini_list);
+            swap(temp);
+        }
+
+        allocator_type get_allocator() const noexcept {
+            return val_pack.get_first();
+        }
+
+        reference front() const {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            return *begin();
+        }
+
+        reference back() const {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            Baseptr last = val_pack.second.dummy.prev;
+            return static_cast<Nodeptr>(last)->Vals()[last->count - 1];
+        }
+
+        iterator begin() const noexcept {
+            return Make_iter(val_pack.second.dummy.next, 0);
+        }
+
+        iterator end() const noexcept {
+            return iterator(&val_pack.second.dummy);
+        }
+
+        bool empty() const noexcept {
+            return !val_pack.second.val_size;
+        }
+
+        size_type size() const noexcept {
+            return val_pack.second.val_size;
+        }
+
+        size_type node_count() const noexcept {
+            return val_pack.second.node_count;
+        }
+
+        void clear() noexcept {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            Baseptr node = dummy.next;
+            while (node != &dummy) {
+                Nodeptr cur = static_cast<Nodeptr>(node);
+                node = node->next;
+                Destroy_n(cur->Vals(), cur->count);
+                Alnode_traits::destroy(alloc, cur);
+                Alnode_traits::deallocate(alloc, cur, 1);
+            }
+            dummy.next = dummy.prev = &dummy;
+            val_size = 0;
+            node_count = 0;
+        }
+
+        template <typename Ref>
+        iterator insert(iterator it, Ref&& target) {
+            return emplace(it, std::forward<Ref>(target));
+        }
+
+        //以args在it之前构造元素; 所在节点已满时先拆分, 均摊O(1)
+        //空出槽位会搬动已有元素, args可能引用其中之一, 因此除尾部追加外先构造出临时元素
+        template <typename... Args>
+        iterator emplace(iterator it, Args&&... args) {
+            if (!it.node)
+                Iterator_error();
+            if (it.node == &val_pack.second.dummy)
+                return Emplace_at(it, std::forward<Args>(args)...);
+            value_type temp(std::forward<Args>(args)...);
+            return Emplace_at(it, std::move(temp));
+        }
+
+        //批量插入先在临时链表中紧凑地建好节点, 再整段接入, 只拆分it所在的一个节点
+        iterator insert(iterator it, size_type count, const_reference target) {
+            unrolled_list temp(count, target, get_allocator());
+            return Splice_all(it, temp);
+        }
+
+        template <typename ForwardIt, std::enable_if_t<is_forward_iterator_v<ForwardIt>, int> = 0>
+        iterator insert(iterator it, ForwardIt begin, ForwardIt end) {
+            unrolled_list temp(begin, end, get_allocator());
+            return Splice_all(it, temp);
+        }
+
+        iterator insert(iterator it, std::initializer_list<value_type> ini_list) {
+            return insert(it, ini_list.begin(), ini_list.end());
+        }
+
+        iterator erase(iterator it) {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            if (!it.node || it.node == &dummy)
+                Iterator_error();
+            Nodeptr node = static_cast<Nodeptr>(it.node);
+            size_type index = Index(it);
+            Alnode_traits::destroy(alloc, node->Vals() + index);
+            Close_slot(node, index);
+            if (!node->count)
+                return Make_iter(Free_node(node), 0);
+            Baseptr next = node->next;
+            if (next != &dummy && node->count + next->count <= NodeCapacity / 2) {
+                Relocate(static_cast<Nodeptr>(next)->Vals(), next->count, node->Vals() + node->count);
+                node->count += next->count;
+                next->count = 0;
+                Free_node(next);
+            }
+            if (index == node->count)
+                return Make_iter(node->next, 0);
+            return Make_iter(node, index);
+        }
+
+        //逐个删除, 每次删除后重新取得位置, 不受节点合并的影响
+        iterator erase(iterator begin, iterator end) {
+            size_type count = std::distance(begin, end);
+            while (count--)
+                begin = erase(begin);
+            return begin;
+        }
+
+        template <typename Ref>
+        void push_back(Ref&& target) {
+            emplace_back(std::forward<Ref>(target));
+        }
+
+        template <typename... Args>
+        reference emplace_back(Args&&... args) {
+            return *emplace(end(), std::forward<Args>(args)...);
+        }
+
+        template<typename Ref>
+        unrolled_list& operator<<(Ref&& elem) {
+            push_back(std::forward<Ref>(elem));
+            return *this;
+        }
+
+        void pop_back() {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            if (!val_size)
+                Logic_error();
+            erase(Make_iter(dummy.prev, dummy.prev->count - 1));
+        }
+
+        template <typename Ref>
+        void push_front(Ref&& target) {
+            emplace_front(std::forward<Ref>(target));
+        }
+
+        template <typename... Args>
+        reference emplace_front(Args&&... args) {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        }
+
+        void pop_front() {
+            if (!val_pack.second.val_size)
+                Logic_error();
+            erase(begin());
+        }
+
+        void resize(size_type count, const_reference value = value_type()) {
+            while (size() > count)
+                pop_back();
+            while (size() < count)
+                emplace_back(value);
+        }
+
+        void swap(unrolled_list& another) noexcept {
+            if (this == &another)
+                return;
+            unrolled_list temp(std::move(another));
+            another.Take(*this);
+            Take(temp);
+        }
+
+        //重新紧凑排列全部元素, 释放未填满的节点
+        void shrink_to_fit() {
+            if (node_count() <= (size() + NodeCapacity - 1) / NodeCapacity)
+                return;
+            unrolled_list temp(get_allocator());
+            for (iterator it = begin(); it != end(); ++it)
+                temp.emplace_back(std::move(*it));
+            swap(temp);
+        }
+
+        //归并结果按序紧凑地写入新节点, 相等元素中本链表的在前
+        template <class Compare = less<value_type>>
+        void merge(unrolled_list& another, const Compare& comp = Compare()) {
+            if (this == &another)
+                return;
+            unrolled_list res(get_allocator());
+            iterator A = begin(), B = another.begin();
+            while (A != end() && B != another.end())
+                if (comp(*B, *A))
+                    res.emplace_back(std::move(*B++));
+                else
+                    res.emplace_back(std::move(*A++));
+            for (; A != end(); ++A)
+                res.emplace_back(std::move(*A));
+            for (; B != another.end(); ++B)
+                res.emplace_back(std::move(*B));
+            another.clear();
+            swap(res);
+        }
+
+        template <class Compare = less<value_type>>
+        void merge(unrolled_list&& another, const Compare& comp = Compare()) {
+            merge(another, comp);
+        }
+
+        //整个another接入pos之前: 只拆分pos所在的节点, 其余节点直接重新链接, O(NodeCapacity)
+        void splice(iterator pos, unrolled_list& another) {
+            if (this != &another)
+                Splice_all(pos, another);
+        }
+
+        void splice(iterator pos, unrolled_list&& another) {
+            splice(pos, another);
+        }
+
+        //元素被移动到本链表中, another不能是*this
+        void splice(iterator pos, unrolled_list& another, iterator it) {
+            emplace(pos, std::move(*it));
+            another.erase(it);
+        }
+
+        void splice(iterator pos, unrolled_list& another, iterator begin, iterator end) {
+            unrolled_list temp(std::make_move_iterator(begin), std::make_move_iterator(end), get_allocator());
+            another.erase(begin, end);
+            Splice_all(pos, temp);
+        }
+
+        size_type remove(const_reference elem) {
+            return remove_if([&elem](const_reference cur) { return cur == elem; });
+        }
+
+        //一次遍历把保留的元素前移补齐, 再从尾部截断, O(n)
+        template <class Predicate>
+        size_type remove_if(Predicate pr) {
+            iterator write = begin();
+            for (iterator read = begin(); read != end(); ++read)
+                if (!pr(*read)) {
+                    if (write != read)
+                        *write = std::move(*read);
+                    ++write;
+                }
+            return Truncate(write);
+        }
+
+        void reverse() noexcept {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            Baseptr node = &dummy;
+            do {
+                if (node != &dummy)
+                    std::reverse(static_cast<Nodeptr>(node)->Vals(), static_cast<Nodeptr>(node)->Vals() + node->count);
+                std::swap(node->next, node->prev);
+                node = node->prev;
+            } while (node != &dummy);
+        }
+
+        size_type unique() {
+            return unique([](const_reference left, const_reference right) { return left == right; });
+        }
+
+        template <class BinaryPredicate>
+        size_type unique(BinaryPredicate bpr) {
+            if (empty())
+                return 0;
+            iterator write = begin();
+            iterator read = begin();
+            for (++read; read != end(); ++read)
+                if (!bpr(*write, *read)) {
+                    ++write;
+                    if (write != read)
+                        *write = std::move(*read);
+                }
+            return Truncate(++write);
+        }
+
+        //元素移到连续的临时数组中稳定排序后按原位置写回, 节点结构不变
+        template <class Compare = less<value_type>>
+        void sort(const Compare& comp = Compare()) {
+            if (size() <= 1)
+                return;
+            vector<value_type> temp;
+            temp.reserve(size());
+            for (iterator it = begin(); it != end(); ++it)
+                temp.emplace_back(std::move(*it));
+            std::stable_sort(temp.data(), temp.data() + temp.size(), comp);
+            size_type i = 0;
+            for (iterator it = begin(); it != end(); ++it)
+                *it = std::move(temp[i++]);
+        }
+
+    private:
+        void Take(unrolled_list& another) noexcept {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            unrolled_list_val<unrolled_list>& other = another.val_pack.second;
+            if (!other.node_count)
+                return;
+            dummy.next = other.dummy.next;
+            dummy.prev = other.dummy.prev;
+            dummy.next->prev = &dummy;
+            dummy.prev->next = &dummy;
+            val_size = other.val_size;
+            node_count = other.node_count;
+            other.dummy.next = other.dummy.prev = &other.dummy;
+            other.val_size = 0;
+            other.node_count = 0;
+        }
+
+        //哨兵处返回end(), 否则返回指向node中第index个元素的迭代器
+        iterator Make_iter(Baseptr node, size_type index) const noexcept {
+            if (node == &val_pack.second.dummy)
+                return iterator(node);
+            pointer vals = static_cast<Nodeptr>(node)->Vals();
+            return iterator(node, vals + index, vals + node->count);
+        }
+
+        //构造失败时收回槽位, 为此新建的节点随之释放, 保持没有空节点
+        template <typename... Args>
+        iterator Emplace_at(iterator it, Args&&... args) {
+            size_type index = Index(it);
+            Nodeptr node = Open_slot(it.node, index);
+            try {
+                Alnode_traits::construct(val_pack.get_first(), node->Vals() + index, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                Close_slot(node, index);
+                if (!node->count)
+                    Free_node(node);
+                throw;
+            }
+            return Make_iter(node, index);
+        }
+
+        static size_type Index(const iterator& it) noexcept {
+            return it.cur ? it.cur - static_cast<Nodeptr>(it.node)->Vals() : 0;
+        }
+
+        Nodeptr Create_node_after(Baseptr pre) {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            Nodeptr node = Alnode_traits::allocate(alloc, 1);
+            Alnode_traits::construct(alloc, node);
+            node->prev = pre;
+            node->next = pre->next;
+            node->prev->next = node;
+            node->next->prev = node;
+            node_count++;
+            return node;
+        }
+
+        //node中已没有元素, 摘下并释放, 返回其后继
+        Baseptr Free_node(Baseptr node) {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            Baseptr next = node->next;
+            node->prev->next = next;
+            next->prev = node->prev;
+            Alnode_traits::destroy(alloc, static_cast<Nodeptr>(node));
+            Alnode_traits::deallocate(alloc, static_cast<Nodeptr>(node), 1);
+            node_count--;
+            return next;
+        }
+
+        //把from起的n个元素搬到未初始化的to处, 源位置随即析构
+        void Relocate(pointer from, size_type n, pointer to) {
+            if constexpr (std::is_trivially_copyable_v<value_type>) {
+                std::memmove(static_cast<void*>(to), static_cast<const void*>(from), n * sizeof(value_type));
+            }
+            else {
+                Alnode& alloc = val_pack.get_first();
+                for (size_type i = 0; i < n; i++) {
+                    Alnode_traits::construct(alloc, to + i, std::move(from[i]));
+                    Alnode_traits::destroy(alloc, from + i);
+                }
+            }
+        }
+
+        void Destroy_n(pointer ptr, size_type n) {
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                Alnode& alloc = val_pack.get_first();
+                for (size_type i = 0; i < n; i++)
+                    Alnode_traits::destroy(alloc, ptr + i);
+            }
+        }
+
+        //在(node, index)处空出一个未初始化的槽位, 返回槽位所在节点, index随之修正
+        Nodeptr Open_slot(Baseptr node, size_type& index) {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            if (node == &dummy) {                   //尾部插入: 最后一个节点有空位就追加, 否则新建节点
+                Baseptr last = dummy.prev;
+                if (last != &dummy && last->count < NodeCapacity) {
+                    node = last;
+                    index = last->count;
+                }
+                else {
+                    node = Create_node_after(last);
+                    index = 0;
+                }
+            }
+            else if (node->count == NodeCapacity) {
+                if (!index) {                       //节点开头插入: 前一个节点有空位就追加到它末尾, 否则在前面新建节点
+                    Baseptr prev = node->prev;
+                    if (prev != &dummy && prev->count < NodeCapacity) {
+                        node = prev;
+                        index = prev->count;
+                    }
+                    else
+                        node = Create_node_after(prev);
+                }
+                else {                              //否则对半拆分
+                    Nodeptr right = Create_node_after(node);
+                    size_type half = NodeCapacity / 2;
+                    Relocate(static_cast<Nodeptr>(node)->Vals() + half, NodeCapacity - half, right->Vals());
+                    right->count = NodeCapacity - half;
+                    node->count = half;
+                    if (index > half) {
+                        node = right;
+                        index -= half;
+                    }
+                }
+            }
+            Nodeptr target = static_cast<Nodeptr>(node);
+            pointer vals = target->Vals();
+            if (index != node->count)
+                Relocate_backward(vals + index, node->count - index, vals + index + 1);
+            node->count++;
+            val_size++;
+            return target;
+        }
+
+        //槽位index中的元素已析构, 把其后的元素前移一格
+        void Close_slot(Nodeptr node, size_type index) {
+            pointer vals = node->Vals();
+            if (index + 1 < node->count)
+                Relocate(vals + index + 1, node->count - index - 1, vals + index);
+            node->count--;
+            val_pack.second.val_size--;
+        }
+
+        //目标区间与源区间重叠且在其后, 从后往前搬
+        void Relocate_backward(pointer from, size_type n, pointer to) {
+            if constexpr (std::is_trivially_copyable_v<value_type>) {
+                std::memmove(static_cast<void*>(to), static_cast<const void*>(from), n * sizeof(value_type));
+            }
+            else {
+                Alnode& alloc = val_pack.get_first();
+                for (size_type i = n; i-- > 0;) {
+                    Alnode_traits::construct(alloc, to + i, std::move(from[i]));
+                    Alnode_traits::destroy(alloc, from + i);
+                }
+            }
+        }
+
+        //pos处于节点中间时把该节点从pos起的后半段搬到新节点, 返回应在其之前接入的节点
+        Baseptr Split_at(iterator pos) {
+            Baseptr node = pos.node;
+            size_type index = Index(pos);
+            if (!index)
+                return node;
+            Nodeptr right = Create_node_after(node);
+            Relocate(static_cast<Nodeptr>(node)->Vals() + index, node->count - index, right->Vals());
+            right->count = node->count - index;
+            node->count = index;
+            return right;
+        }
+
+        //another的全部节点接入pos之前, 返回指向第一个接入元素的迭代器
+        iterator Splice_all(iterator pos, unrolled_list& another) {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            if (!pos.node)
+                Iterator_error();
+            unrolled_list_val<unrolled_list>& other = another.val_pack.second;
+            if (!other.val_size)
+                return pos;
+            Baseptr at = Split_at(pos);
+            Baseptr first = other.dummy.next;
+            Baseptr last = other.dummy.prev;
+            first->prev = at->prev;
+            last->next = at;
+            at->prev->next = first;
+            at->prev = last;
+            val_size += other.val_size;
+            node_count += other.node_count;
+            other.dummy.next = other.dummy.prev = &other.dummy;
+            other.val_size = 0;
+            other.node_count = 0;
+            return Make_iter(first, 0);
+        }
+
+        //删除[pos, end())
+        size_type Truncate(iterator pos) {
+            OCT_UNROLLED_LIST_VAL_PACK_UNWRAP
+            if (pos == end())
+                return 0;
+            size_type res = 0;
+            Baseptr node = pos.node;
+            size_type index = Index(pos);
+            if (index) {
+                Nodeptr cur = static_cast<Nodeptr>(node);
+                Destroy_n(cur->Vals() + index, cur->count - index);
+                res += cur->count - index;
+                cur->count = index;
+                node = node->next;
+            }
+            while (node != &dummy) {
+                Nodeptr cur = static_cast<Nodeptr>(node);
+                Destroy_n(cur->Vals(), cur->count);
+                res += cur->count;
+                cur->count = 0;
+                node = Free_node(node);
+            }
+            val_size -= res;
+            return res;
+        }
+
+        [[noreturn]] static void Logic_error() {
+            throw std::logic_error("invalid unrolled_list size");
+        }
+
+        [[noreturn]] static void Iterator_error() {
+            throw std::out_of_range("invalid unrolled_list iterator");
+        }
+    };
+
+    template <typename Ty, std::size_t Capacity, typename Allocator>
+    bool operator==(const unrolled_list<Ty, Capacity, Allocator>& left, const unrolled_list<Ty, Capacity, Allocator>& right) noexcept {
+        if (left.size() != right.size())
+            return false;
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (!(*l == *r))
+                return false;
+        return true;
+    }
+
+    template <typename Ty, std::size_t Capacity, typename Allocator>
+    bool operator!=(const unrolled_list<Ty, Capacity, Allocator>& left, const unrolled_list<Ty, Capacity, Allocator>& right) noexcept {
+        return !(left == right);
+    }
+
+    template <typename Ty, std::size_t Capacity, typename Allocator>
+    bool operator<(const unrolled_list<Ty, Capacity, Allocator>& left, const unrolled_list<Ty, Capacity, Allocator>& right) noexcept {
+        auto l = left.begin();
+        auto r = right.begin();
+        for (; l != left.end() && r != right.end(); l++, r++)
+            if (*l == *r)
+                continue;
+            else return *l < *r;
+        return left.size() < right.size();
+    }
+}
+
+#endif // !OCT_UNROLLED_LIST
\ No newline at end of file
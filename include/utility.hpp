@@ -1,195 +1,325 @@
-#pragma once
-
-#ifndef OCT_UTILITY
-#define OCT_UTILITY
-
-#include <initializer_list>
-#include <utility>
-#include "type_traits.hpp"
-
-namespace oct {
-    template <typename Ty>
-    void swap(Ty& left, Ty& right) {
-        Ty temp(left);
-        left = right;
-        right = std::move(temp);
-    }
-
-    template <typename Ty1, typename Ty2>
-    struct pair {
-        using first_type  = Ty1;
-        using second_type = Ty2;
-
-        first_type first;
-        second_type second;
-
-        template <typename Ref1, typename Ref2>
-        pair(Ref1&& target1, Ref2&& target2) 
-            : first(std::forward<Ref1>(target1)), second(std::forward<Ref2>(target2)) {}
-        
-        pair(const std::pair<Ty1, Ty2>& std_pair) 
-            : first(std_pair.first), second(std_pair.second) {}
-
-        pair()                       = default;
-        pair(const pair&)            = default;
-        pair(pair&&)                 = default;
-        pair& operator=(const pair&) = default;
-        pair& operator=(pair&&)      = default;
-    };
-
-    template <typename Ty1, typename Ty2>
-    bool operator==(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
-        return left.first == right.first && left.second == right.second;
-    }
-
-    template <typename Ty1, typename Ty2>
-    bool operator!=(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
-        return !(left.first == right.first) || !(left.second == right.second);
-    }
-
-    template <typename Ty1, typename Ty2>
-    bool operator<(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
-        return !(left.first == right.first) ? left.first < right.first : left.second < right.second;
-    }
-
-    template <typename Ty1, typename Ty2>
-    bool operator<=(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
-        return left < right || left == right;
-    }
-
-    template <typename Ty1, typename Ty2>
-    bool operator>(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
-        return !(left <= right);
-    }
-
-    template <typename Ty1, typename Ty2>
-    bool operator>=(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
-        return !(left < right);
-    }
-
-    template <typename Ty>
-    struct key_of {
-        using type = Ty;
-    };
-
-    template <typename Ty1, typename Ty2>
-    struct key_of<pair<Ty1, Ty2>> {
-        using type = Ty1;
-    };
-
-    template <typename Ty>
-    using key_of_v = typename key_of<Ty>::type;
-
-    template <typename Ty>
-    struct value_of {
-        using type = Ty;
-    };
-
-    template <typename Ty1, typename Ty2>
-    struct value_of<pair<Ty1, Ty2>> {
-        using type = Ty2;
-    };
-
-    template <typename Ty>
-    using value_of_v = typename value_of<Ty>::type;
-
-    template <typename Ty1, typename Ty2, bool = std::is_empty_v<Ty1> && !std::is_final_v<Ty1>>
-    struct compressed_pair final : public Ty1 {
-        using first_type  = Ty1;
-        using second_type = Ty2;
-
-        second_type second;
-
-        compressed_pair() = default;
-
-        template <typename First, class... Args2>
-        constexpr explicit compressed_pair(First&& args1, Args2&&... args2)
-            : Ty1(std::forward<First>(args1)), second(std::forward<Args2>(args2)...) {}
-
-        constexpr first_type& get_first() noexcept {
-            return *this;
-        }
-    };
-
-    template <typename Ty1, typename Ty2>
-    struct compressed_pair<Ty1, Ty2, false> final {
-        using first_type = Ty1;
-        using second_type = Ty2;
-
-        first_type first;
-        second_type second;
-
-        compressed_pair() = default;
-
-        template <typename First, class... Args2>
-        constexpr explicit compressed_pair(First&& args1, Args2&&... args2)
-            : first(std::forward<First>(args1)), second(std::forward<Args2>(args2)...) {}
-
-        constexpr first_type& get_first() noexcept {
-            return first;
-        }
-    };
-}
-
-#ifndef OCT_PAIR_STRUCTURED_BINDING
-#define OCT_PAIR_STRUCTURED_BINDING
-
-namespace std {
-    template<typename Ty1, typename Ty2>
-    struct tuple_size<oct::pair<Ty1, Ty2>> :
-        integral_constant<size_t, 2> {};
-
-    template<size_t Index, typename Ty1, typename Ty2>
-    struct tuple_element<Index, oct::pair<Ty1, Ty2>> {
-        using type = Ty1;
-    };
-
-    template<typename Ty1, typename Ty2>
-    struct tuple_element<1, oct::pair<Ty1, Ty2>> {
-        using type = Ty2;
-    };
-
-    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
-    constexpr Ty1& get(oct::pair<Ty1, Ty2>& p) noexcept {
-        return p.first;
-    };
-
-    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
-    constexpr Ty2& get(oct::pair<Ty1, Ty2>& p) noexcept {
-        return p.second;
-    };
-
-    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
-    constexpr const Ty1& get(const oct::pair<Ty1, Ty2>& p) noexcept {
-        return p.first;
-    };
-
-    template <size_t Idx,typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
-    constexpr const Ty2& get(const oct::pair<Ty1, Ty2>& p) noexcept {
-        return p.second;
-    };
-
-    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
-    constexpr Ty1&& get(oct::pair<Ty1, Ty2>&& p) noexcept {
-        return move(p.first);
-    };
-
-    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
-    constexpr Ty2&& get(oct::pair<Ty1, Ty2>&& p) noexcept {
-        return move(p.second);
-    };
-
-    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
-    constexpr const Ty1&& get(const oct::pair<Ty1, Ty2>&& p) noexcept {
-        return move(p.first);
-    };
-
-    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
-    constexpr const Ty2&& get(const oct::pair<Ty1, Ty2>&& p) noexcept {
-        return move(p.second);
-    };
-}
-
-#endif // !OCT_PAIR_STRUCTURED_BINDING
-
+#pragma once
+
+#ifndef OCT_UTILITY
+#define OCT_UTILITY
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include "type_traits.hpp"
+
+//软件预取: 把addr所在的缓存行提前取入缓存, 不支持的平台上为空操作
+#ifndef OCT_PREFETCH
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define OCT_PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#elif defined(__GNUC__)
+#define OCT_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define OCT_PREFETCH(addr) ((void)0)
+#endif
+#endif
+
+namespace oct {
+    template <typename Ty>
+    void swap(Ty& left, Ty& right) {
+        Ty temp(left);
+        left = right;
+        right = std::move(temp);
+    }
+
+    template <typename Ty1, typename Ty2>
+    struct pair {
+        using first_type  = Ty1;
+        using second_type = Ty2;
+
+        first_type first;
+        second_type second;
+
+        template <typename Ref1, typename Ref2>
+        pair(Ref1&& target1, Ref2&& target2) 
+            : first(std::forward<Ref1>(target1)), second(std::forward<Ref2>(target2)) {}
+        
+        pair(const std::pair<Ty1, Ty2>& std_pair) 
+            : first(std_pair.first), second(std_pair.second) {}
+
+        //两个成员分别以元组中的参数原位构造, 供容器的emplace/try_emplace使用
+        template <typename... Args1, typename... Args2>
+        pair(std::piecewise_construct_t, std::tuple<Args1...> args1, std::tuple<Args2...> args2)
+            : pair(args1, args2, std::index_sequence_for<Args1...>(), std::index_sequence_for<Args2...>()) {}
+
+        pair()                       = default;
+        pair(const pair&)            = default;
+        pair(pair&&)                 = default;
+        pair& operator=(const pair&) = default;
+        pair& operator=(pair&&)      = default;
+
+    private:
+        template <typename Tuple1, typename Tuple2, size_t... Index1, size_t... Index2>
+        pair(Tuple1& args1, Tuple2& args2, std::index_sequence<Index1...>, std::index_sequence<Index2...>)
+            : first(std::get<Index1>(std::move(args1))...), second(std::get<Index2>(std::move(args2))...) {}
+    };
+
+    //比通用swap更特化, 标准算法经ADL交换pair时不再与std::swap产生歧义
+    template <typename Ty1, typename Ty2>
+    void swap(pair<Ty1, Ty2>& left, pair<Ty1, Ty2>& right) {
+        using std::swap;
+        swap(left.first, right.first);
+        swap(left.second, right.second);
+    }
+
+    template <typename Ty1, typename Ty2>
+    bool operator==(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
+        return left.first == right.first && left.second == right.second;
+    }
+
+    template <typename Ty1, typename Ty2>
+    bool operator!=(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
+        return !(left.first == right.first) || !(left.second == right.second);
+    }
+
+    template <typename Ty1, typename Ty2>
+    bool operator<(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
+        return !(left.first == right.first) ? left.first < right.first : left.second < right.second;
+    }
+
+    template <typename Ty1, typename Ty2>
+    bool operator<=(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
+        return left < right || left == right;
+    }
+
+    template <typename Ty1, typename Ty2>
+    bool operator>(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
+        return !(left <= right);
+    }
+
+    template <typename Ty1, typename Ty2>
+    bool operator>=(const pair<Ty1, Ty2>& left, const pair<Ty1, Ty2>& right) noexcept {
+        return !(left < right);
+    }
+
+    //标记输入已按比较器严格升序排列, 容器据此跳过检查直接构造
+    struct sorted_unique_t {
+        explicit sorted_unique_t() = default;
+    };
+
+    inline constexpr sorted_unique_t sorted_unique{};
+
+    //侵入式容器经挂钩特性在元素与元素中的挂钩之间互相转换
+    //元素以基类方式继承挂钩
+    template <typename Ty, typename Hook>
+    struct intrusive_base_hook {
+        using value_type = Ty;
+        using hook_type  = Hook;
+
+        static Hook* To_hook(Ty& value) noexcept {
+            return static_cast<Hook*>(&value);
+        }
+
+        static Ty* To_value(Hook* hook) noexcept {
+            return static_cast<Ty*>(hook);
+        }
+    };
+
+    //挂钩是元素的成员, 一个元素可以借不同的成员同时位于多个容器中
+    //成员的偏移直接取自成员指针的表示: Itanium与MSVC的ABI都把无虚继承类的数据成员指针表示为成员偏移,
+    //不需要任何对象; 虚继承等表示更宽的情形编译期拒绝, 此时应改用intrusive_base_hook
+    template <typename Ty, typename Hook, Hook Ty::* Member>
+    struct intrusive_member_hook {
+        static_assert(sizeof(Member) == sizeof(std::int32_t) || sizeof(Member) == sizeof(std::int64_t),
+            "intrusive_member_hook requires a plain data member pointer, use intrusive_base_hook instead");
+
+        using value_type = Ty;
+        using hook_type  = Hook;
+
+        static Hook* To_hook(Ty& value) noexcept {
+            return &(value.*Member);
+        }
+
+        static Ty* To_value(Hook* hook) noexcept {
+            return reinterpret_cast<Ty*>(reinterpret_cast<char*>(hook) - Offset());
+        }
+
+    private:
+        //定长拷贝, 编译后即为常量
+        static std::ptrdiff_t Offset() noexcept {
+            Hook Ty::* member = Member;
+            if constexpr (sizeof(member) == sizeof(std::int32_t)) {
+                std::int32_t res;
+                std::memcpy(&res, &member, sizeof(res));
+                return res;
+            }
+            else {
+                std::int64_t res;
+                std::memcpy(&res, &member, sizeof(res));
+                return static_cast<std::ptrdiff_t>(res);
+            }
+        }
+    };
+
+    template <typename Ty>
+    struct key_of {
+        using type = Ty;
+    };
+
+    template <typename Ty1, typename Ty2>
+    struct key_of<pair<Ty1, Ty2>> {
+        using type = Ty1;
+    };
+
+    template <typename Ty>
+    using key_of_v = typename key_of<Ty>::type;
+
+    template <typename Ty>
+    struct value_of {
+        using type = Ty;
+    };
+
+    template <typename Ty1, typename Ty2>
+    struct value_of<pair<Ty1, Ty2>> {
+        using type = Ty2;
+    };
+
+    template <typename Ty>
+    using value_of_v = typename value_of<Ty>::type;
+
+    //std::hash对整数多为恒等映射, 先乘黄金分割常数再把高位折叠下来, 使低位与高位都充分混合
+    inline size_t hash_mix(size_t hash) noexcept {
+        if constexpr (sizeof(size_t) == 8) {
+            hash *= static_cast<size_t>(0x9E3779B97F4A7C15ull);
+            return hash ^ (hash >> 32);
+        }
+        else {
+            hash *= static_cast<size_t>(0x9E3779B9u);
+            return hash ^ (hash >> 16);
+        }
+    }
+
+    //无分支二分查找: 每轮区间减半, 用条件传送代替跳转, 比较结果随机时不会因分支预测失败而停顿
+    template <typename Ty, typename Key, typename Compare>
+    const Ty* branchless_lower_bound(const Ty* first, size_t len, const Key& key, Compare& comp) {
+        if (!len)
+            return first;
+        while (len > 1) {
+            size_t half = len / 2;
+            first = comp(first[half], key) ? first + half : first;
+            len -= half;
+        }
+        return first + comp(*first, key);
+    }
+
+    template <typename Ty, typename Key, typename Compare>
+    const Ty* branchless_upper_bound(const Ty* first, size_t len, const Key& key, Compare& comp) {
+        if (!len)
+            return first;
+        while (len > 1) {
+            size_t half = len / 2;
+            first = comp(key, first[half]) ? first : first + half;
+            len -= half;
+        }
+        return first + !comp(key, *first);
+    }
+
+    template <typename Ty1, typename Ty2, bool = std::is_empty_v<Ty1> && !std::is_final_v<Ty1>>
+    struct compressed_pair final : public Ty1 {
+        using first_type  = Ty1;
+        using second_type = Ty2;
+
+        second_type second;
+
+        compressed_pair() = default;
+
+        template <typename First, class... Args2>
+        constexpr explicit compressed_pair(First&& args1, Args2&&... args2)
+            : Ty1(std::forward<First>(args1)), second(std::forward<Args2>(args2)...) {}
+
+        constexpr first_type& get_first() noexcept {
+            return *this;
+        }
+    };
+
+    template <typename Ty1, typename Ty2>
+    struct compressed_pair<Ty1, Ty2, false> final {
+        using first_type = Ty1;
+        using second_type = Ty2;
+
+        first_type first;
+        second_type second;
+
+        compressed_pair() = default;
+
+        template <typename First, class... Args2>
+        constexpr explicit compressed_pair(First&& args1, Args2&&... args2)
+            : first(std::forward<First>(args1)), second(std::forward<Args2>(args2)...) {}
+
+        constexpr first_type& get_first() noexcept {
+            return first;
+        }
+    };
+}
+
+#ifndef OCT_PAIR_STRUCTURED_BINDING
+#define OCT_PAIR_STRUCTURED_BINDING
+
+namespace std {
+    template<typename Ty1, typename Ty2>
+    struct tuple_size<oct::pair<Ty1, Ty2>> :
+        integral_constant<size_t, 2> {};
+
+    template<size_t Index, typename Ty1, typename Ty2>
+    struct tuple_element<Index, oct::pair<Ty1, Ty2>> {
+        using type = Ty1;
+    };
+
+    template<typename Ty1, typename Ty2>
+    struct tuple_element<1, oct::pair<Ty1, Ty2>> {
+        using type = Ty2;
+    };
+
+    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
+    constexpr Ty1& get(oct::pair<Ty1, Ty2>& p) noexcept {
+        return p.first;
+    };
+
+    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
+    constexpr Ty2& get(oct::pair<Ty1, Ty2>& p) noexcept {
+        return p.second;
+    };
+
+    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
+    constexpr const Ty1& get(const oct::pair<Ty1, Ty2>& p) noexcept {
+        return p.first;
+    };
+
+    template <size_t Idx,typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
+    constexpr const Ty2& get(const oct::pair<Ty1, Ty2>& p) noexcept {
+        return p.second;
+    };
+
+    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
+    constexpr Ty1&& get(oct::pair<Ty1, Ty2>&& p) noexcept {
+        return forward<Ty1>(p.first);
+    };
+
+    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
+    constexpr Ty2&& get(oct::pair<Ty1, Ty2>&& p) noexcept {
+        return forward<Ty2>(p.second);
+    };
+
+    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<!Idx, int> = 0>
+    constexpr const Ty1&& get(const oct::pair<Ty1, Ty2>&& p) noexcept {
+        return static_cast<const Ty1&&>(p.first);
+    };
+
+    template <size_t Idx, typename Ty1, typename Ty2, enable_if_t<Idx, int> = 0>
+    constexpr const Ty2&& get(const oct::pair<Ty1, Ty2>&& p) noexcept {
+        return static_cast<const Ty2&&>(p.second);
+    };
+}
+
+#endif // !OCT_PAIR_STRUCTURED_BINDING
+
 #endif // !OCT_UTILITY
\ No newline at end of file
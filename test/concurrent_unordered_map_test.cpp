@@ -0,0 +1,149 @@
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <shared_mutex>
+#include <vector>
+#include "map.hpp"
+#include "concurrent_unordered_map.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+//读写比例为read_percent的混合负载, threads个线程共执行ops次操作, 返回毫秒数; 命中数累加到hits以免读操作被优化掉
+template <typename Read, typename Write>
+double run_mix(size_t threads, size_t ops, size_t keys, unsigned read_percent, Read read, Write write) {
+    std::vector<std::thread> pool;
+    std::atomic<size_t> hits{ 0 };
+    auto tick1 = steady_clock::now();
+    for (size_t t = 0; t < threads; t++)
+        pool.emplace_back([=, &read, &write, &hits]() {
+            std::mt19937 mt(static_cast<unsigned>(t + 1));
+            size_t hit = 0;
+            for (size_t i = 0; i < ops / threads; i++) {
+                int key = static_cast<int>(mt() % keys);
+                if (mt() % 100 < read_percent)
+                    hit += read(key);
+                else
+                    write(key, static_cast<int>(i));
+            }
+            hits += hit;
+        });
+    for (auto& th : pool)
+        th.join();
+    auto tick2 = steady_clock::now();
+    return duration<double, std::milli>(tick2 - tick1).count();
+}
+
+int concurrent_unordered_map_test()
+{
+    std::cout << "concurrent_unordered_map_test{" << std::endl;
+
+    std::cout << "----------------test1：基本操作-------------------" << std::endl;
+    concurrent_unordered_map<int, int> a{ {1, 1}, {2, 4}, {3, 9} };
+    int out = 0;
+    std::cout << "size:" << a.size() << " find(2):" << a.find(2, out) << ' ' << out << std::endl;
+    std::cout << "insert(2, 0):" << a.insert(2, 0) << " insert_or_assign(2, -4):" << a.insert_or_assign(2, -4);
+    a.find(2, out);
+    std::cout << " find(2):" << out << std::endl;
+    std::cout << "erase(1):" << a.erase(1) << " contains(1):" << a.contains(1) << " size:" << a.size() << std::endl;
+    a.visit(3, [](const pair<int, int>& elem) { std::cout << "visit(3):" << elem.second << std::endl; });
+    a.clear();
+    std::cout << "clear后empty:" << a.empty() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------------test2：多线程读写-----------------" << std::endl;
+    concurrent_unordered_map<int, int> b;
+    const int per_thread = 100000;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 8; t++)
+        writers.emplace_back([&b, t]() {
+            for (int i = 0; i < per_thread; i++)
+                b.insert_or_assign(t * per_thread + i, i);
+            for (int i = 0; i < per_thread; i += 2)
+                b.erase(t * per_thread + i);
+        });
+    for (auto& th : writers)
+        th.join();
+    size_t bad = 0;
+    for (int t = 0; t < 8; t++)
+        for (int i = 0; i < per_thread; i++)
+            bad += b.find(t * per_thread + i, out) != (i % 2 == 1) || (i % 2 == 1 && out != i);
+    std::cout << "size:" << b.size() << " 结果正确:" << (b.size() == 8 * per_thread / 2 && !bad) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------test3：扩展性 比较oct::map + shared_mutex------" << std::endl;
+    const size_t keys = 1000000;
+    const size_t ops = 8000000;
+    std::cout << "关键字数:" << keys << " 每组操作数:" << ops << std::endl;
+    concurrent_unordered_map<int, int> octCHM(keys);
+    map<int, int> octMAP;
+    std::shared_mutex map_lock;
+    for (size_t i = 0; i < keys; i += 2) {
+        octCHM.insert(static_cast<int>(i), static_cast<int>(i));
+        octMAP[static_cast<int>(i)] = static_cast<int>(i);
+    }
+    for (unsigned read_percent : { 100u, 90u, 50u }) {
+        std::cout << std::endl << "读" << read_percent << "% 写" << 100 - read_percent << "%:(ms)" << std::endl;
+        for (size_t threads = 1; threads <= 64; threads *= 2) {
+            double chm = run_mix(threads, ops, keys, read_percent,
+                [&](int key) { int val; return octCHM.find(key, val); },
+                [&](int key, int val) { if (val & 1) octCHM.erase(key); else octCHM.insert_or_assign(key, val); });
+            double locked = run_mix(threads, ops, keys, read_percent,
+                [&](int key) { std::shared_lock<std::shared_mutex> lock(map_lock); return octMAP.find(key) != octMAP.end(); },
+                [&](int key, int val) {
+                    std::unique_lock<std::shared_mutex> lock(map_lock);
+                    if (val & 1) octMAP.erase(key); else octMAP[key] = val;
+                });
+            std::cout << "threads:" << threads << " concurrent_unordered_map:" << chm << " map+shared_mutex:" << locked << std::endl;
+        }
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test4：扩容期间的读与遍历--------------" << std::endl;
+    concurrent_unordered_map<int, int> c(0, 4);
+    const int stable = 20000, grow = 400000;
+    for (int i = 0; i < stable; i++)
+        c.insert(i, i);
+    std::atomic<bool> done{ false };
+    std::atomic<size_t> missed{ 0 }, torn{ 0 };
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; t++)
+        pool.emplace_back([&c, &done, &missed, stable, t]() {
+            std::mt19937 mt(static_cast<unsigned>(t + 1));
+            int val = 0;
+            while (!done.load(std::memory_order_relaxed))
+                for (int i = 0; i < 1000; i++) {
+                    int key = static_cast<int>(mt() % stable);
+                    missed += !c.find(key, val) || val != key;
+                }
+        });
+    pool.emplace_back([&c, &done, &torn, stable]() {
+        while (!done.load(std::memory_order_relaxed)) {
+            std::vector<char> seen(stable, 0);
+            size_t dup = 0, old = 0;
+            c.for_each([&](const pair<int, int>& elem) {
+                if (elem.first < stable) {
+                    dup += seen[elem.first]++;
+                    old++;
+                }
+            });
+            torn += dup || old != static_cast<size_t>(stable);
+        }
+    });
+    for (int t = 0; t < 2; t++)
+        pool.emplace_back([&c, t, stable, grow]() {
+            for (int i = stable + t; i < stable + grow; i += 2)
+                c.insert(i, i);
+        });
+    pool[pool.size() - 1].join();
+    pool[pool.size() - 2].join();
+    done.store(true);
+    for (size_t i = 0; i + 2 < pool.size(); i++)
+        pool[i].join();
+    std::cout << "size:" << c.size() << " 读者未命中:" << missed << " 遍历遗漏或重复:" << torn << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "}" << std::endl << std::endl;
+
+    return 0;
+}
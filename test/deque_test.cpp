@@ -60,6 +60,8 @@ int deque_test()
         a.pop_back(); 
         print(a, 'a');
     }
+    a.emplace_front(-1);
+    a.emplace_back(25);                                 print(a, 'a');
     /*
     a.insert(a.begin() + 1, 7); print(a, 'a');
     int xx[3] = { 10,11,12 };
@@ -0,0 +1,165 @@
+#include <iostream>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <chrono>
+#include <vector>
+#include "map.hpp"
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+template<typename Container>
+void print(Container& container, const char ch = 0) {
+    if (ch)std::cout << ch << ": ";
+    if (container.empty())std::cout << "EMPTY";
+    else for (auto it = container.begin(); it != container.end(); ++it)
+        std::cout << '[' << it->first << ", " << it->second << "] ";
+    std::cout << '\n';
+}
+
+template<typename Container>
+void print_set(Container& container, const char ch = 0) {
+    if (ch)std::cout << ch << ": ";
+    if (container.empty())std::cout << "EMPTY";
+    else for (const auto& key : container)
+        std::cout << key << ' ';
+    std::cout << '\n';
+}
+
+int flat_map_test()
+{
+    std::cout << "flat_map_test{" << std::endl;
+
+    std::cout << "----------------test1：构造函数-------------------" << std::endl;
+    flat_map<int, int>a;                                print(a, 'a');
+    pair<std::string, int> x[7] = { {"one", 1}, {"eight", 8}, {"three", 3}, {"four", 4}, {"seven", 7}, {"one", 0}, {"nine", 9} };
+    flat_map<std::string, int>b(x, x + 7);              print(b, 'b');
+    flat_map<std::string, int>c(b);                     print(c, 'c');
+    flat_map<std::string, int>d(std::move(c));          print(d, 'd');
+    pair<int, int> y[5] = { {1, 1}, {2, 4}, {3, 9}, {4, 16}, {5, 25} };
+    flat_map<int, int>e(sorted_unique, y, y + 5);       print(e, 'e');
+    vector<int> ks{ 1, 3, 5 }, vs{ 10, 30, 50 };
+    flat_map<int, int>f(sorted_unique, std::move(ks), std::move(vs));
+    print(f, 'f');
+    std::cout << "e.size():" << e.size() << " e.capacity():" << e.capacity() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------------test2:元素添加/删除----------------" << std::endl;
+    a.insert({ 3, 9 });
+    a.insert({ { 1, 1 }, { 5, 25 }, { 2, 4 }, { 4, 16 }, { 3, 0 } });
+    print(a, 'a');
+    a.insert({ { 5, -25 }, { 8, 64 }, { 0, 1 }, { 8, 0 } });
+    print(a, 'a');
+    a.erase(8);
+    a[0] = 0;
+    a[6] = 36;                                          print(a, 'a');
+    std::cout << "try_emplace(6, -1):" << a.try_emplace(6, -1).second << " insert_or_assign(6, -36):"
+        << a.insert_or_assign(6, -36).second << std::endl;
+    a.emplace_hint(a.end(), 7, 49);
+    a.insert(a.begin(), { -1, 1 });                     print(a, 'a');
+    for (int i : {6, 1, -1, 0}) {
+        a.erase(i);
+        print(a, 'a');
+    }
+    a.erase(a.begin(), a.begin() + 2);                  print(a, 'a');
+    a.shrink_to_fit();
+    std::cout << "shrink_to_fit后size:" << a.size() << " capacity:" << a.capacity() << std::endl;
+    flat_map<int, std::string> self{ { 0, "value of key 0" } };
+    for (int i = 1; i <= 40; i++) {                     //值取自本容器中的元素, 插入时会扩容或后移
+        self.try_emplace(i, self.at(i - 1));
+        self.insert_or_assign(-i, self.at(0));
+    }
+    size_t same = 0;
+    for (const auto& [key, value] : self)
+        same += value == "value of key 0";
+    std::cout << "以本容器中的值插入, size:" << self.size() << " 值正确:" << (same == self.size()) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------------test3:元素查找------------------" << std::endl;
+    std::cout << "e.count(2):" << e.count(2) << " e.at(3):" << e.at(3) << " e.find(6)==end:" << (e.find(6) == e.end()) << std::endl;
+    for (auto it = e.lower_bound(2); it != e.upper_bound(4); it++) {
+        auto [k, v] = *it;
+        std::cout << "[" << k << ", " << v << "]";
+    }
+    std::cout << std::endl;
+    auto [lower, upper] = e.equal_range(3);
+    std::cout << lower->second << ' ' << upper->second << std::endl;
+    try {
+        e.at(10);
+    }
+    catch (const std::out_of_range& err) {
+        std::cout << "e.at(10):" << err.what() << std::endl;
+    }
+    const flat_map<int, int>& ce = e;
+    e.at(3) = 90;
+    std::cout << "e.at(3) = 90后ce.at(3):" << ce.at(3) << std::endl;
+    flat_map<std::string, int, less<>> g(b.begin(), b.end());
+    std::cout << "透明比较器g.find(\"nine\"):" << g.find("nine")->second << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------------------test4:flat_set---------------------" << std::endl;
+    flat_set<int> s{ 5, 3, 8, 1, 3, 9, 1 };             print_set(s, 's');
+    s.insert(4);
+    s.emplace(7);
+    s.insert(s.end(), 10);                              print_set(s, 's');
+    s.erase(8);
+    s.erase(s.begin());                                 print_set(s, 's');
+    std::cout << "s.count(4):" << s.count(4) << " *s.lower_bound(6):" << *s.lower_bound(6)
+        << " *s.upper_bound(7):" << *s.upper_bound(7) << std::endl;
+    int z[4] = { 2, 4, 6, 8 };
+    flat_set<int> t(sorted_unique, z, z + 4);           print_set(t, 't');
+    std::cout << "s < t:" << (s < t) << std::endl;
+    flat_map<int, int, greater<int>> h{ { 1, 1 }, { 3, 3 } }, i{ { 2, 2 }, { 3, 3 } };
+    std::cout << "greater<int>下h < i:" << (h < i) << " i < h:" << (i < h) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-----------test5：比较oct::map/std::lower_bound查找-----------" << std::endl;
+    const size_t M = 1e6, OPS = 1e7;
+    std::cout << "数据量：" << M << " 查找数：" << OPS << std::endl;
+    std::mt19937 mt;
+    std::vector<int> keys(M);
+    for (size_t i = 0; i < M; i++)
+        keys[i] = static_cast<int>(mt());
+    std::vector<int> queries(OPS);
+    for (size_t i = 0; i < OPS; i++)
+        queries[i] = mt() & 1 ? keys[mt() % M] : static_cast<int>(mt());
+
+    std::vector<pair<int, int>> items(M);
+    for (size_t i = 0; i < M; i++)
+        items[i] = pair<int, int>(keys[i], static_cast<int>(i));
+    auto tick1 = steady_clock::now();
+    flat_map<int, int> octFLAT(items.begin(), items.end());
+    auto tick2 = steady_clock::now();
+    std::cout << "flat_map整批构造:(ms)" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    map<int, int> octMAP;
+    for (size_t i = 0; i < M; i++)
+        octMAP[keys[i]] = static_cast<int>(i);
+    std::vector<int> sorted(octFLAT.keys().begin(), octFLAT.keys().end());
+
+    size_t hit = 0;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < OPS; i++)
+        hit += octFLAT.find(queries[i]) != octFLAT.end();
+    tick2 = steady_clock::now();
+    std::cout << "flat_map:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < OPS; i++)
+        hit += octMAP.find(queries[i]) != octMAP.end();
+    tick2 = steady_clock::now();
+    std::cout << "map:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < OPS; i++) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), queries[i]);
+        hit += it != sorted.end() && *it == queries[i];
+    }
+    tick2 = steady_clock::now();
+    std::cout << "std::lower_bound:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "命中数:" << hit / 3 << std::endl;
+    std::cout << "flat_map每元素字节数:" << double(octFLAT.capacity() * (sizeof(int) * 2)) / octFLAT.size() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "}" << std::endl << std::endl;
+
+    return 0;
+}
@@ -3,6 +3,8 @@
 #include <numeric>
 #include <forward_list>
 #include <chrono>
+#include <random>
+#include <vector>
 #include "forward_list.hpp"
 using namespace oct;
 using namespace std::chrono;
@@ -15,6 +17,25 @@ void print(Container& container, const char ch = 0) {
         std::cout << elem << ' ';
     std::cout << '\n';
 }
+
+//跨容器的splice_after/merge/extract_after是否可用; 启用节点池时这些重载被移除
+template <typename List, typename = void>
+struct can_splice : std::false_type {};
+
+template <typename List>
+struct can_splice<List, std::void_t<decltype(std::declval<List&>().splice_after(std::declval<List&>().begin(), std::declval<List&>(), std::declval<List&>().before_begin(), std::declval<List&>().end()))>> : std::true_type {};
+
+template <typename List, typename = void>
+struct can_merge : std::false_type {};
+
+template <typename List>
+struct can_merge<List, std::void_t<decltype(std::declval<List&>().merge(std::declval<List&>()))>> : std::true_type {};
+
+template <typename List, typename = void>
+struct can_extract : std::false_type {};
+
+template <typename List>
+struct can_extract<List, std::void_t<decltype(std::declval<List&>().extract_after(std::declval<List&>().begin()))>> : std::true_type {};
 int forward_list_test()
 {
     std::cout << "forward_list_test{" << std::endl;
@@ -72,6 +93,11 @@ int forward_list_test()
     A.reverse();                                        print(A, 'A');
     A.remove_if([](int elem) {return elem > 8; });      print(A, 'A');
     A.sort();                                           print(A, 'A');
+    auto node = A.extract_after(A.before_begin());
+    node.value() = 100;
+    C.insert_after(C.before_begin(), std::move(node));  print(A, 'A'); print(C, 'C');
+    C.emplace_after(C.begin(), 101);
+    C.emplace_front(99);                                print(C, 'C');
     std::cout << "--------------------------------------------------" << std::endl;
 
     std::cout << "-----------test7：比较std::forward_list-----------" << std::endl;
@@ -115,6 +141,102 @@ int forward_list_test()
     std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() <<  std::endl;
     std::cout << "--------------------------------------------------" << std::endl;
 
+    std::cout << "-------------test8：比较std::forward_list::sort-------------" << std::endl;
+    const size_t SORT_N = 5e6;
+    std::cout << "数据量：" << SORT_N << "(ms)" << std::endl;
+    std::mt19937 mt;
+    std::vector<int> values(SORT_N);
+    for (size_t i = 0; i < SORT_N; i++)
+        values[i] = static_cast<int>(mt());
+    std::vector<int> nearly(values);                    //基本有序: 排好序后随机交换1%的元素
+    std::sort(nearly.begin(), nearly.end());
+    for (size_t i = 0; i < SORT_N / 100; i++)
+        std::swap(nearly[mt() % SORT_N], nearly[mt() % SORT_N]);
+    for (int round = 0; round < 2; round++) {
+        const std::vector<int>& source = round ? values : nearly;
+        std::cout << (round ? "随机:" : "基本有序:") << std::endl;
+        oct::forward_list<int> octSORT(source.begin(), source.end());
+        std::forward_list<int> stdSORT(source.begin(), source.end());
+        tick1 = steady_clock::now();
+        octSORT.sort();
+        tick2 = steady_clock::now();
+        tick3 = steady_clock::now();
+        stdSORT.sort();
+        tick4 = steady_clock::now();
+        std::cout << "oct:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+        std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+        std::cout << "结果一致:" << std::equal(octSORT.begin(), octSORT.end(), stdSORT.begin()) << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------test9：节点池(栈式成批增删/清空)---------" << std::endl;
+    const size_t CHURN_N = 2e7, BATCH = 1e4;
+    std::cout << "操作数：" << CHURN_N << " 每批：" << BATCH << "(ms)" << std::endl;
+    {
+        //先建好一批节点再缩回, 排除首次申请内存(及前面测试遗留的堆整理)的开销
+        oct::forward_list<int> octCHURN(BATCH, 0);
+        oct::forward_list<int, allocator<int>, 64> poolCHURN(BATCH, 0);
+        std::forward_list<int> stdCHURN(BATCH, 0);
+        octCHURN.resize(1);
+        poolCHURN.resize(1);
+        stdCHURN.resize(1);
+        tick1 = steady_clock::now();
+        for (size_t i = 0; i < CHURN_N; i += BATCH) {
+            for (size_t j = 0; j < BATCH; j++)
+                octCHURN.push_front(static_cast<int>(j));
+            for (size_t j = 1; j < BATCH; j++)
+                octCHURN.pop_front();
+        }
+        tick2 = steady_clock::now();
+        for (size_t i = 0; i < CHURN_N; i += BATCH) {
+            for (size_t j = 0; j < BATCH; j++)
+                poolCHURN.push_front(static_cast<int>(j));
+            for (size_t j = 1; j < BATCH; j++)
+                poolCHURN.pop_front();
+        }
+        tick3 = steady_clock::now();
+        for (size_t i = 0; i < CHURN_N; i += BATCH) {
+            for (size_t j = 0; j < BATCH; j++)
+                stdCHURN.push_front(static_cast<int>(j));
+            for (size_t j = 1; j < BATCH; j++)
+                stdCHURN.pop_front();
+        }
+        tick4 = steady_clock::now();
+        std::cout << "oct:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+        std::cout << "oct(节点池):" << duration<double, std::milli>(tick3 - tick2).count() << std::endl;
+        std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+        std::cout << "结果一致:" << std::equal(poolCHURN.begin(), poolCHURN.end(), stdCHURN.begin()) << std::endl;
+        tick1 = steady_clock::now();
+        octCHURN.clear();
+        tick2 = steady_clock::now();
+        poolCHURN.clear();
+        tick3 = steady_clock::now();
+        stdCHURN.clear();
+        tick4 = steady_clock::now();
+        std::cout << "clear oct:" << duration<double, std::milli>(tick2 - tick1).count()
+            << " oct(节点池):" << duration<double, std::milli>(tick3 - tick2).count()
+            << " std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------test10：节点池链表内splice_after/跨容器操作------" << std::endl;
+    {
+        oct::forward_list<int, allocator<int>, 8> p{ 1, 2, 3, 4, 5, 6 };
+        auto it = std::next(p.begin(), 2);
+        auto last = std::next(it, 3);
+        p.splice_after(p.before_begin(), it, p.end());  print(p, 'p');
+        std::cout << "splice_after后原迭代器仍指向:" << *last << std::endl;
+        p.splice_after(std::next(p.begin(), 5), p.before_begin(), std::next(p.begin(), 3));
+        print(p, 'p');
+        p.sort();                                       print(p, 'p');
+        using pooled = oct::forward_list<int, allocator<int>, 8>;
+        std::cout << "节点池链表跨容器 splice_after:" << can_splice<pooled>::value << " merge:" << can_merge<pooled>::value
+            << " extract_after:" << can_extract<pooled>::value << std::endl;
+        std::cout << "普通链表跨容器 splice_after:" << can_splice<forward_list<int>>::value << " merge:" << can_merge<forward_list<int>>::value
+            << " extract_after:" << can_extract<forward_list<int>>::value << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
     std::cout << "}" << std::endl << std::endl;
 
     return 0;
@@ -0,0 +1,142 @@
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "list.hpp"
+#include "set.hpp"
+#include "intrusive_list.hpp"
+#include "intrusive_rbtree.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+//同时位于按到期时间排序的树与空闲链表中的定时器
+struct timer : public intrusive_rbtree_hook, public intrusive_list_hook {
+    long long expire = 0;
+    int id = 0;
+    intrusive_list_hook lru;                            //再以成员挂钩加入第三个容器
+
+    bool operator<(const timer& another) const {
+        return expire < another.expire;
+    }
+};
+
+template<typename Container>
+void print(Container& container, const char ch = 0) {
+    if (ch)std::cout << ch << ':';
+    if (container.empty())std::cout << "EMPTY";
+    else for (const auto& elem : container)
+        std::cout << elem.id << '(' << elem.expire << ") ";
+    std::cout << '\n';
+}
+
+int intrusive_test()
+{
+    std::cout << "intrusive_test{" << std::endl;
+
+    std::vector<timer> timers(8);
+    for (int i = 0; i < 8; i++) {
+        timers[i].id = i;
+        timers[i].expire = (i * 5) % 8;
+    }
+
+    std::cout << "--------------test1：intrusive_list---------------" << std::endl;
+    intrusive_list<timer> a;
+    for (timer& t : timers)
+        a.push_back(t);                                 print(a, 'a');
+    a.erase(a.iterator_to(timers[3]));                  print(a, 'a');
+    std::cout << "timers[3].is_linked():" << static_cast<intrusive_list_hook&>(timers[3]).is_linked() << std::endl;
+    intrusive_list<timer> b;
+    b.splice(b.end(), a, a.iterator_to(timers[5]));
+    b.push_front(timers[3]);                            print(a, 'a'); print(b, 'b');
+    a.reverse();                                        print(a, 'a');
+    a.remove_if([](const timer& t) { return t.id & 1; }); print(a, 'a');
+    intrusive_list<timer, intrusive_member_hook<timer, intrusive_list_hook, &timer::lru>> c;
+    c.push_back(timers[2]); c.push_back(timers[7]);     print(c, 'c');
+    std::cout << "成员挂钩还原出的元素地址正确:" << (&c.front() == &timers[2] && &c.back() == &timers[7]) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test2：intrusive_rbtree--------------" << std::endl;
+    intrusive_rbtree<timer> d;
+    for (timer& t : timers)
+        d.insert(t);                                    print(d, 'd');
+    std::cout << "front:" << d.front().id << " back:" << d.back().id << std::endl;
+    d.erase(timers[0]);                                 print(d, 'd');
+    d.pop_front();                                      print(d, 'd');
+    timer probe;
+    probe.expire = 4;
+    std::cout << "count(4):" << d.count(probe) << " lower_bound(4):" << d.lower_bound(probe)->id << std::endl;
+    std::cout << "insert_unique(4):" << d.insert_unique(probe).second << std::endl;
+    std::cout << "timers[2]同时链接于a/d:" << static_cast<intrusive_list_hook&>(timers[2]).is_linked()
+        << static_cast<intrusive_rbtree_hook&>(timers[2]).is_linked() << std::endl;
+    d.clear();
+    std::cout << "clear后timers[2]仍在树中:" << static_cast<intrusive_rbtree_hook&>(timers[2]).is_linked() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------test3：比较基于分配的容器(定时器增删)-------" << std::endl;
+    const size_t N = 1e6;
+    std::cout << "数据量：" << N << "(ms)" << std::endl;
+    std::mt19937 mt;
+    std::vector<timer> pool(N);
+    std::vector<size_t> order(N);
+    for (size_t i = 0; i < N; i++) {
+        pool[i].id = static_cast<int>(i);
+        pool[i].expire = mt();
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), mt);
+
+    intrusive_rbtree<timer> tree;
+    auto tick1 = steady_clock::now();
+    for (timer& t : pool)
+        tree.insert(t);
+    for (size_t i : order)
+        tree.erase(pool[i]);
+    auto tick2 = steady_clock::now();
+    std::cout << "intrusive_rbtree:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+
+    //到期时间与编号合成一个键, N < 2^20
+    set<long long> octSET;
+    std::vector<set<long long>::iterator> handles(N);
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        handles[i] = octSET.insert(pool[i].expire << 20 | pool[i].id).first;
+    for (size_t i : order)
+        octSET.erase(handles[i]);
+    tick2 = steady_clock::now();
+    std::cout << "oct::set:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+
+    std::set<long long> stdSET;
+    std::vector<std::set<long long>::iterator> std_handles(N);
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        std_handles[i] = stdSET.insert(pool[i].expire << 20 | pool[i].id).first;
+    for (size_t i : order)
+        stdSET.erase(std_handles[i]);
+    tick2 = steady_clock::now();
+    std::cout << "std::set:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+
+    intrusive_list<timer> lst;
+    tick1 = steady_clock::now();
+    for (timer& t : pool)
+        lst.push_back(t);
+    for (size_t i : order)
+        lst.erase(lst.iterator_to(pool[i]));
+    tick2 = steady_clock::now();
+    std::cout << "intrusive_list:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+
+    list<int> octLIST;
+    std::vector<list<int>::iterator> list_handles(N);
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        list_handles[i] = octLIST.insert(octLIST.end(), pool[i].id);
+    for (size_t i : order)
+        octLIST.erase(list_handles[i]);
+    tick2 = steady_clock::now();
+    std::cout << "oct::list:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "}" << std::endl << std::endl;
+
+    return 0;
+}
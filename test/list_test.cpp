@@ -3,6 +3,8 @@
 #include <numeric>
 #include <list>
 #include <chrono>
+#include <random>
+#include <vector>
 #include "list.hpp"
 using namespace oct;
 using namespace std::chrono;
@@ -15,6 +17,25 @@ void print(Container& container, const char ch = 0) {
         std::cout << elem << ' ';
     std::cout << '\n';
 }
+
+//跨容器的splice/merge/extract是否可用; 启用节点池时这些重载被移除
+template <typename List, typename = void>
+struct can_splice : std::false_type {};
+
+template <typename List>
+struct can_splice<List, std::void_t<decltype(std::declval<List&>().splice(std::declval<List&>().begin(), std::declval<List&>(), std::declval<List&>().begin(), std::declval<List&>().end()))>> : std::true_type {};
+
+template <typename List, typename = void>
+struct can_merge : std::false_type {};
+
+template <typename List>
+struct can_merge<List, std::void_t<decltype(std::declval<List&>().merge(std::declval<List&>()))>> : std::true_type {};
+
+template <typename List, typename = void>
+struct can_extract : std::false_type {};
+
+template <typename List>
+struct can_extract<List, std::void_t<decltype(std::declval<List&>().extract(std::declval<List&>().begin()))>> : std::true_type {};
 int list_test()
 {
     std::cout << "list_test{" << std::endl;
@@ -73,6 +94,11 @@ int list_test()
     A.reverse();                                        print(A, 'A');
     A.remove_if([](int elem) {return elem > 8; });      print(A, 'A');
     A.sort();                                           print(A, 'A');
+    auto node = A.extract(A.begin());
+    node.value() = 100;
+    C.insert(C.end(), std::move(node));                 print(A, 'A'); print(C, 'C');
+    C.emplace(C.begin(), 42);
+    C.emplace_front(41); C.emplace_back(101);           print(C, 'C');
     std::cout << "--------------------------------------------------" << std::endl;
 
     std::cout << "------------------test7：比较std::list------------" << std::endl;
@@ -125,6 +151,91 @@ int list_test()
     std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
     std::cout << "--------------------------------------------------" << std::endl;
 
+    std::cout << "-------------test8：比较std::list::sort-------------" << std::endl;
+    const size_t SORT_N = 5e6;
+    std::cout << "数据量：" << SORT_N << "(ms)" << std::endl;
+    std::mt19937 mt;
+    std::vector<int> values(SORT_N);
+    for (size_t i = 0; i < SORT_N; i++)
+        values[i] = static_cast<int>(mt());
+    std::vector<int> nearly(values);                    //基本有序: 排好序后随机交换1%的元素
+    std::sort(nearly.begin(), nearly.end());
+    for (size_t i = 0; i < SORT_N / 100; i++)
+        std::swap(nearly[mt() % SORT_N], nearly[mt() % SORT_N]);
+    for (int round = 0; round < 2; round++) {
+        const std::vector<int>& source = round ? values : nearly;
+        std::cout << (round ? "随机:" : "基本有序:") << std::endl;
+        oct::list<int> octSORT(source.begin(), source.end());
+        std::list<int> stdSORT(source.begin(), source.end());
+        tick1 = steady_clock::now();
+        octSORT.sort();
+        tick2 = steady_clock::now();
+        tick3 = steady_clock::now();
+        stdSORT.sort();
+        tick4 = steady_clock::now();
+        std::cout << "oct:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+        std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+        std::cout << "结果一致:" << std::equal(octSORT.begin(), octSORT.end(), stdSORT.begin()) << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------test9：节点池(队列式增删/清空)-----------" << std::endl;
+    const size_t CHURN_N = 2e7, WINDOW = 1e5;
+    std::cout << "操作数：" << CHURN_N << " 窗口：" << WINDOW << "(ms)" << std::endl;
+    {
+        oct::list<int> octCHURN(WINDOW, 0);
+        oct::list<int, allocator<int>, 64> poolCHURN(WINDOW, 0);
+        std::list<int> stdCHURN(WINDOW, 0);
+        tick1 = steady_clock::now();
+        for (size_t i = 0; i < CHURN_N; i++) {
+            octCHURN.push_back(static_cast<int>(i));
+            octCHURN.pop_front();
+        }
+        tick2 = steady_clock::now();
+        for (size_t i = 0; i < CHURN_N; i++) {
+            poolCHURN.push_back(static_cast<int>(i));
+            poolCHURN.pop_front();
+        }
+        tick3 = steady_clock::now();
+        for (size_t i = 0; i < CHURN_N; i++) {
+            stdCHURN.push_back(static_cast<int>(i));
+            stdCHURN.pop_front();
+        }
+        tick4 = steady_clock::now();
+        std::cout << "oct:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+        std::cout << "oct(节点池):" << duration<double, std::milli>(tick3 - tick2).count() << std::endl;
+        std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+        std::cout << "结果一致:" << std::equal(poolCHURN.begin(), poolCHURN.end(), stdCHURN.begin()) << std::endl;
+        tick1 = steady_clock::now();
+        octCHURN.clear();
+        tick2 = steady_clock::now();
+        poolCHURN.clear();
+        tick3 = steady_clock::now();
+        stdCHURN.clear();
+        tick4 = steady_clock::now();
+        std::cout << "clear oct:" << duration<double, std::milli>(tick2 - tick1).count()
+            << " oct(节点池):" << duration<double, std::milli>(tick3 - tick2).count()
+            << " std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------test10：节点池链表内splice/跨容器操作---------" << std::endl;
+    {
+        oct::list<int, allocator<int>, 8> p{ 1, 2, 3, 4, 5, 6 };
+        auto it = std::next(p.begin(), 3);
+        p.splice(p.begin(), it, p.end());              print(p, 'p');
+        std::cout << "splice后原迭代器仍指向:" << *it << std::endl;
+        p.splice(p.end(), p.begin(), std::next(p.begin(), 3));
+        print(p, 'p');
+        p.sort();                                       print(p, 'p');
+        using pooled = oct::list<int, allocator<int>, 8>;
+        std::cout << "节点池链表跨容器 splice:" << can_splice<pooled>::value << " merge:" << can_merge<pooled>::value
+            << " extract:" << can_extract<pooled>::value << std::endl;
+        std::cout << "普通链表跨容器 splice:" << can_splice<list<int>>::value << " merge:" << can_merge<list<int>>::value
+            << " extract:" << can_extract<list<int>>::value << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
     std::cout << "}" << std::endl << std::endl;
 
     return 0;
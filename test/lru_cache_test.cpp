@@ -0,0 +1,165 @@
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include "lru_cache.hpp"
+#include "concurrent_lru_cache.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+//对照组: std::list保存访问顺序, std::unordered_map保存指向链表节点的迭代器, 每个元素两次分配
+template <typename Key, typename Ty>
+class std_lru_cache {
+private:
+    using List = std::list<std::pair<Key, Ty>>;
+
+    List order;
+    std::unordered_map<Key, typename List::iterator> index;
+    size_t cap;
+
+public:
+    explicit std_lru_cache(size_t capacity) : cap(capacity) {}
+
+    Ty* get(const Key& key) {
+        auto it = index.find(key);
+        if (it == index.end())
+            return nullptr;
+        order.splice(order.begin(), order, it->second);
+        return &it->second->second;
+    }
+
+    void put(const Key& key, const Ty& value) {
+        auto it = index.find(key);
+        if (it != index.end()) {
+            it->second->second = value;
+            order.splice(order.begin(), order, it->second);
+            return;
+        }
+        order.emplace_front(key, value);
+        index.emplace(key, order.begin());
+        if (order.size() > cap) {
+            index.erase(order.back().first);
+            order.pop_back();
+        }
+    }
+};
+
+//热点集合上的偏斜访问, 每隔一段混入一次只访问一遍的顺序扫描
+std::vector<int> scan_polluted_trace(size_t length, int hot_keys, int scan_length) {
+    std::mt19937 mt(42);
+    std::vector<int> trace;
+    trace.reserve(length);
+    int scan_key = 1 << 24;
+    while (trace.size() < length) {
+        for (int i = 0; i < 4 * scan_length && trace.size() < length; i++) {
+            double u = std::uniform_real_distribution<double>(0, 1)(mt);
+            trace.push_back(static_cast<int>(hot_keys * u * u * u));
+        }
+        for (int i = 0; i < scan_length && trace.size() < length; i++)
+            trace.push_back(scan_key++);
+    }
+    return trace;
+}
+
+template <typename Cache>
+double replay(Cache& cache, const std::vector<int>& trace) {
+    for (int key : trace)
+        if (!cache.get(key))
+            cache.put(key, key);
+    return cache.hit_ratio();
+}
+
+int lru_cache_test()
+{
+    std::cout << "lru_cache_test{" << std::endl;
+
+    std::cout << "----------------test1：基本操作-------------------" << std::endl;
+    lru_cache<int, std::string> a(3);
+    a.put(1, "one");
+    a.put(2, "two");
+    a.put(3, "three");
+    std::cout << "get(1):" << *a.get(1) << " get(4):" << (a.get(4) ? "hit" : "miss") << std::endl;
+    a.put(4, "four");           //最久未使用的2被淘汰
+    std::cout << "put(4)后 contains(2):" << a.contains(2) << " contains(1):" << a.contains(1) << " size:" << a.size() << std::endl;
+    a.put(3, "THREE");
+    std::cout << "put(3, THREE)后 peek(3):" << *a.peek(3) << " evict():" << a.evict() << " contains(1):" << a.contains(1) << std::endl;
+    std::cout << "erase(3):" << a.erase(3) << " erase(3):" << a.erase(3) << " size:" << a.size() << std::endl;
+    std::cout << "hits:" << a.hits() << " misses:" << a.misses() << " evictions:" << a.evictions() << std::endl;
+    a.set_capacity(10);
+    for (int i = 0; i < 20; i++)
+        a.put(i, std::to_string(i));
+    a.set_capacity(5);
+    std::cout << "set_capacity(5)后 size:" << a.size() << " contains(19):" << a.contains(19) << " contains(14):" << a.contains(14) << std::endl;
+    a.clear();
+    std::cout << "clear后empty:" << a.empty() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------test2：W-TinyLFU抵御扫描-------------" << std::endl;
+    const size_t cap = 1000;
+    std::vector<int> trace = scan_polluted_trace(2000000, 5000, 2000);
+    lru_cache<int, int> lru(cap);
+    lru_cache<int, int, std::hash<int>, equal_to<int>, allocator<int>, tiny_lfu_admission> tlfu(cap);
+    std::cout << "LRU命中率:" << replay(lru, trace) << std::endl;
+    std::cout << "W-TinyLFU命中率:" << replay(tlfu, trace) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test3：多线程分片缓存---------------" << std::endl;
+    concurrent_lru_cache<int, int> b(100000, 16);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 8; t++)
+        workers.emplace_back([&b, t]() {
+            std::mt19937 mt(static_cast<unsigned>(t + 1));
+            int out = 0;
+            for (int i = 0; i < 200000; i++) {
+                int key = static_cast<int>(mt() % 200000);
+                if (!b.get(key, out))
+                    b.put(key, key);
+            }
+        });
+    for (auto& th : workers)
+        th.join();
+    std::cout << "shards:" << b.concurrency_level() << " size:" << b.size() << " capacity:" << b.capacity()
+        << " hits + misses:" << b.hits() + b.misses() << std::endl;
+    concurrent_lru_cache<int, int> c(100, 16);
+    for (int i = 0; i < 10000; i++)
+        c.put(i, i);
+    std::cout << "容量不能被片数整除时 shards:" << c.concurrency_level() << " capacity:" << c.capacity()
+        << " 填满后size:" << c.size() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "----------------test4：性能测试------------------" << std::endl;
+    const size_t N = 5e6;
+    std::vector<int> keys(N);
+    std::mt19937 mt(7);
+    for (int& key : keys)
+        key = static_cast<int>(mt() % (4 * cap * 100));
+
+    lru_cache<int, int> octLRU(cap * 100);
+    auto tick1 = steady_clock::now();
+    size_t hit = 0;
+    for (int key : keys) {
+        if (octLRU.get(key))
+            hit++;
+        else octLRU.put(key, key);
+    }
+    auto tick2 = steady_clock::now();
+    std::cout << "oct::lru_cache:" << duration<double, std::milli>(tick2 - tick1).count() << " hits:" << hit << std::endl;
+
+    std_lru_cache<int, int> stdLRU(cap * 100);
+    tick1 = steady_clock::now();
+    hit = 0;
+    for (int key : keys) {
+        if (stdLRU.get(key))
+            hit++;
+        else stdLRU.put(key, key);
+    }
+    tick2 = steady_clock::now();
+    std::cout << "std::list + std::unordered_map:" << duration<double, std::milli>(tick2 - tick1).count() << " hits:" << hit << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "}" << std::endl << std::endl;
+
+    return 0;
+}
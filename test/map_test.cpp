@@ -3,9 +3,15 @@
 #include <numeric>
 #include <random>
 #include <map>
+#include <set>
 #include <string>
+#include <string_view>
 #include <chrono>
+#include <cmath>
+#include <vector>
 #include "map.hpp"
+#include "set.hpp"
+#include "augmented_map.hpp"
 using namespace oct;
 using namespace std::chrono;
 
@@ -17,6 +23,88 @@ void print(Container& container, const char ch = 0) {
         std::cout << '[' << key << ", " << val << "] ";
     std::cout << '\n';
 }
+template <template <typename...> typename Tree>
+double map_mix_bench(const int* keys, size_t n, size_t ops, unsigned read_percent) {
+    oct::map<int, int, oct::less<int>, oct::allocator<int>, Tree> octMAP;
+    for (size_t i = 0; i < n / 2; i++)
+        octMAP[keys[i]] = 1;
+    std::mt19937 mt(read_percent);
+    size_t hit = 0;
+    auto tick1 = steady_clock::now();
+    for (size_t i = 0; i < ops; i++) {
+        unsigned op = mt() % 100;
+        int key = keys[mt() % n];
+        if (op < read_percent)
+            hit += octMAP.find(key) != octMAP.end();
+        else if (op & 1)
+            octMAP.insert({ key, 1 });
+        else
+            octMAP.erase(key);
+    }
+    auto tick2 = steady_clock::now();
+    if (hit == size_t(-1))
+        std::cout << hit;
+    return duration<double, std::milli>(tick2 - tick1).count();
+}
+
+template <template <typename...> typename Tree>
+double map_lookup_bench(const int* keys, size_t n, const int* queries, size_t ops) {
+    oct::map<int, int, oct::less<int>, oct::allocator<int>, Tree> octMAP;
+    for (size_t i = 0; i < n; i++)
+        octMAP[keys[i]] = 1;
+    size_t hit = 0;
+    auto tick1 = steady_clock::now();
+    for (size_t i = 0; i < ops; i++)
+        hit += octMAP.find(queries[i]) != octMAP.end();
+    auto tick2 = steady_clock::now();
+    if (hit == size_t(-1))
+        std::cout << hit;
+    return duration<double, std::milli>(tick2 - tick1).count();
+}
+
+//不是less的比较器, B树节点内因此退回二分查找, 用来对照SIMD查找
+struct plain_less {
+    template <typename Ty>
+    bool operator()(const Ty& left, const Ty& right) const {
+        return left < right;
+    }
+};
+
+//SIMD查找与二分查找的B树集合在随机插入删除后分别与std::set比较lower_bound/upper_bound, 返回不一致的次数
+template <typename Ty>
+size_t btree_search_check(unsigned seed) {
+    set<Ty, less<Ty>, allocator<Ty>, btree> simd;
+    set<Ty, plain_less, allocator<Ty>, btree> generic;
+    std::set<Ty> expect;
+    std::mt19937 mt(seed);
+    auto random_key = [&mt](int range) { return static_cast<Ty>(static_cast<int>(mt() % (2 * range)) - range) / 4; };
+    for (int i = 0; i < 100000; i++) {
+        Ty key = random_key(100000);
+        simd.insert(key);
+        generic.insert(key);
+        expect.insert(key);
+    }
+    for (int i = 0; i < 60000; i++) {
+        Ty key = random_key(100000);
+        simd.erase(key);
+        generic.erase(key);
+        expect.erase(key);
+    }
+    size_t bad = simd.size() != expect.size() || generic.size() != expect.size()
+        || !std::equal(simd.begin(), simd.end(), expect.begin(), expect.end());
+    for (int i = 0; i < 100000; i++) {
+        Ty key = random_key(120000);        //包括超出两端的关键字
+        auto lower = expect.lower_bound(key), upper = expect.upper_bound(key);
+        auto simd_lower = simd.lower_bound(key), simd_upper = simd.upper_bound(key);
+        auto generic_lower = generic.lower_bound(key), generic_upper = generic.upper_bound(key);
+        bad += (simd_lower == simd.end()) != (lower == expect.end()) || (lower != expect.end() && *simd_lower != *lower);
+        bad += (simd_upper == simd.end()) != (upper == expect.end()) || (upper != expect.end() && *simd_upper != *upper);
+        bad += (generic_lower == generic.end()) != (lower == expect.end()) || (lower != expect.end() && *generic_lower != *lower);
+        bad += (generic_upper == generic.end()) != (upper == expect.end()) || (upper != expect.end() && *generic_upper != *upper);
+    }
+    return bad;
+}
+
 int map_test()
 {
     using namespace std::literals::string_literals;
@@ -54,6 +142,13 @@ int map_test()
     a[7] = 128;
     a[9] = 512;                                         print(a, 'a');
     a[9] = 1024;                                        print(a, 'a');
+    try {
+        a.erase(a.end());
+    }
+    catch (const std::out_of_range& e) {
+        std::cout << "a.erase(a.end()):" << e.what() << std::endl;
+    }
+    print(a, 'a');
     std::cout << "--------------------------------------------------" << std::endl;
 
     std::cout << "------------------test4:元素查找------------------" << std::endl;
@@ -114,9 +209,403 @@ int map_test()
     tick4 = steady_clock::now();;
     std::cout << "oct:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
     std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------test6：AVL/红黑树后端对比------------" << std::endl;
+    map<int, int, less<int>, allocator<int>, avl_tree> g;
+    for (int i : {5, 3, 8, 1, 4, 7, 9, 2, 6, 0})
+        g[i] = i * i;                                   print(g, 'g');
+    for (int i : {3, 8, 0})
+        g.erase(i);                                     print(g, 'g');
+    std::cout << "g.lower_bound(3):" << (*g.lower_bound(3)).first << std::endl;
+    const size_t M = 1e6, OPS = 1e7;
+    std::cout << "数据量：" << M << " 操作数：" << OPS << std::endl;
+    for (unsigned read_percent : {90u, 10u}) {
+        std::cout << (read_percent > 50 ? "read-heavy" : "write-heavy") << " (find " << read_percent << "%):(ms)" << std::endl;
+        std::cout << "avl:" << map_mix_bench<avl_tree>(data1, M, OPS, read_percent) << std::endl;
+        std::cout << "red_black:" << map_mix_bench<red_black_tree>(data1, M, OPS, read_percent) << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-----------test7：伸展树/红黑树Zipf查找对比----------" << std::endl;
+    map<int, int, less<int>, allocator<int>, splay_tree> h;
+    for (int i : {5, 3, 8, 1, 4, 7, 9, 2, 6, 0})
+        h[i] = i * i;                                   print(h, 'h');
+    for (int i : {3, 8, 0})
+        h.erase(i);                                     print(h, 'h');
+    const auto& ch = h;
+    std::cout << "ch.find(4)(不伸展):" << (*ch.find(4)).second << std::endl;
+    std::vector<double> weights(M);
+    for (size_t i = 0; i < M; i++)
+        weights[i] = 1.0 / std::pow(double(i + 1), 1.1);
+    std::discrete_distribution<size_t> zipf(weights.begin(), weights.end());
+    int* queries = new int[OPS];
+    for (size_t i = 0; i < OPS; i++)
+        queries[i] = data1[zipf(mt)];
+    std::cout << "数据量：" << M << " 查找数(Zipf 1.1)：" << OPS << "(ms)" << std::endl;
+    std::cout << "splay:" << map_lookup_bench<splay_tree>(data1, M, queries, OPS) << std::endl;
+    std::cout << "red_black:" << map_lookup_bench<red_black_tree>(data1, M, queries, OPS) << std::endl;
+    delete[] queries;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test8：树堆split/join/集合运算-------------" << std::endl;
+    map<int, int, less<int>, allocator<int>, treap> t1, t2;
+    for (int i : {5, 3, 8, 1, 4, 7, 9, 2, 6, 0})
+        t1[i] = i * i;                                  print(t1, '1');
+    t2 = t1.split(5);                                   print(t1, '1'); print(t2, '2');
+    t1.join(t2);                                        print(t1, '1'); print(t2, '2');
+    for (int i : {8, 9, 10, 11})
+        t2[i] = -i;
+    auto t3 = t2, t4 = t1, t5 = t1;
+    t3.set_difference(t4);                              print(t3, '3');     //t4被消耗
+    t2.set_intersection(t5);                            print(t2, '2');
+    t1.set_union(t3);                                   print(t1, '1');
+    std::cout << "数据量：" << M << " union compare:(ms)" << std::endl;
+    for (size_t m : {size_t(1e3), size_t(1e5), M}) {
+        map<int, int, less<int>, allocator<int>, treap> big, small;
+        map<int, int> rb_big;
+        for (size_t i = 0; i < M; i++) {
+            big[data1[i]] = 1;
+            rb_big[data1[i]] = 1;
+        }
+        for (size_t i = 0; i < m; i++)
+            small[data2[i]] = 1;
+        map<int, int> rb_small(small.begin(), small.end());
+        tick1 = steady_clock::now();
+        big.set_union(small);
+        tick2 = steady_clock::now();
+        tick3 = steady_clock::now();
+        for (const auto& kv : rb_small)
+            rb_big.insert(kv);
+        tick4 = steady_clock::now();
+        std::cout << "m=" << m << " treap set_union:" << duration<double, std::milli>(tick2 - tick1).count()
+                  << " red_black insert:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test9：B树/红黑树后端对比-------------" << std::endl;
+    map<int, int, less<int>, allocator<int>, btree> bt;
+    for (int i : {5, 3, 8, 1, 4, 7, 9, 2, 6, 0})
+        bt[i] = i * i;                                  print(bt, 'b');
+    for (int i : {3, 8, 0})
+        bt.erase(i);                                    print(bt, 'b');
+    std::cout << "bt.lower_bound(3):" << bt.lower_bound(3)->first << std::endl;
+    std::cout << "数据量：" << M << " 查找数：" << M << "(ms)" << std::endl;
+    std::cout << "btree:" << map_lookup_bench<btree>(data1, M, data1, M) << std::endl;
+    std::cout << "red_black:" << map_lookup_bench<red_black_tree>(data1, M, data1, M) << std::endl;
+    std::cout << "数据量：" << M << " 操作数：" << OPS << "(find 50%)(ms)" << std::endl;
+    std::cout << "btree:" << map_mix_bench<btree>(data1, M, OPS, 50) << std::endl;
+    std::cout << "red_black:" << map_mix_bench<red_black_tree>(data1, M, OPS, 50) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------test10：有序批量构造/end()提示插入---------" << std::endl;
+    std::vector<pair<int, int>> sorted_data(M);
+    std::vector<std::pair<int, int>> std_sorted_data(M);
+    for (size_t i = 0; i < M; i++) {
+        sorted_data[i] = pair<int, int>(int(i), int(i));
+        std_sorted_data[i] = std::pair<int, int>(int(i), int(i));
+    }
+    std::cout << "数据量：" << M << " 有序区间构造:(ms)" << std::endl;
+    tick1 = steady_clock::now();
+    map<int, int> bulk(sorted_data.begin(), sorted_data.end());
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    std::map<int, int> std_bulk(std_sorted_data.begin(), std_sorted_data.end());
+    tick4 = steady_clock::now();
+    std::cout << "oct:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "bulk.size():" << bulk.size() << " (*--bulk.end()).first:" << (*--bulk.end()).first << std::endl;
+    std::cout << "有序追加 insert(x) / insert(end(), x):(ms)" << std::endl;
+    map<int, int> append1, append2;
+    tick1 = steady_clock::now();
+    for (const auto& kv : sorted_data)
+        append1.insert(kv);
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    for (const auto& kv : sorted_data)
+        append2.insert(append2.end(), kv);
+    tick4 = steady_clock::now();
+    std::cout << "insert(x):" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "insert(end(), x):" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test11：名次查询/滑动窗口p99-----------" << std::endl;
+    map<int, int, oct::less<int>, oct::allocator<int>, order_statistic_tree> ranked;
+    for (int i = 0; i < 10; i++)
+        ranked[i * 10] = i;
+    std::cout << "find_by_order(3):" << (*ranked.find_by_order(3)).first
+              << " order_of_key(35):" << ranked.order_of_key(35)
+              << " distance(begin(), find(70)):" << distance(ranked.begin(), ranked.find(70)) << std::endl;
+    const size_t W = 100000, STEP = 10000;
+    std::cout << "数据量：" << M << " 窗口：" << W << " 每" << STEP << "次插入求一次p99:(ms)" << std::endl;
+    map<long long, int, oct::less<long long>, oct::allocator<long long>, order_statistic_tree> window;
+    std::map<long long, int> std_window;
+    long long p99_sum1 = 0, p99_sum2 = 0;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < M; i++) {
+        window[(long long)data1[i] * W + (long long)(i % W)] = 1;       //值相同时以窗口内下标区分
+        if (i >= W)
+            window.erase((long long)data1[i - W] * W + (long long)(i % W));
+        if (i % STEP == 0)
+            p99_sum1 += (*window.find_by_order(window.size() * 99 / 100)).first;
+    }
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    for (size_t i = 0; i < M; i++) {
+        std_window[(long long)data1[i] * W + (long long)(i % W)] = 1;
+        if (i >= W)
+            std_window.erase((long long)data1[i - W] * W + (long long)(i % W));
+        if (i % STEP == 0)
+            p99_sum2 += std::next(std_window.begin(), std_window.size() * 99 / 100)->first;
+    }
+    tick4 = steady_clock::now();
+    std::cout << "oct:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "结果一致:" << (p99_sum1 == p99_sum2) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "--------test12：aggregate_map/interval_map---------" << std::endl;
+    aggregate_map<int, long long> sums;
+    aggregate_map<int, int, min_monoid<int>> mins;
+    for (int i = 1; i <= 10; i++) {
+        sums.insert_or_assign(i, i * 10);
+        mins.insert_or_assign(i, 100 - i * i);
+    }
+    sums.insert_or_assign(5, 0);
+    std::cout << "sums.range_query(3, 6):" << sums.range_query(3, 6) << " sums.aggregate():" << sums.aggregate()
+              << " mins.range_query(2, 4):" << mins.range_query(2, 4) << std::endl;
+    interval_map<int, std::string> meetings;
+    meetings.insert(900, 1000, "standup"s);
+    meetings.insert(930, 1130, "review"s);
+    meetings.insert(1300, 1400, "lunch talk"s);
+    meetings.insert(1350, 1500, "planning"s);
+    std::vector<interval_map<int, std::string>::iterator> hits;
+    meetings.range_query(1000, 1330, std::back_inserter(hits));
+    std::cout << "与[1000, 1330]重叠:";
+    for (auto it : hits)
+        std::cout << " [" << (*it).first.first << ", " << (*it).first.second << "]" << (*it).second;
+    std::cout << " overlap_find(1200, 1250)==end():" << (meetings.overlap_find(1200, 1250) == meetings.end()) << std::endl;
+    const size_t Q = M / 100, SPAN = M / 1000;
+    std::cout << "数据量：" << M << " 区间求和 " << Q << " 次, 每次覆盖" << SPAN << "个关键字:(ms)" << std::endl;
+    aggregate_map<int, long long> agg;
+    std::map<int, long long> std_agg;
+    for (size_t i = 0; i < M; i++) {
+        agg.insert_or_assign(data1[i], data2[i]);
+        std_agg[data1[i]] = data2[i];
+    }
+    std::vector<int> sorted_keys;
+    for (const auto& kv : std_agg)
+        sorted_keys.push_back(kv.first);
+    std::mt19937 range_mt(12);
+    std::vector<std::pair<int, int>> ranges(Q);
+    for (auto& r : ranges) {
+        size_t lo = range_mt() % (sorted_keys.size() - SPAN);
+        r = std::pair<int, int>(sorted_keys[lo], sorted_keys[lo + SPAN - 1]);
+    }
+    long long range_sum1 = 0, range_sum2 = 0;
+    tick1 = steady_clock::now();
+    for (const auto& r : ranges)
+        range_sum1 += agg.range_query(r.first, r.second);
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    for (const auto& r : ranges)
+        for (auto it = std_agg.lower_bound(r.first); it != std_agg.end() && it->first <= r.second; ++it)
+            range_sum2 += it->second;
+    tick4 = steady_clock::now();
+    std::cout << "oct range_query:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "std 逐个累加:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "结果一致:" << (range_sum1 == range_sum2) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "--------test13：节点句柄extract/insert/merge--------" << std::endl;
+    map<int, std::string> shard_a{ {1, "a"s}, {3, "c"s} }, shard_b{ {2, "b"s}, {3, "x"s} };
+    auto handle = shard_a.extract(1);
+    handle.key() = 4;
+    shard_b.insert(std::move(handle));
+    shard_a.merge(shard_b);
+    std::cout << "shard_a:";
+    for (const auto& kv : shard_a)
+        std::cout << " " << kv.first << kv.second;
+    std::cout << " shard_b:";
+    for (const auto& kv : shard_b)
+        std::cout << " " << kv.first << kv.second;
+    std::cout << std::endl;
+    std::cout << "数据量：" << M << " 两个分片合并为一个:(ms)" << std::endl;
+    map<int, int> merge_dst, merge_src, copy_dst, copy_src;
+    std::map<int, int> std_dst, std_src;
+    for (size_t i = 0; i < M; i++) {
+        (i % 2 ? merge_src : merge_dst).insert({ data1[i], data2[i] });
+        (i % 2 ? copy_src : copy_dst).insert({ data1[i], data2[i] });
+        (i % 2 ? std_src : std_dst).insert({ data1[i], data2[i] });
+    }
+    tick1 = steady_clock::now();
+    merge_dst.merge(merge_src);
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    copy_dst.insert(copy_src.begin(), copy_src.end());
+    copy_src.clear();
+    tick4 = steady_clock::now();
+    auto tick5 = steady_clock::now();
+    std_dst.merge(std_src);
+    auto tick6 = steady_clock::now();
+    std::cout << "oct merge:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "oct 复制插入后清空:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "std merge:" << duration<double, std::milli>(tick6 - tick5).count() << std::endl;
+    std::cout << "结果一致:" << (merge_dst.size() == std_dst.size() && merge_src.size() == std_src.size()) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------test14：透明比较器less<>异构查找----------" << std::endl;
+    map<std::string, int, less<>> words{ {"apple"s, 1}, {"banana"s, 2} };
+    std::string_view banana = "banana";
+    std::cout << "find(\"apple\"):" << (*words.find("apple")).second << " find(string_view):" << (*words.find(banana)).second
+              << " count(\"cherry\"):" << words.count("cherry") << std::endl;
+    const size_t K = M / 10;
+    std::vector<std::string> names(K);
+    for (size_t i = 0; i < K; i++)
+        names[i] = "sensor/region-" + std::to_string(data1[i] % 1000) + "/device-" + std::to_string(i);
+    map<std::string, int> opaque_names;
+    map<std::string, int, less<>> transparent_names;
+    for (size_t i = 0; i < K; i++) {
+        opaque_names.insert({ names[i], int(i) });
+        transparent_names.insert({ names[i], int(i) });
+    }
+    std::cout << "数据量：" << K << " 以const char*/string_view查找" << K << "次:(ms)" << std::endl;
+    size_t hit1 = 0, hit2 = 0, hit3 = 0;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < K; i++)
+        hit1 += opaque_names.count(names[i].c_str());
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    for (size_t i = 0; i < K; i++)
+        hit2 += transparent_names.count(names[i].c_str());
+    tick4 = steady_clock::now();
+    auto tick7 = steady_clock::now();
+    for (size_t i = 0; i < K; i++)
+        hit3 += transparent_names.count(std::string_view(names[i]));
+    auto tick8 = steady_clock::now();
+    std::cout << "less<std::string> const char*(转换一次):" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "less<> const char*:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "less<> string_view:" << duration<double, std::milli>(tick8 - tick7).count() << std::endl;
+    std::cout << "结果一致:" << (hit1 == K && hit2 == K && hit3 == K) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------test15：emplace_hint/有序批量insert_sorted---------" << std::endl;
+    map<int, std::string> series{ {10, "a"s}, {40, "d"s} };
+    auto series_it = series.emplace_hint(series.find(40), 30, "c"s);
+    series.emplace_hint(series_it, 20, "b"s);
+    pair<int, std::string> ticks[] = { {35, "c+"s}, {50, "e"s}, {60, "f"s} };
+    series.insert_sorted(ticks, ticks + 3);             print(series, 's');
+    std::cout << "数据量：" << M << " 向已有" << M << "个元素的树中插入一批有序关键字:(ms)" << std::endl;
+    std::vector<int> sorted_batch(data2, data2 + M);
+    std::sort(sorted_batch.begin(), sorted_batch.end());
+    std::vector<pair<int, int>> batch_pairs(M);
+    std::vector<std::pair<int, int>> std_batch_pairs(M);
+    for (size_t i = 0; i < M; i++) {
+        batch_pairs[i] = pair<int, int>(sorted_batch[i], int(i));
+        std_batch_pairs[i] = std::pair<int, int>(sorted_batch[i], int(i));
+    }
+    map<int, int> finger_map, root_map;
+    std::map<int, int> std_series;
+    for (size_t i = 0; i < M; i++) {
+        finger_map.insert({ data1[i], 0 });
+        root_map.insert({ data1[i], 0 });
+        std_series.insert({ data1[i], 0 });
+    }
+    tick1 = steady_clock::now();
+    finger_map.insert_sorted(batch_pairs.begin(), batch_pairs.end());
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    for (const auto& kv : batch_pairs)
+        root_map.insert(kv);
+    tick4 = steady_clock::now();
+    auto tick9 = steady_clock::now();
+    std_series.insert(std_batch_pairs.begin(), std_batch_pairs.end());
+    auto tick10 = steady_clock::now();
+    std::cout << "oct insert_sorted:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "oct 逐个insert:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "std insert(first, last):" << duration<double, std::milli>(tick10 - tick9).count() << std::endl;
+    std::cout << "结果一致:" << (finger_map.size() == std_series.size() && root_map.size() == std_series.size()) << std::endl;
+    std::cout << "---------test16：emplace/try_emplace/insert_or_assign----------" << std::endl;
+    map<std::string, std::string> conf;
+    conf.emplace("host"s, "localhost"s);
+    conf.emplace(std::piecewise_construct, std::forward_as_tuple("port"), std::forward_as_tuple(4, '8'));
+    std::string fallback = "0.0.0.0";
+    conf.try_emplace("host"s, std::move(fallback));     //关键字已存在, fallback不会被移走
+    std::cout << "fallback:" << fallback << std::endl;
+    conf.insert_or_assign("host"s, "127.0.0.1"s);
+    conf.insert_or_assign("user"s, "root"s);            print(conf, 's');
+    std::cout << "数据量：" << M << " 关键字大量重复, 值为长字符串:(ms)" << std::endl;
+    map<int, std::string> copy_map, emplace_map;
+    std::map<int, std::string> std_emplace_map;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < M; i++)
+        copy_map.insert(pair<int, std::string>(data1[i] % (M / 2), std::string(64, 'x')));
+    tick2 = steady_clock::now();
+    tick3 = steady_clock::now();
+    for (size_t i = 0; i < M; i++)
+        emplace_map.try_emplace(data1[i] % (M / 2), 64, 'x');
+    tick4 = steady_clock::now();
+    auto tick11 = steady_clock::now();
+    for (size_t i = 0; i < M; i++)
+        std_emplace_map.try_emplace(data1[i] % (M / 2), 64, 'x');
+    auto tick12 = steady_clock::now();
+    std::cout << "oct insert(先构造再复制):" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "oct try_emplace:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "std try_emplace:" << duration<double, std::milli>(tick12 - tick11).count() << std::endl;
+    std::cout << "结果一致:" << (copy_map.size() == std_emplace_map.size() && emplace_map.size() == std_emplace_map.size()) << std::endl;
     delete[] data1;
     delete[] data2;
     std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------test17：B树分裂与合并/SIMD查找/跨叶迭代-------" << std::endl;
+    {
+        auto same = [](const auto& left, const auto& right) { return left.first == right.first && left.second == right.second; };
+        map<int, int, less<int>, allocator<int>, btree> bm;
+        std::map<int, int> expect;
+        std::mt19937 mt(17);
+        size_t bad = 0;
+        for (int round = 0; round < 4; round++) {       //每轮先插入使叶子与内部节点多次分裂, 再删除多于插入的次数使节点借位与合并
+            for (int i = 0; i < 50000; i++) {
+                int key = static_cast<int>(mt() % 100000);
+                bm[key] = i;
+                expect[key] = i;
+            }
+            for (int i = 0; i < 80000; i++) {
+                int key = static_cast<int>(mt() % 100000);
+                bad += bm.erase(key) != expect.erase(key);
+            }
+            bad += bm.size() != expect.size() || !std::equal(bm.begin(), bm.end(), expect.begin(), expect.end(), same);
+        }
+        std::cout << "多轮插入删除后与std::map一致:" << !bad << " size:" << bm.size() << std::endl;
+
+        for (int i = 0; i < 100000; i++) {
+            bm[i] = -i;
+            expect[i] = -i;
+        }
+        size_t forward = 0, backward = 0;
+        auto rit = expect.rbegin();
+        for (auto it = bm.begin(); it != bm.end(); ++it)
+            forward++;
+        for (auto it = bm.end(); it != bm.begin();) {
+            --it;
+            bad += !same(*it, *rit++);
+            backward++;
+        }
+        std::cout << "跨叶正向与反向遍历:" << (forward == expect.size() && backward == expect.size() && !bad) << std::endl;
+
+        for (auto it = bm.begin(); it != bm.end();)     //逐个删除奇数关键字, 删除返回的迭代器跨越叶子的合并
+            it = it->first & 1 ? bm.erase(it) : std::next(it);
+        for (auto it = expect.begin(); it != expect.end();)
+            it = it->first & 1 ? expect.erase(it) : std::next(it);
+        bad += !std::equal(bm.begin(), bm.end(), expect.begin(), expect.end(), same);
+        while (!bm.empty())
+            bm.erase(bm.begin());
+        std::cout << "按迭代器删除:" << !bad << " 删空后begin()==end():" << (bm.begin() == bm.end()) << std::endl;
+
+        std::cout << "SIMD/二分查找与std::set比较, 不一致次数 int32:" << btree_search_check<int>(1)
+            << " float:" << btree_search_check<float>(2) << " double:" << btree_search_check<double>(3) << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
     std::cout << "}" << std::endl << std::endl;
 
     return 0;
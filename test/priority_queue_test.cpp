@@ -2,10 +2,126 @@
 #include <queue>
 #include <chrono>
 #include <random>
+#include <vector>
 #include "queue.hpp"
+#include "pairing_heap.hpp"
 using namespace oct;
 using namespace std::chrono;
 
+//先全部入队再全部出队, 分别返回两段的毫秒数
+template <typename Queue>
+std::pair<double, double> push_pop_time(Queue& que, const int* data, size_t n) {
+    auto tick1 = steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+        que.push(data[i]);
+    auto tick2 = steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+        que.pop();
+    auto tick3 = steady_clock::now();
+    return { duration<double, std::milli>(tick2 - tick1).count(), duration<double, std::milli>(tick3 - tick2).count() };
+}
+
+//以CSR存储的有向图, 顶点v的出边为[offset[v], offset[v + 1])
+struct csr_graph {
+    std::vector<size_t> offset;
+    std::vector<size_t> target;
+    std::vector<long long> weight;
+};
+
+csr_graph random_graph(size_t n, size_t degree, unsigned seed) {
+    csr_graph g;
+    std::mt19937 mt(seed);
+    g.offset.resize(n + 1);
+    for (size_t v = 0; v <= n; v++)
+        g.offset[v] = v * degree;
+    for (size_t e = 0; e < n * degree; e++) {
+        g.target.push_back(mt() % n);
+        g.weight.push_back(mt() % 1000 + 1);
+    }
+    return g;
+}
+
+const long long unreachable = -1;
+
+//重复入队, 出队时跳过过期的条目; peak记录堆的最大规模
+template <typename Queue>
+std::vector<long long> lazy_dijkstra(const csr_graph& g, size_t source, size_t& peak) {
+    std::vector<long long> dist(g.offset.size() - 1, unreachable);
+    Queue que;
+    dist[source] = 0;
+    que.push(std::pair<long long, size_t>(0, source));
+    peak = 1;
+    while (!que.empty()) {
+        std::pair<long long, size_t> cur = que.top();
+        que.pop();
+        if (cur.first != dist[cur.second])
+            continue;
+        for (size_t e = g.offset[cur.second]; e < g.offset[cur.second + 1]; e++) {
+            long long next = cur.first + g.weight[e];
+            size_t v = g.target[e];
+            if (dist[v] == unreachable || next < dist[v]) {
+                dist[v] = next;
+                que.push(std::pair<long long, size_t>(next, v));
+            }
+        }
+        peak = que.size() > peak ? que.size() : peak;
+    }
+    return dist;
+}
+
+template <size_t Arity>
+std::vector<long long> indexed_dijkstra(const csr_graph& g, size_t source) {
+    std::vector<long long> dist(g.offset.size() - 1, unreachable);
+    indexed_priority_queue<long long, vector<long long>, greater<long long>, Arity> que(dist.size());
+    dist[source] = 0;
+    que.push(source, 0);
+    while (!que.empty()) {
+        size_t u = que.top_handle();
+        long long d = que.top();
+        que.pop();
+        for (size_t e = g.offset[u]; e < g.offset[u + 1]; e++) {
+            long long next = d + g.weight[e];
+            size_t v = g.target[e];
+            if (dist[v] == unreachable) {
+                dist[v] = next;
+                que.push(v, next);
+            }
+            else if (next < dist[v]) {
+                dist[v] = next;
+                que.decrease_key(v, next);
+            }
+        }
+    }
+    return dist;
+}
+
+//堆中保存(距离, 顶点), 每个顶点至多一个节点
+std::vector<long long> pairing_dijkstra(const csr_graph& g, size_t source) {
+    using heap = pairing_heap<std::pair<long long, size_t>, std::greater<std::pair<long long, size_t>>>;
+    std::vector<long long> dist(g.offset.size() - 1, unreachable);
+    std::vector<heap::handle_type> handles(dist.size());
+    heap que;
+    dist[source] = 0;
+    handles[source] = que.push(std::pair<long long, size_t>(0, source));
+    while (!que.empty()) {
+        std::pair<long long, size_t> cur = que.top();
+        que.pop();
+        for (size_t e = g.offset[cur.second]; e < g.offset[cur.second + 1]; e++) {
+            long long next = cur.first + g.weight[e];
+            size_t v = g.target[e];
+            if (dist[v] == unreachable) {
+                dist[v] = next;
+                handles[v] = que.push(std::pair<long long, size_t>(next, v));
+            }
+            else if (next < dist[v]) {
+                dist[v] = next;
+                que.decrease_key(handles[v], std::pair<long long, size_t>(next, v));
+            }
+        }
+    }
+    return dist;
+}
+
 int priority_queue_test() {
     std::cout << "priority_queue_test{" << std::endl;
     priority_queue<int>que1;
@@ -69,6 +185,137 @@ int priority_queue_test() {
     std::cout << "std:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
     std::cout << "--------------------------------------------------" << std::endl;
 
+    std::cout << "---------------test4:建堆与替换堆顶---------------" << std::endl;
+    int init[] = { 5, 4, 3, 1, 2, 6, 7, 9, 8, 0 };
+    priority_queue<int, vector<int>, less<int>, 4> que3(init, init + 10);
+    std::cout << "4叉堆区间建堆 top:" << que3.top() << " size:" << que3.size() << std::endl;
+    que3.replace_top(-1);
+    std::cout << "replace_top(-1)后 top:" << que3.top() << std::endl;
+    std::cout << "pop_push(100):" << que3.pop_push(100) << " pop_push(3):" << que3.pop_push(3) << " top:" << que3.top() << std::endl;
+    int more[] = { 11, 12, 13 };
+    que3.push_range(more, more + 3);
+    std::cout << "push_range后:";
+    while (!que3.empty()) {
+        std::cout << que3.top() << ' ';
+        que3.pop();
+    }
+    std::cout << std::endl;
+    try {
+        que3.replace_top(1);
+    }
+    catch (const std::logic_error& e) {
+        std::cout << "空堆replace_top:" << e.what() << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test5：d叉堆比较std::priority_queue-------------" << std::endl;
+    std::cout << "数据量：" << N << std::endl;
+    for (size_t i = 0; i < N; i++)
+        data[i] = mt();
+    std::cout << "push/pop compare:(ms)" << std::endl;
+    oct::priority_queue<int> octQUE2;
+    auto t = push_pop_time(octQUE2, data, N);
+    std::cout << "oct 2叉:" << t.first << " / " << t.second << std::endl;
+    oct::priority_queue<int, vector<int>, less<int>, 4> octQUE4;
+    t = push_pop_time(octQUE4, data, N);
+    std::cout << "oct 4叉:" << t.first << " / " << t.second << std::endl;
+    oct::priority_queue<int, vector<int>, less<int>, 8> octQUE8;
+    t = push_pop_time(octQUE8, data, N);
+    std::cout << "oct 8叉:" << t.first << " / " << t.second << std::endl;
+    std::priority_queue<int> stdQUE2;
+    t = push_pop_time(stdQUE2, data, N);
+    std::cout << "std:" << t.first << " / " << t.second << std::endl;
+
+    //调度器式负载: 堆大小不变, 每次取出最早的截止时间, 再放回它加上一段随机延迟后的新截止时间
+    std::cout << std::endl << "heapify + replace_top compare:(ms)" << std::endl;
+    const size_t M = 1 << 20;
+    for (size_t i = 0; i < N; i++)
+        data[i] &= 0xFFFFF;
+    tick1 = steady_clock::now();
+    oct::priority_queue<int, vector<int>, greater<int>, 4> octSCHED(data, data + M);
+    for (size_t i = M; i < N; i++)
+        octSCHED.replace_top(octSCHED.top() + data[i]);
+    tick2 = steady_clock::now();
+    std::cout << "oct 4叉:" << duration<double, std::milli>(tick2 - tick1).count() << " top:" << octSCHED.top() << std::endl;
+    tick1 = steady_clock::now();
+    std::priority_queue<int, std::vector<int>, std::greater<int>> stdSCHED(data, data + M);
+    for (size_t i = M; i < N; i++) {
+        int next = stdSCHED.top() + data[i];
+        stdSCHED.pop();
+        stdSCHED.push(next);
+    }
+    tick2 = steady_clock::now();
+    std::cout << "std:" << duration<double, std::milli>(tick2 - tick1).count() << " top:" << stdSCHED.top() << std::endl;
+    delete[] data;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test6:indexed_priority_queue--------------" << std::endl;
+    indexed_priority_queue<int, vector<int>, greater<int>> idx;
+    for (int i : {5, 4, 3, 1, 2, 6, 7, 9, 8, 0})
+        idx.push(i, i * 10);
+    idx.decrease_key(9, -5);
+    idx.increase_key(0, 55);
+    idx.erase(3);
+    idx.update(7, 15);
+    std::cout << "contains(3):" << idx.contains(3) << " at(0):" << idx.at(0) << " size:" << idx.size() << std::endl;
+    std::cout << "出队(句柄:值):";
+    while (!idx.empty()) {
+        std::cout << idx.top_handle() << ':' << idx.top() << ' ';
+        idx.pop();
+    }
+    std::cout << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-----------------test7:pairing_heap------------------" << std::endl;
+    pairing_heap<int, greater<int>> ph1, ph2;
+    std::vector<pairing_heap<int, greater<int>>::handle_type> hs;
+    for (int i : {5, 4, 3, 1, 2})
+        hs.push_back(ph1.push(i * 10));
+    for (int i : {6, 7, 9, 8, 0})
+        ph2.push(i * 10);
+    hs[0] = ph1.push(100);
+    ph1.decrease_key(hs[0], -1);
+    ph1.increase_key(hs[3], 95);
+    ph1.erase(hs[1]);
+    ph1.merge(ph2);
+    std::cout << "merge后 size:" << ph1.size() << " ph2.empty():" << ph2.empty() << " *hs[3]:" << *hs[3] << std::endl;
+    std::cout << "出队:";
+    while (!ph1.empty()) {
+        std::cout << ph1.top() << ' ';
+        ph1.pop();
+    }
+    std::cout << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------------test8:Dijkstra------------------" << std::endl;
+    const size_t V = 1 << 20;
+    csr_graph graph = random_graph(V, 4, 11);
+    std::cout << "顶点数:" << V << " 边数:" << graph.target.size() << std::endl;
+    using entry = std::pair<long long, size_t>;
+    size_t peak = 0;
+    tick1 = steady_clock::now();
+    std::vector<long long> expect = lazy_dijkstra<std::priority_queue<entry, std::vector<entry>, std::greater<entry>>>(graph, 0, peak);
+    tick2 = steady_clock::now();
+    std::cout << "std::priority_queue重复入队:" << duration<double, std::milli>(tick2 - tick1).count() << " 堆峰值:" << peak << std::endl;
+    tick1 = steady_clock::now();
+    std::vector<long long> res = lazy_dijkstra<oct::priority_queue<entry, vector<entry>, std::greater<entry>, 4>>(graph, 0, peak);
+    tick2 = steady_clock::now();
+    std::cout << "oct::priority_queue 4叉重复入队:" << duration<double, std::milli>(tick2 - tick1).count()
+        << " 堆峰值:" << peak << " 结果一致:" << (res == expect) << std::endl;
+    tick1 = steady_clock::now();
+    res = indexed_dijkstra<2>(graph, 0);
+    tick2 = steady_clock::now();
+    std::cout << "indexed_priority_queue 2叉:" << duration<double, std::milli>(tick2 - tick1).count() << " 结果一致:" << (res == expect) << std::endl;
+    tick1 = steady_clock::now();
+    res = indexed_dijkstra<4>(graph, 0);
+    tick2 = steady_clock::now();
+    std::cout << "indexed_priority_queue 4叉:" << duration<double, std::milli>(tick2 - tick1).count() << " 结果一致:" << (res == expect) << std::endl;
+    tick1 = steady_clock::now();
+    res = pairing_dijkstra(graph, 0);
+    tick2 = steady_clock::now();
+    std::cout << "pairing_heap:" << duration<double, std::milli>(tick2 - tick1).count() << " 结果一致:" << (res == expect) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
     std::cout << "}" << std::endl << std::endl;;
 
     return 0;
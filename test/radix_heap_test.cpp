@@ -0,0 +1,226 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "queue.hpp"
+#include "radix_heap.hpp"
+#include "bucket_queue.hpp"
+#include "timer_wheel.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+//以CSR存储的有向图, 顶点v的出边为[offset[v], offset[v + 1])
+struct monotone_graph {
+    std::vector<size_t> offset;
+    std::vector<size_t> target;
+    std::vector<size_t> weight;
+};
+
+monotone_graph random_monotone_graph(size_t n, size_t degree, size_t max_weight, unsigned seed) {
+    monotone_graph g;
+    std::mt19937 mt(seed);
+    g.offset.resize(n + 1);
+    for (size_t v = 0; v <= n; v++)
+        g.offset[v] = v * degree;
+    for (size_t e = 0; e < n * degree; e++) {
+        g.target.push_back(mt() % n);
+        g.weight.push_back(mt() % max_weight + 1);
+    }
+    return g;
+}
+
+const size_t unreached = static_cast<size_t>(-1);
+
+//重复入队的Dijkstra, 只用到push(value_type)/top/pop, 三种队列共用
+template <typename Queue>
+std::vector<size_t> monotone_dijkstra(Queue& que, const monotone_graph& g, size_t source) {
+    std::vector<size_t> dist(g.offset.size() - 1, unreached);
+    dist[source] = 0;
+    que.push(typename Queue::value_type(0, source));
+    while (!que.empty()) {
+        size_t d = que.top().first;
+        size_t u = que.top().second;
+        que.pop();
+        if (d != dist[u])
+            continue;
+        for (size_t e = g.offset[u]; e < g.offset[u + 1]; e++) {
+            size_t next = d + g.weight[e];
+            size_t v = g.target[e];
+            if (next < dist[v]) {
+                dist[v] = next;
+                que.push(typename Queue::value_type(next, v));
+            }
+        }
+    }
+    return dist;
+}
+
+//定时器负载: 反复取出最早到期的定时器并以随机延迟重新设置, 返回全部到期时刻之和作为校验
+template <typename Queue>
+uint64_t rearm_time(Queue& que, const uint32_t* delays, size_t timers, size_t rounds, double& ms) {
+    for (size_t i = 0; i < timers; i++)
+        que.push(typename Queue::value_type(delays[i], i));
+    uint64_t sum = 0;
+    auto tick1 = steady_clock::now();
+    for (size_t i = 0; i < rounds; i++) {
+        uint64_t now = que.top().first;
+        size_t id = que.top().second;
+        sum += now;
+        que.pop();
+        que.push(typename Queue::value_type(now + delays[i], id));
+    }
+    auto tick2 = steady_clock::now();
+    ms = duration<double, std::milli>(tick2 - tick1).count();
+    return sum;
+}
+
+int radix_heap_test() {
+    std::cout << "radix_heap_test{" << std::endl;
+    std::chrono::steady_clock::time_point tick1, tick2;
+
+    std::cout << "----------------test1:radix_heap-----------------" << std::endl;
+    radix_heap<uint32_t, int> rh;
+    rh.push(5, 50);
+    rh.push(3, 30);
+    rh.push(9, 90);
+    rh.push(3, 31);
+    std::cout << "size:" << rh.size() << " top:" << rh.top_key() << std::endl;
+    rh.pop();
+    rh.push(4, 40);
+    std::cout << "出队3后入队4, 依次出队:";
+    while (!rh.empty()) {
+        std::cout << rh.top().first << "/" << rh.top().second << " ";
+        rh.pop();
+    }
+    std::cout << std::endl;
+    rh.push(10, 100);
+    rh.pop();
+    try {
+        rh.push(20, 200);
+        rh.push(8, 80);
+    }
+    catch (const std::invalid_argument& e) {
+        std::cout << "关键字小于上次出队的关键字:" << e.what() << std::endl;
+    }
+    rh.clear();
+    rh.push(1, 10);
+    std::cout << "清空后从1重新开始:" << rh.top_key() << std::endl;
+    {
+        //入队的关键字落在上次出队的关键字与当前堆顶之间, 检查top与二叉堆一致且每个元素只弹出一次
+        radix_heap<uint32_t, int> mixed;
+        using entry = std::pair<uint32_t, int>;
+        oct::priority_queue<entry, vector<entry>, std::greater<entry>> expect;
+        std::mt19937 mt(3);
+        std::vector<char> popped(200000, 0);
+        size_t bad = 0;
+        uint32_t now = 0;
+        for (int i = 0; i < 200000; i++) {
+            uint32_t key = now + mt() % 1000;
+            mixed.push(key, i);
+            expect.push(entry(key, i));
+            if (mt() % 3) {
+                bad += mixed.top().first != expect.top().first || popped[mixed.top().second]++;
+                now = mixed.top().first;
+                mixed.pop();
+                expect.pop();
+            }
+        }
+        std::cout << "随机入队出队与二叉堆一致:" << (!bad && mixed.size() == expect.size()) << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------------test2:bucket_queue----------------" << std::endl;
+    bucket_queue<char> bq(10);
+    bq.push(100, 'a');
+    bq.push(107, 'c');
+    bq.push(102, 'b');
+    std::cout << "span:" << bq.span() << " 依次出队:";
+    while (!bq.empty()) {
+        std::cout << bq.top_key() << bq.top().second << " ";
+        if (bq.top_key() == 100)
+            bq.push(110, 'd');
+        bq.pop();
+    }
+    std::cout << std::endl;
+    bq.push(200, 'x');
+    bq.push(205, 'y');
+    bq.pop();
+    try {
+        bq.push(211, 'z');
+    }
+    catch (const std::out_of_range& e) {
+        std::cout << "超出span:" << e.what() << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------------test3:timer_wheel-----------------" << std::endl;
+    timer_wheel<int> wheel(1000);
+    wheel.push(1005, 1);
+    wheel.push(1000 + (1 << 20), 2);
+    wheel.push(1064, 3);
+    wheel.push(999, 4);
+    std::cout << "过期的定时器按当前时刻入队, top:" << wheel.top_key() << "/" << wheel.top().second << std::endl;
+    size_t fired = wheel.advance(1100, [&](pair<uint64_t, int>& timer) {
+        std::cout << "触发" << timer.second << "@" << timer.first << " ";
+        if (timer.second == 1)
+            wheel.push(timer.first + 50, 5);
+    });
+    std::cout << std::endl << "触发个数:" << fired << " now:" << wheel.now() << " 剩余:" << wheel.size()
+        << " top:" << wheel.top_key() << std::endl;
+    wheel.pop();
+    std::cout << "弹出后now:" << wheel.now() << " empty:" << wheel.empty() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------------test4:Dijkstra------------------" << std::endl;
+    const size_t V = 1 << 20, W = 1000;
+    monotone_graph graph = random_monotone_graph(V, 4, W, 11);
+    std::cout << "顶点数:" << V << " 边数:" << graph.target.size() << " 最大边权:" << W << std::endl;
+    {
+        using entry = std::pair<size_t, size_t>;
+        oct::priority_queue<entry, vector<entry>, std::greater<entry>> que;
+        tick1 = steady_clock::now();
+        std::vector<size_t> expect = monotone_dijkstra(que, graph, 0);
+        tick2 = steady_clock::now();
+        std::cout << "oct::priority_queue二叉堆:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+        radix_heap<uint64_t, size_t> radix;
+        tick1 = steady_clock::now();
+        std::vector<size_t> res = monotone_dijkstra(radix, graph, 0);
+        tick2 = steady_clock::now();
+        std::cout << "radix_heap:" << duration<double, std::milli>(tick2 - tick1).count() << " 结果一致:" << (res == expect) << std::endl;
+        bucket_queue<size_t> buckets(W);
+        tick1 = steady_clock::now();
+        res = monotone_dijkstra(buckets, graph, 0);
+        tick2 = steady_clock::now();
+        std::cout << "bucket_queue:" << duration<double, std::milli>(tick2 - tick1).count() << " 结果一致:" << (res == expect) << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "----------------test5:定时器重设-----------------" << std::endl;
+    const size_t T = 1 << 16, R = 10000000, D = 1 << 16;
+    std::vector<uint32_t> delays(R > T ? R : T);
+    std::mt19937 mt(7);
+    for (size_t i = 0; i < delays.size(); i++)
+        delays[i] = mt() % D + 1;
+    std::cout << "定时器数:" << T << " 重设次数:" << R << " 最大延迟:" << D << std::endl;
+    {
+        double ms = 0;
+        using entry = std::pair<uint64_t, size_t>;
+        oct::priority_queue<entry, vector<entry>, std::greater<entry>> que;
+        uint64_t expect = rearm_time(que, delays.data(), T, R, ms);
+        std::cout << "oct::priority_queue二叉堆:" << ms << std::endl;
+        radix_heap<uint64_t, size_t> radix;
+        uint64_t res = rearm_time(radix, delays.data(), T, R, ms);
+        std::cout << "radix_heap:" << ms << " 结果一致:" << (res == expect) << std::endl;
+        bucket_queue<size_t> buckets(D);
+        res = rearm_time(buckets, delays.data(), T, R, ms);
+        std::cout << "bucket_queue:" << ms << " 结果一致:" << (res == expect) << std::endl;
+        timer_wheel<size_t> timers;
+        res = rearm_time(timers, delays.data(), T, R, ms);
+        std::cout << "timer_wheel:" << ms << " 结果一致:" << (res == expect) << std::endl;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "}" << std::endl << std::endl;;
+
+    return 0;
+}
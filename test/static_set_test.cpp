@@ -0,0 +1,106 @@
+#include <iostream>
+#include <random>
+#include <string>
+#include <chrono>
+#include <vector>
+#include "set.hpp"
+#include "flat_set.hpp"
+#include "static_set.hpp"
+#include "static_map.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+template<typename Container>
+void print(Container& container, const char ch = 0) {
+    if (ch)std::cout << ch << ": ";
+    if (container.empty())std::cout << "EMPTY";
+    else for (const auto& key : container)
+        std::cout << key << ' ';
+    std::cout << '\n';
+}
+
+template <typename Set>
+double lower_bound_bench(const Set& container, const std::vector<int>& queries, size_t& sum) {
+    auto tick1 = steady_clock::now();
+    for (int key : queries) {
+        auto it = container.lower_bound(key);
+        sum += it != container.end() ? static_cast<size_t>(*it) : 0;
+    }
+    auto tick2 = steady_clock::now();
+    return duration<double, std::milli>(tick2 - tick1).count();
+}
+
+int static_set_test()
+{
+    std::cout << "static_set_test{" << std::endl;
+
+    std::cout << "----------------test1：构造/冻结-------------------" << std::endl;
+    static_set<int> a;                                  print(a, 'a');
+    set<int> s{ 9, 3, 27, 1, 81, 243, 729 };
+    static_set<int> b(s);                               print(b, 'b');
+    static_set<int> c{ 5, 3, 5, 1, 4, 1, 2 };           print(c, 'c');
+    int x[5] = { 10, 20, 30, 40, 50 };
+    static_set<int> d(sorted_unique, x, x + 5);         print(d, 'd');
+    static_set<int> e(d);                               print(e, 'e');
+    std::cout << "d == e:" << (d == e) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------------test2:元素查找------------------" << std::endl;
+    std::cout << "b.count(27):" << b.count(27) << " b.contains(28):" << b.contains(28) << std::endl;
+    std::cout << "*b.lower_bound(28):" << *b.lower_bound(28) << " *b.upper_bound(81):" << *b.upper_bound(81)
+        << " b.lower_bound(1000)==end:" << (b.lower_bound(1000) == b.end()) << std::endl;
+    auto [lower, upper] = b.equal_range(9);
+    std::cout << "equal_range(9):" << *lower << ' ' << *upper << std::endl;
+    int q[4] = { 0, 10, 100, 1000 };
+    size_t idx[4];
+    b.lower_bound_many(q, q + 4, idx);
+    std::cout << "lower_bound_many:";
+    for (size_t i : idx)
+        std::cout << i << ' ';
+    std::cout << std::endl;
+    static_set<std::string> f{ "pear", "apple", "fig", "kiwi" };
+    print(f, 'f');
+    std::cout << "*f.lower_bound(\"b\"):" << *f.lower_bound("b") << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------------test3:static_map------------------" << std::endl;
+    map<int, std::string> m{ {3, "three"}, {1, "one"}, {2, "two"} };
+    static_map<int, std::string> g(m);
+    for (auto it = g.begin(); it != g.end(); ++it)
+        std::cout << '[' << it->first << ", " << it->second << "] ";
+    std::cout << std::endl;
+    g.at(2) = "TWO";
+    std::cout << "g.at(2):" << g.at(2) << " g.find(4)==end:" << (g.find(4) == g.end())
+        << " g.lower_bound(0)->first:" << g.lower_bound(0)->first << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "--------test4：比较set/flat_set lower_bound-------" << std::endl;
+    const size_t N = 1e7, OPS = 1e7;
+    std::cout << "数据量：" << N << " 查找数：" << OPS << "(ms)" << std::endl;
+    std::mt19937 mt;
+    std::vector<int> keys(N);
+    for (size_t i = 0; i < N; i++)
+        keys[i] = static_cast<int>(mt());
+    std::vector<int> queries(OPS);
+    for (size_t i = 0; i < OPS; i++)
+        queries[i] = static_cast<int>(mt());
+    set<int> octSET(keys.begin(), keys.end());
+    flat_set<int> octFLAT(keys.begin(), keys.end());
+    static_set<int> octSTATIC(octSET);
+    size_t sum = 0;
+    std::cout << "red_black_tree:" << lower_bound_bench(octSET, queries, sum) << std::endl;
+    std::cout << "flat_set:" << lower_bound_bench(octFLAT, queries, sum) << std::endl;
+    std::cout << "static_set:" << lower_bound_bench(octSTATIC, queries, sum) << std::endl;
+    std::vector<size_t> result(OPS);
+    auto tick1 = steady_clock::now();
+    octSTATIC.lower_bound_many(queries.begin(), queries.end(), result.begin());
+    auto tick2 = steady_clock::now();
+    for (size_t i : result)
+        sum += i;
+    std::cout << "static_set::lower_bound_many:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "校验和:" << sum << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "}" << std::endl << std::endl;
+
+    return 0;
+}
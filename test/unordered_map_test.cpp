@@ -0,0 +1,232 @@
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <unordered_map>
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "unordered_set.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+template<typename Container>
+void print(Container& container, const char ch = 0) {
+    if (ch)std::cout << ch << ": ";
+    if (container.empty())std::cout << "EMPTY";
+    else for (const auto& [key, val] : container)
+        std::cout << '[' << key << ", " << val << "] ";
+    std::cout << '\n';
+}
+
+struct string_hash {
+    using is_transparent = void;
+    size_t operator()(std::string_view str) const noexcept {
+        return std::hash<std::string_view>()(str);
+    }
+};
+
+int unordered_map_test()
+{
+    using namespace std::literals::string_literals;
+    std::cout << "unordered_map_test{" << std::endl;
+
+    std::cout << "----------------test1：构造函数-------------------" << std::endl;
+    unordered_map<int, int>a;                           print(a, 'a');
+    pair<std::string, int> x[4] = { {"one", 1}, {"eight", 8}, {"three", 3}, {"four", 4} };
+    unordered_map<std::string, int>b(x, x + 4);         print(b, 'b');
+    unordered_map<std::string, int>c(b);                print(c, 'c');
+    unordered_map<std::string, int>d(std::move(c));     print(d, 'd');
+    unordered_map<std::string, int>e{ {"five", 5}, {"six", 6} };
+    print(e, 'e');
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "--------------test2：operator=/swap---------------" << std::endl;
+    c = d;                                              print(c, 'c');
+    e.swap(c);                                          print(e, 'e'); print(c, 'c');
+    std::cout << std::boolalpha << (d == e) << ' ' << (d != c) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------------test3:元素添加/删除----------------" << std::endl;
+    for (int i = 0; i < 8; i++)
+        a[i] = i * i;                                   print(a, 'a');
+    for (int i : {6, 1, 2})
+        a.erase(i);                                     print(a, 'a');
+    a.insert({ 10, 100 });
+    a.emplace(11, 121);
+    a.try_emplace(3, -1);
+    a.insert_or_assign(4, -16);                         print(a, 'a');
+    for (auto it = a.begin(); it != a.end(); )
+        it = (*it).second < 0 ? a.erase(it) : ++it;     print(a, 'a');
+    unordered_map<int, std::string> self;
+    self[0] = "value of key 0";
+    for (int i = 1; i < 200; i++)
+        self.try_emplace(i, self.at(0));    //扩容时参数引用的元素也在旧槽位数组中
+    bool same = true;
+    for (int i = 0; i < 200; i++)
+        same = same && self.at(i) == "value of key 0";
+    std::cout << "self.size():" << self.size() << " 值正确:" << same << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "------------------test4:元素查找------------------" << std::endl;
+    std::cout << "a.count(3):" << a.count(3) << " a.find(10):" << (*a.find(10)).second << std::endl;
+    std::cout << "a.at(7):" << a.at(7) << " a.find(6) == end:" << (a.find(6) == a.end()) << std::endl;
+    unordered_map<std::string, int, string_hash, equal_to<>> f(x, x + 4);
+    std::cout << "f.find(string_view(\"three\")):" << (*f.find(std::string_view("three"))).second << std::endl;
+    std::cout << "bucket_count:" << a.bucket_count() << " load_factor:" << a.load_factor()
+              << " max_load_factor:" << a.max_load_factor() << std::endl;
+    a.reserve(1000);
+    std::cout << "reserve(1000)后bucket_count:" << a.bucket_count() << std::endl;
+    unordered_set<int> s{ 3, 1, 4, 1, 5, 9, 2, 6 };
+    std::cout << "s.size():" << s.size() << " s.count(9):" << s.count(9) << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "----------------test5:节点式哈希表----------------" << std::endl;
+    unordered_map<int, std::string, std::hash<int>, equal_to<int>, allocator<std::string>, chained_table> g;
+    g[1] = "one";
+    std::string* p = &g[1];
+    for (int i = 2; i < 1000; i++)
+        g.emplace(i, std::to_string(i));
+    std::cout << "插入后指针不变:" << (p == &g.at(1)) << " bucket_count:" << g.bucket_count() << std::endl;
+    g.max_load_factor(0.5f);
+    std::cout << "max_load_factor(0.5)后bucket_count:" << g.bucket_count() << " load_factor:" << g.load_factor()
+              << " 指针不变:" << (p == &g.at(1)) << std::endl;
+    size_t n = g.bucket(1);
+    std::cout << "bucket(1):" << n << " bucket_size:" << g.bucket_size(n) << " 桶内元素:";
+    for (auto it = g.begin(n); it != g.end(n); ++it)
+        std::cout << (*it).first << ' ';
+    std::cout << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "---------------test6:Robin Hood哈希表---------------" << std::endl;
+    unordered_map<int, int, std::hash<int>, equal_to<int>, allocator<int>, robin_hood_table> h;
+    h.max_load_factor(0.95f);
+    for (int i = 0; i < 1000; i++)
+        h[i] = i * 2;
+    std::cout << "bucket_count:" << h.bucket_count() << " load_factor:" << h.load_factor() << std::endl;
+    for (auto it = h.begin(); it != h.end(); )
+        it = (*it).first % 3 ? h.erase(it) : ++it;
+    std::cout << "删除非3的倍数后size:" << h.size() << std::endl;
+    unordered_map<int, std::string, std::hash<int>, equal_to<int>, allocator<std::string>, robin_hood_table> rh;
+    rh[0] = "value of key 0";
+    for (int i = 1; i < 200; i++)
+        rh.try_emplace(i, rh.at(0));        //扩容和后移都会搬动参数引用的元素
+    bool moved = true;
+    for (int i = 0; i < 200; i++)
+        moved = moved && rh.at(i) == "value of key 0";
+    std::cout << "rh.size():" << rh.size() << " 值正确:" << moved << std::endl;
+    int keys[4] = { 3, 4, 999, 1000 };
+    decltype(h)::iterator found[4];
+    h.find_many(keys, found);
+    std::cout << "find_many(3, 4, 999, 1000):";
+    for (auto it : found)
+        std::cout << ' ' << (it == h.end() ? -1 : (*it).second);
+    std::cout << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------test7：比较std::unordered_map/oct::map-------" << std::endl;
+    const size_t N = 1e7;
+    std::cout << "数据量：" << N << std::endl;
+    int* data1 = new int[N];
+    int* data2 = new int[N];
+    std::mt19937 mt;
+    for (size_t i = 0; i < N; i++) {
+        data1[i] = mt();
+        data2[i] = mt();
+    }
+    unordered_map<int, int> octHASH;
+    unordered_map<int, int, std::hash<int>, equal_to<int>, allocator<int>, chained_table> octCHAIN;
+    unordered_map<int, int, std::hash<int>, equal_to<int>, allocator<int>, robin_hood_table> octROBIN;
+    octROBIN.max_load_factor(0.95f);
+    std::unordered_map<int, int> stdHASH;
+    map<int, int> octMAP;
+
+    std::cout << "insert compare:(ms)" << std::endl;
+    auto tick1 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octHASH[data1[i]] = data2[i];
+    auto tick2 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        stdHASH[data1[i]] = data2[i];
+    auto tick3 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octMAP[data1[i]] = data2[i];
+    auto tick4 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octCHAIN[data1[i]] = data2[i];
+    auto tick5 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octROBIN[data1[i]] = data2[i];
+    auto tick6 = steady_clock::now();
+    std::cout << "oct unordered_map:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "std unordered_map:" << duration<double, std::milli>(tick3 - tick2).count() << std::endl;
+    std::cout << "oct map:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "oct unordered_map(chained_table):" << duration<double, std::milli>(tick5 - tick4).count() << std::endl;
+    std::cout << "oct unordered_map(robin_hood_table):" << duration<double, std::milli>(tick6 - tick5).count() << std::endl;
+
+    std::cout << std::endl << "find compare(一半命中):(ms)" << std::endl;
+    size_t hit1 = 0, hit2 = 0, hit3 = 0, hit4 = 0, hit5 = 0, hit6 = 0;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        hit1 += octHASH.find(i & 1 ? data1[i] : data2[i]) != octHASH.end();
+    tick2 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        hit2 += stdHASH.find(i & 1 ? data1[i] : data2[i]) != stdHASH.end();
+    tick3 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        hit3 += octMAP.find(i & 1 ? data1[i] : data2[i]) != octMAP.end();
+    tick4 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        hit4 += octCHAIN.find(i & 1 ? data1[i] : data2[i]) != octCHAIN.end();
+    tick5 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        hit5 += octROBIN.find(i & 1 ? data1[i] : data2[i]) != octROBIN.end();
+    tick6 = steady_clock::now();
+    int batch[64];
+    decltype(octROBIN)::iterator res[64];
+    for (size_t i = 0; i < N; i += 64) {
+        for (size_t j = 0; j < 64; j++)
+            batch[j] = (i + j) & 1 ? data1[(i + j) % N] : data2[(i + j) % N];
+        octROBIN.find_many(batch, res);
+        for (size_t j = 0; j < 64 && i + j < N; j++)
+            hit6 += res[j] != octROBIN.end();
+    }
+    auto tick7 = steady_clock::now();
+    std::cout << "oct unordered_map:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "std unordered_map:" << duration<double, std::milli>(tick3 - tick2).count() << std::endl;
+    std::cout << "oct map:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "oct unordered_map(chained_table):" << duration<double, std::milli>(tick5 - tick4).count() << std::endl;
+    std::cout << "oct unordered_map(robin_hood_table):" << duration<double, std::milli>(tick6 - tick5).count() << std::endl;
+    std::cout << "oct unordered_map(robin_hood_table)::find_many:" << duration<double, std::milli>(tick7 - tick6).count() << std::endl;
+    std::cout << "结果一致:" << (hit1 == hit2 && hit2 == hit3 && hit3 == hit4 && hit4 == hit5 && hit5 == hit6) << std::endl;
+
+    std::cout << std::endl << "erase compare:(ms)" << std::endl;
+    tick1 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octHASH.erase(data1[i]);
+    tick2 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        stdHASH.erase(data1[i]);
+    tick3 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octMAP.erase(data1[i]);
+    tick4 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octCHAIN.erase(data1[i]);
+    tick5 = steady_clock::now();
+    for (size_t i = 0; i < N; i++)
+        octROBIN.erase(data1[i]);
+    tick6 = steady_clock::now();
+    std::cout << "oct unordered_map:" << duration<double, std::milli>(tick2 - tick1).count() << std::endl;
+    std::cout << "std unordered_map:" << duration<double, std::milli>(tick3 - tick2).count() << std::endl;
+    std::cout << "oct map:" << duration<double, std::milli>(tick4 - tick3).count() << std::endl;
+    std::cout << "oct unordered_map(chained_table):" << duration<double, std::milli>(tick5 - tick4).count() << std::endl;
+    std::cout << "oct unordered_map(robin_hood_table):" << duration<double, std::milli>(tick6 - tick5).count() << std::endl;
+    std::cout << "结果一致:" << (octHASH.empty() && stdHASH.empty() && octMAP.empty() && octCHAIN.empty() && octROBIN.empty()) << std::endl;
+    delete[] data1;
+    delete[] data2;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "}" << std::endl << std::endl;
+
+    return 0;
+}
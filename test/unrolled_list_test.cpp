@@ -0,0 +1,168 @@
+#include <iostream>
+#include <list>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <stdexcept>
+#include "list.hpp"
+#include "unrolled_list.hpp"
+using namespace oct;
+using namespace std::chrono;
+
+template<typename Container>
+void print(Container& container, const char ch = 0) {
+    if (ch)std::cout << ch << ':';
+    if (container.empty())std::cout << "EMPTY";
+    else for (const auto& elem : container)
+        std::cout << elem << ' ';
+    std::cout << '\n';
+}
+
+template <typename List>
+double traverse_bench(const List& container, size_t rounds, long long& sum) {
+    long long local = 0;
+    auto tick1 = steady_clock::now();
+    for (size_t r = 0; r < rounds; r++)
+        for (auto it = container.begin(); it != container.end(); ++it)
+            local += *it;
+    auto tick2 = steady_clock::now();
+    sum += local;
+    return duration<double, std::milli>(tick2 - tick1).count();
+}
+
+//每步前进step个元素后插入, 模拟在迭代器处的随机插入
+template <typename List>
+double insert_bench(List& container, size_t count, size_t step) {
+    auto tick1 = steady_clock::now();
+    auto it = container.begin();
+    for (size_t i = 0; i < count; i++) {
+        for (size_t k = 0; k < step && it != container.end(); k++)
+            ++it;
+        if (it == container.end())
+            it = container.begin();
+        it = container.insert(it, static_cast<int>(i));
+    }
+    auto tick2 = steady_clock::now();
+    return duration<double, std::milli>(tick2 - tick1).count();
+}
+
+//构造参数为负数, 或从fragile的对象复制时抛出异常
+struct fragile_elem {
+    int val;
+    bool fragile;
+
+    fragile_elem(int val, bool fragile = false) : val(val), fragile(fragile) {
+        if (val < 0)
+            throw std::invalid_argument("negative fragile_elem");
+    }
+
+    fragile_elem(const fragile_elem& other) : val(other.val), fragile(other.fragile) {
+        if (fragile)
+            throw std::runtime_error("fragile_elem copied");
+    }
+};
+
+int unrolled_list_test()
+{
+    std::cout << "unrolled_list_test{" << std::endl;
+
+    std::cout << "----------------test1：构造函数-------------------" << std::endl;
+    unrolled_list<int> a;                               print(a, 'a');
+    unrolled_list<int> b(5);                            print(b, 'b');
+    unrolled_list<int> c(3, 3);                         print(c, 'c');
+    double x[] = { 1.1,2.2,3.3 };
+    unrolled_list<double> d(x, x + 3);                  print(d, 'd');
+    unrolled_list<double> e(d);                         print(e, 'e');
+    unrolled_list<int, 4> f{ 1,2,3,4,5,6,7,8,9 };       print(f, 'f');
+    std::cout << "f.node_count():" << f.node_count() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-------------test2：插入/删除/节点拆分------------" << std::endl;
+    auto it = f.begin();
+    ++it; ++it;
+    it = f.insert(it, 100);                             print(f, 'f');
+    std::cout << "*it:" << *it << " f.node_count():" << f.node_count() << std::endl;
+    f.emplace_front(0); f.emplace_back(10);             print(f, 'f');
+    it = f.erase(it);                                   print(f, 'f');
+    std::cout << "*it:" << *it << std::endl;
+    f.erase(f.begin(), ++++++f.begin());                print(f, 'f');
+    f.pop_back(); f.pop_front();                        print(f, 'f');
+    f.insert(++f.begin(), 3, -1);                       print(f, 'f');
+    std::cout << "f.node_count():" << f.node_count() << std::endl;
+    f.shrink_to_fit();
+    std::cout << "shrink_to_fit后f.node_count():" << f.node_count() << std::endl;
+    unrolled_list<int> self{ 1, 2, 3, 4 };
+    self.insert(self.begin(), self.back());             //参数引用的元素会在空出槽位时被搬动
+    self.emplace(++self.begin(), self.front());         print(self, 'l');
+    unrolled_list<fragile_elem, 4> t;
+    for (int i = 1; i <= 4; i++)
+        t.emplace_back(i);
+    try {
+        t.emplace(t.begin(), -1);                       //节点已满, 构造失败后不应留下为此新建的空节点
+    }
+    catch (const std::invalid_argument& e) {
+        std::cout << e.what() << ' ';
+    }
+    try {
+        t.emplace(t.begin(), 5, true);                  //临时元素搬入新节点时失败
+    }
+    catch (const std::runtime_error& e) {
+        std::cout << e.what() << ' ';
+    }
+    try {
+        t.emplace_back(-1);
+    }
+    catch (const std::invalid_argument& e) {
+        std::cout << e.what() << ' ';
+    }
+    std::cout << "t.size():" << t.size() << " t.node_count():" << t.node_count() << " t:";
+    for (const fragile_elem& elem : t)
+        std::cout << elem.val << ' ';
+    std::cout << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "----------test3：splice/merge/sort/unique---------" << std::endl;
+    unrolled_list<int, 4> g{ 20, 21, 22 };
+    f.splice(++f.begin(), g);                           print(f, 'f'); print(g, 'g');
+    f.sort();                                           print(f, 'f');
+    unrolled_list<int, 4> h{ -5, 6, 6, 30 };
+    f.merge(h);                                         print(f, 'f');
+    std::cout << "unique:" << f.unique() << ' ';        print(f);
+    std::cout << "remove_if(odd):" << f.remove_if([](int v) { return v & 1; }) << ' '; print(f);
+    f.reverse();                                        print(f, 'f');
+    unrolled_list<std::string> s{ "pear", "apple", "fig" };
+    s.emplace(++s.begin(), 3, 'z');
+    s.sort();                                           print(s, 's');
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "-----test4：比较std::list/oct::list遍历与插入-----" << std::endl;
+    const size_t N = 1e7, ROUNDS = 10, INS = 1e6;
+    std::cout << "数据量：" << N << " 遍历轮数：" << ROUNDS << " 插入数：" << INS << "(ms)" << std::endl;
+    std::mt19937 mt;
+    std::vector<int> values(N);
+    for (size_t i = 0; i < N; i++)
+        values[i] = static_cast<int>(mt() % 1000);
+    std::list<int> stdLIST(values.begin(), values.end());
+    list<int> octLIST(values.begin(), values.end());
+    unrolled_list<int> octUNROLLED(values.begin(), values.end());
+    long long sum = 0;
+    std::cout << "std::list traverse:" << traverse_bench(stdLIST, ROUNDS, sum) << std::endl;
+    std::cout << "oct::list traverse:" << traverse_bench(octLIST, ROUNDS, sum) << std::endl;
+    std::cout << "unrolled_list traverse:" << traverse_bench(octUNROLLED, ROUNDS, sum) << std::endl;
+    std::cout << "std::list insert:" << insert_bench(stdLIST, INS, 37) << std::endl;
+    std::cout << "oct::list insert:" << insert_bench(octLIST, INS, 37) << std::endl;
+    std::cout << "unrolled_list insert:" << insert_bench(octUNROLLED, INS, 37) << std::endl;
+    std::cout << "插入后节点在内存中不再连续" << std::endl;
+    std::cout << "std::list traverse:" << traverse_bench(stdLIST, ROUNDS, sum) << std::endl;
+    std::cout << "oct::list traverse:" << traverse_bench(octLIST, ROUNDS, sum) << std::endl;
+    std::cout << "unrolled_list traverse:" << traverse_bench(octUNROLLED, ROUNDS, sum) << std::endl;
+    std::cout << "unrolled_list每元素字节数:"
+        << double(octUNROLLED.node_count() * sizeof(unrolled_list_node<int, unrolled_list<int>::node_capacity>)) / octUNROLLED.size()
+        << " list每元素字节数:" << sizeof(list_node<int>) << std::endl;
+    std::cout << "校验和:" << sum << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "}" << std::endl << std::endl;
+
+    return 0;
+}
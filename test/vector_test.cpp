@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <numeric>
 #include <vector>
+#include <string>
 #include <chrono>
 #include "vector.hpp"
 using namespace oct;
@@ -50,12 +51,35 @@ int vector_test()
     std::iota(b.begin(), b.end(), 0);                   print(b, 'b');
     std::reverse(b.begin(), b.begin() + 5);             print(b, 'b');
     std::sort(b.begin(), b.end());                      print(b, 'b');
+    vector<int> r;
+    r.reserve(16);
+    r.resize(12, 1);    //容量足够时延长不会重新分配, 容量应保持不变
+    std::cout << "reserve(16)后resize(12), r.capacity(): " << r.capacity() << std::endl;
+    for (int i = 0; i < 12; i++)
+        r.push_back(i);
+    print(r, 'r');
+    vector<std::string> alias;
+    alias.push_back("first element");
+    alias.push_back("second element");                  //容量已满, 以下插入都以本容器中的元素为参数
+    alias.emplace_back(alias.front());
+    alias.emplace(alias.begin(), alias.back());
+    alias.insert(alias.begin() + 1, alias[3]);
+    alias.push_back(alias[1]);
+    alias.insert(alias.begin(), 2, alias.back());       print(alias, 's');
+    vector<int> ints{ 1, 2 };
+    while (ints.size() < ints.capacity())
+        ints.push_back(static_cast<int>(ints.size()) + 1);
+    ints.emplace_back(ints.front());
+    ints.emplace(ints.begin(), ints.back());
+    ints.insert(ints.begin() + 1, ints[2]);             print(ints, 'i');
     std::cout << "--------------------------------------------------" << std::endl;
 
     std::cout << "---------------test4:元素添加/删除----------------" << std::endl;
     a.push_back(10);
     a << 10 << 10 << 10 << 10;                          print(a,'a');
     a.insert(a.begin() + 1, 7);                         print(a, 'a');
+    a.emplace(a.begin() + 2, 8);
+    a.emplace_back(9);                                  print(a, 'a');
     int xx[3] = { 10,11,12 };
     a.insert(a.begin() + 1, xx, xx + 2);                print(a,'a');
     a.pop_back();                                       print(a,'a');